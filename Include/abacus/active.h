@@ -43,9 +43,7 @@
 
 class ABA_MASTER;
 class ABA_SPARVEC;
-#ifdef ABACUS_PARALLEL
 class ABA_MESSAGE;
-#endif
 
 template<class BaseType, class CoType> class ABA_POOLSLOT;
 template<class BaseType, class CoType> class ABA_POOLSLOTREF;
@@ -112,7 +110,7 @@ template <class BaseType, class CoType>
  *    constraints/variables not locally available. \a *needed is allocated in
  *    this function and has to be freed by the caller.
  */
-  ABA_ACTIVE(const ABA_MASTER *master, ABA_MESSAGE &msg,
+  ABA_ACTIVE(ABA_MASTER *master, ABA_MESSAGE &msg,
 	     ABA_BUFFER<ABA_ID> **idBuffer, ABA_BUFFER<int> **needed);
 
 /*! \brief Unpacks the constraints/variables
@@ -149,6 +147,27 @@ template <class BaseType, class CoType>
  *                   should be packed.
  */
   void packNeeded(ABA_MESSAGE &msg, const ABA_BUFFER<int> &needed) const;
+#else
+
+/*! \brief Creates the object from an ABA_MESSAGE.
+ *
+ * The constraints/variables must be available in the default pools
+ * of the master at the slots stored by the function \a pack().
+ *
+ * \param master A pointer to the corresponding master of the optimization.
+ * \param msg The message from which the object is initialized.
+ */
+  ABA_ACTIVE(ABA_MASTER *master, ABA_MESSAGE &msg);
+
+/*! \brief Packs the active set in an ABA_MESSAGE object.
+ *
+ * For each constraint/variable only its default pool and the number
+ * of its slot are packed. It is an error if a constraint/variable
+ * is not contained in one of the default pools.
+ *
+ * \param msg The ABA_MESSAGE object in which the active set is packed.
+ */
+  void pack(ABA_MESSAGE &msg) const;
 #endif
 #ifdef ABACUS_NEW_TEMPLATE_SYNTAX
 
@@ -38,10 +38,9 @@ using namespace std;
 
 #include "abacus/global.h"
 #include "abacus/buffer.h"
+#include "abacus/trivialcopy.h"
 
-#ifdef ABACUS_PARALLEL
-class MESSAGE;
-#endif
+class ABA_MESSAGE;
 
 #ifdef ABACUS_NEW_TEMPLATE_SYNTAX
 template<class Type> 
@@ -84,14 +83,13 @@ ostream& operator<< (ostream& out, const ABA_ARRAY<Type> &array);
 
 //! The destructor.
       ~ABA_ARRAY();
-#ifdef ABACUS_PARALLEL
 
 /*! The message constructor creates the ABA_ARRAY from an ABA_MESSAGE.
  *
  *   \param glob A pointer to the corresponding global object.
  *   \param msg The message from which the object is initialized.
  */
-      ABA_ARRAY(const ABA_GLOBAL *glob, ABA_MESSAGE &msg);
+      ABA_ARRAY(ABA_GLOBAL *glob, ABA_MESSAGE &msg);
 
 /*! Packs all elements of the array in an ABA_MESSAGE object.
  *
@@ -107,7 +105,6 @@ ostream& operator<< (ostream& out, const ABA_ARRAY<Type> &array);
  * \param nPacked The number of elements to be packed.
  */
       void pack(ABA_MESSAGE &msg, int nPacked) const;
-#endif
 
 /*! The assignment operator can only be used for arrays with equal length.
  *
@@ -246,6 +243,29 @@ ostream& operator<< (ostream& out, const ABA_ARRAY<Type> &array);
  */
       void realloc(int newSize, Type init);
 
+/*! \brief Enlarges the array such that it has at least \a newSize
+ * components.
+ *
+ * If a reallocation is necessary, the length of the array is at least
+ * doubled, such that an array enlarged step by step is reallocated only
+ * a logarithmic number of times. The elements are copied as in
+ * \a realloc(). The array is never shortened.
+ *
+ * \param newSize The minimal length of the array.
+ */
+      void reserve(int newSize);
+
+/*! \brief Exchanges the elements, the lengths, and the global objects of
+ * the array and of \a rhs without copying any element.
+ *
+ * If an array is copied and the original is not required anymore,
+ * the transfer with \a swap() should be preferred, as it requires
+ * only constant time and no allocation.
+ *
+ * \param rhs The array being exchanged with this array.
+ */
+      void swap(ABA_ARRAY<Type> &rhs);
+
     private:
 
 /*! \brief Stops the program with an error message
@@ -34,9 +34,7 @@
 
 #include "abacus/branchrule.h"
 
-#ifdef ABACUS_PARALLEL
-class MESSAGE;
-#endif
+class ABA_MESSAGE;
   class  ABA_BOUNDBRANCHRULE :  public ABA_BRANCHRULE  { 
     public: 
 
@@ -53,7 +51,6 @@ class MESSAGE;
 /*! The destructor.
  */
       virtual ~ABA_BOUNDBRANCHRULE();
-#ifdef ABACUS_PARALLEL
 
 /*! The message constructor creates the ABA_BOUNDBRANCHRULE from an ABA_MESSAGE.
  *
@@ -77,7 +74,6 @@ class MESSAGE;
  * \return The class identification.
  */
       virtual int classId() const;
-#endif
 
 /*! \brief The output operator 
  * writes the branching variable together with its
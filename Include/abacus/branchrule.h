@@ -53,12 +53,10 @@ class ABA_MASTER;
 class ABA_SUB;
 class ABA_LPSUB;
 
-#ifdef ABACUS_PARALLEL
 #define SETBRANCHRULE_CLASSID   9001            // preliminary
 #define VALBRANCHRULE_CLASSID   9002            // preliminary
 #define CONBRANCHRULE_CLASSID   9003            // preliminary
 #define BOUNDBRANCHRULE_CLASSID 9004            // preliminary
-#endif
 
   class  ABA_BRANCHRULE :  public ABA_ABACUSROOT  { 
     public: 
@@ -72,7 +70,6 @@ class ABA_LPSUB;
 /*! The destructor.
  */
       virtual ~ABA_BRANCHRULE();
-#ifdef ABACUS_PARALLEL
 
 /*!The message constructor creates the ABA_BRANCHRULE from an ABA_MESSAGE.
  *
@@ -91,7 +88,18 @@ class ABA_LPSUB;
  * \param msg The ABA_MESSAGE object in which the ABA_BRANCHRULE is packed.
  */
       virtual void pack(ABA_MESSAGE &msg) const;
+#ifdef ABACUS_PARALLEL
       virtual int classId() const = 0;
+#else
+
+/*! \return The identification of the class of the branching rule,
+ *   which is passed to ABA_MASTER::unpackBranchrule().
+ *
+ *   This function has to be redefined in derived classes whose objects
+ *   should be stored in a checkpoint. The default implementation
+ *   terminates the program.
+ */
+      virtual int classId() const;
 #endif
 
 /*! Modifies a subproblem by setting the branching variable.
@@ -45,10 +45,9 @@
 using namespace std;
 
 #include "abacus/global.h"
+#include "abacus/trivialcopy.h"
 
-#ifdef ABACUS_PARALLEL
 class ABA_MESSAGE;
-#endif
 
 #ifdef ABACUS_NEW_TEMPLATE_SYNTAX
 template<class Type>
@@ -76,21 +75,19 @@ ostream& operator<< (ostream& out, const ABA_BUFFER<Type> &buffer);
 
 //! The destructor.
       ~ABA_BUFFER();
-#ifdef ABACUS_PARALLEL
 
 /*! The message constructor creates the ABA_BUFFER from an ABA_MESSAGE.
  *
  *   \param glob A pointer to the corresponding global object.
  *   \param msg The message from which the object is initialized.
  */
-      ABA_BUFFER(const ABA_GLOBAL *glob, ABA_MESSAGE &msg);
+      ABA_BUFFER(ABA_GLOBAL *glob, ABA_MESSAGE &msg);
 
 /*! Packs the data of the buffer in an ABA_MESSAGE object.
  *
  * \param msg The ABA_MESSAGE object in which the buffer is packed.
  */
       void pack(ABA_MESSAGE &msg) const;
-#endif
 
 /*! The assignment operator is only allowed between buffers having equal size.
  *
@@ -212,6 +209,18 @@ ostream& operator<< (ostream& out, const ABA_BUFFER<Type> &buffer);
  */
       void realloc (int newSize);
 
+/*! \brief Enlarges the buffer such that at least \a newSize elements
+ * can be stored in it.
+ *
+ * If a reallocation is necessary, the size of the buffer is at least
+ * doubled. Hence, if a buffer is filled by successive calls of \a reserve()
+ * and \a push(), the number of reallocations is only logarithmic in the
+ * number of buffered elements. The buffer is never shortened.
+ *
+ * \param newSize The minimal size of the buffer.
+ */
+      void reserve(int newSize);
+
     private:
 
       /*! A pointer to the corresponding global object.
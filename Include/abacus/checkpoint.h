@@ -0,0 +1,213 @@
+/*!\file
+ * \author The ABACUS developers
+ * \brief checkpoints of the enumeration tree.
+ *
+ * If the parameter {\tt CheckpointInterval} is positive, then the state
+ * of the optimization is saved periodically in a checkpoint file, such
+ * that a long run can be continued after it has been interrupted or
+ * a resource limit has been exceeded. A checkpoint contains the
+ * statistics, bounds, and timers of the master, the default pools
+ * including the pools registered by ABA_MASTER::registerConPool(), and
+ * all open subproblems. The data is packed in an ABA_MESSAGE by the
+ * optimization and written by a background thread, which first writes
+ * a temporary file and renames it afterwards. Therefore, the checkpoint
+ * file is always complete, even if the program is killed while a
+ * checkpoint is written.
+ *
+ * If the parameter {\tt CheckpointRestart} is \a true, the open
+ * subproblems of the checkpoint become the sons of the root node, which
+ * is not optimized again.
+ *
+ * \par
+ * A file starts with the string ABA_CHECKPOINT::magic() followed by
+ * the integer \a 1 as a check of the byte order. Then the message
+ * follows as written by ABA_MESSAGE::write().
+ *
+ * \par
+ * Open subproblems are packed with ABA_SUB::pack(), the constraints
+ * and variables of the pools with ABA_CONVAR::pack(). Therefore, an
+ * application has to redefine ABA_MASTER::unpackSub() and, for its own
+ * constraints and variables, ABA_MASTER::unpackConVar().
+ * Locally valid cuts cannot be packed. If a pool contains such a cut,
+ * the checkpoint is skipped. A failure of the writer thread is reported
+ * by the next call of write() or flush().
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#ifndef ABA_CHECKPOINT_H
+#define ABA_CHECKPOINT_H
+
+#include "abacus/abacusroot.h"
+#include "abacus/string.h"
+
+#include <pthread.h>
+
+class ABA_MASTER;
+class ABA_MESSAGE;
+
+  class  ABA_CHECKPOINT :  public ABA_ABACUSROOT  {
+    public:
+
+/*! \return The string at the beginning of each checkpoint file.
+ */
+      static const char *magic();
+
+/*! \brief The constructor
+ *   starts the writer thread.
+ *
+ *   \param master A pointer to the corresponding master of the optimization.
+ *   \param fileName The name of the checkpoint file.
+ */
+      ABA_CHECKPOINT(ABA_MASTER *master, const char *fileName);
+
+/*! The destructor
+ *   waits for a pending checkpoint and stops the writer thread.
+ */
+      ~ABA_CHECKPOINT();
+
+/*! \brief Packs the current state of the optimization
+ *   and passes it to the writer thread.
+ *
+ *   If the writer thread is still busy with the previous checkpoint,
+ *   we have to wait.
+ *
+ *   \return true If the checkpoint has been packed,
+ *   \return false if it has been skipped since a pool
+ *                 contains a locally valid constraint or variable.
+ */
+      bool write();
+
+/*! \brief Restores the state of the optimization from the checkpoint file.
+ *
+ *   This function must be called after the root node has been constructed,
+ *   but before it is inserted in the set of open subproblems.
+ *
+ *   \return true If the optimization has been restored,
+ *   \return false if the checkpoint file cannot be read. In this case
+ *                 the optimization has not been modified.
+ */
+      bool restart();
+
+/*! Waits until a pending checkpoint is written to the file.
+ */
+      void flush();
+
+/*! \brief Starts the writer thread if it is not running.
+ */
+      void startWriter();
+
+/*! \brief Waits for a pending checkpoint and stops the writer thread.
+ *
+ *   Afterwards checkpoints are written synchronously until
+ *   \a startWriter() is called. This is required before the process
+ *   is forked (see ABA_MASTER::_startWorkers()).
+ */
+      void stopWriter();
+
+    private:
+
+/*! \return true If all constraints and variables of the default pools
+ *                   can be packed,
+ *   \return false otherwise.
+ */
+      bool packable() const;
+
+/*! \brief Writes the message \a write_ to the checkpoint file.
+ *
+ *   Since the function is called by the writer thread, it does not
+ *   output an error message.
+ *
+ *   \return true If writing the checkpoint failed,
+ *   \return false otherwise.
+ */
+      bool writeFile();
+
+/*! Outputs a warning if writing a checkpoint has failed since the
+ *   last call of this function.
+ */
+      void reportFailure();
+
+/*! The function of the writer thread.
+ *
+ *   \param checkpoint A pointer to the ABA_CHECKPOINT.
+ */
+      static void *writer(void *checkpoint);
+
+/*! A pointer to the corresponding master of the optimization.
+ */
+      ABA_MASTER *master_;
+
+/*! The name of the checkpoint file.
+ */
+      ABA_STRING fileName_;
+
+/*! The message filled by the optimization.
+ */
+      ABA_MESSAGE *fill_;
+
+/*! The message written by the writer thread.
+ */
+      ABA_MESSAGE *write_;
+
+/*! \a true if \a write_ still has to be written.
+ *
+ *   If \a pending_ is \a false, then the writer thread is idle.
+ */
+      bool pending_;
+
+/*! \a true if the writer thread should terminate.
+ */
+      bool done_;
+
+/*! \a true if the writer thread could be started.
+ */
+      bool running_;
+
+/*! \a true if writing a checkpoint has failed and this has not been
+ *   reported yet.
+ */
+      bool failed_;
+
+      pthread_t       thread_;
+      pthread_mutex_t mutex_;
+      pthread_cond_t  cond_;
+
+      ABA_CHECKPOINT(const ABA_CHECKPOINT &rhs);
+      const ABA_CHECKPOINT &operator=(const ABA_CHECKPOINT &rhs);
+  };
+
+inline const char *ABA_CHECKPOINT::magic()
+  {
+    return "ABACKP04";
+  }
+
+#endif  // ABA_CHECKPOINT_H
+
+/*! \class ABA_CHECKPOINT
+ *  \brief checkpoints of the enumeration tree
+ */
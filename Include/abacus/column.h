@@ -87,7 +87,6 @@
                  double ub, 
                  ABA_SPARVEC &vec);
       ~ABA_COLUMN();
-#ifdef ABACUS_PARALLEL
 
 /*! The message constructor creates the column from an ABA_MESSAGE.
  *
@@ -101,7 +100,6 @@
  *\param msg The ABA_MESSAGE object in which the column is packed.
  */
       void pack(ABA_MESSAGE &msg) const;
-#endif
 
 /*!The output operator.
  *
@@ -100,7 +100,6 @@ class ABA_SPARVEC;
 /*! The destructor.
  */
       virtual ~ABA_COLVAR();
-#ifdef ABACUS_PARALLEL
 
 /*! The message constructor creates the variable from an ABA_MESSAGE.
  *
@@ -119,7 +118,6 @@ class ABA_SPARVEC;
  *\return The class identification.
  */
       virtual int classId() const;
-#endif
 
 /*!The output operator writes the column representing the variable to an output stream.
  *
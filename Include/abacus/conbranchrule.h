@@ -39,9 +39,7 @@
 #include "abacus/constraint.h"
 #include "abacus/variable.h"
 
-#ifdef ABACUS_PARALLEL
 class ABA_MESSAGE;
-#endif
 
   class  ABA_CONBRANCHRULE :  public ABA_BRANCHRULE  { 
     public: 
@@ -62,11 +60,13 @@ class ABA_MESSAGE;
 /*! The destructor.
  */
       virtual ~ABA_CONBRANCHRULE();
-#ifdef ABACUS_PARALLEL
 
 /*! The message constructor 
  * creates the ABA_CONBRANCHRULE from an ABA_MESSAGE.
  *
+ * In the sequential version the branching constraint must be available
+ * in the default pool of the master at the slot stored by \a pack().
+ *
  *  \param master A pointer to the corresponding master of the optimization.
  *  \param msg The message from which the object is initialized.
  */
@@ -86,7 +86,6 @@ class ABA_MESSAGE;
  * \return The class identification.
  */
       virtual int classId() const;
-#endif
 
 /*! The output operator writes the branching constraint on an output stream.
  *
@@ -41,9 +41,7 @@ using namespace std;
 
 class ABA_MASTER;
 
-#ifdef ABACUS_PARALLEL
 class ABA_MESSAGE;
-#endif
 
   class  ABA_CONCLASS :  public ABA_ABACUSROOT  { 
     public: 
@@ -58,21 +56,19 @@ class ABA_MESSAGE;
  */
       ABA_CONCLASS(const ABA_MASTER *master, bool discrete, bool allVarBinary,
                    bool trivial, bool bound, bool varBound);
-#ifdef ABACUS_PARALLEL
 
 /*! \brief The message constructor creates the ABA_CONCLASS object from an ABA_MESSAGE.
  *
  *  \param master A pointer to the corresponding master of the optimization.
  *  \param msg The message from which the object is initialized.
  */
-      ABA_CONCLASS (const ABA_MASTER *master, ABA_MESSAGE &msg);
+      ABA_CONCLASS (ABA_MASTER *master, ABA_MESSAGE &msg);
 
 /*! Packs the data of the ABA_CONCLASS in an ABA_MESSAGE object.
  *
  *\param msg The ABA_MESSAGE object in which the ABA_CONCLASS is packed.
  */
       void pack(ABA_MESSAGE &msg) const;
-#endif
 
       friend ostream &operator<<(ostream &out, const ABA_CONCLASS &rhs);
 
@@ -0,0 +1,129 @@
+/*!\file
+ * \author The ABACUS developers
+ * \brief conflict constraint.
+ *
+ * A conflict constraint is derived by ABA_SUB::conflictAnalysis() from
+ * the infeasible linear program of a subproblem. It states that the
+ * binary variables \f$x_j\f$, \f$j \in C\f$, cannot take the values
+ * \f$v_j\f$ of their local bounds at the same time, i.e.,
+ * \f[ \sum_{j \in C, v_j = 0} x_j + \sum_{j \in C, v_j = 1} (1 - x_j) \ge 1. \f]
+ * The constraint is globally valid and refers to the variables by their
+ * slots in the default pool of variables.
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#ifndef ABA_CONFLICTCON_H
+#define ABA_CONFLICTCON_H
+
+#include "abacus/constraint.h"
+#include "abacus/array.h"
+#include "abacus/poolslotref.h"
+
+class ABA_VARIABLE;
+
+  class  ABA_CONFLICTCON :  public ABA_CONSTRAINT  {
+    public:
+
+/*! The constructor.
+ *
+ *   \param master A pointer to the corresponding master of the optimization.
+ *   \param nnz The number of variables of the conflict.
+ *   \param slot The pool slots of the variables of the conflict.
+ *   \param value The value of each variable in the conflict, which
+ *                    must be 0 or 1.
+ */
+      ABA_CONFLICTCON(ABA_MASTER *master,
+                      int nnz,
+                      const ABA_ARRAY<ABA_POOLSLOT<ABA_VARIABLE, ABA_CONSTRAINT>*> &slot,
+                      const ABA_ARRAY<double> &value);
+
+//! The destructor.
+      virtual ~ABA_CONFLICTCON();
+
+/*! \brief The message constructor
+ *   creates the constraint from an ABA_MESSAGE.
+ *
+ *   The variables are identified by the indices of their slots in the
+ *   default pool of variables.
+ *
+ *   \param msg The ABA_MESSAGE object from which the constraint is initialized.
+ */
+      ABA_CONFLICTCON(ABA_MASTER *master, ABA_MESSAGE &msg);
+
+/*! Packs the data of the constraint in an ABA_MESSAGE object.
+ *
+ *   \param msg The ABA_MESSAGE object in which the constraint is packed.
+ */
+      virtual void pack(ABA_MESSAGE &msg) const;
+
+/*! Returns an integer which identifies the class.
+ *
+ *   \return The class identification.
+ */
+      virtual int classId() const;
+
+/*! \return Always \a true, since the coefficients are stored explicitly.
+ */
+      virtual bool explicitRow() const;
+
+/*! \brief Computes the coefficient of a variable.
+ *
+ *   It redefines the virtual function \a coeff() of the base class ABA_CONSTRAINT.
+ *
+ *   \return The coefficient of the variable \a v, i.e., 1 or -1 if
+ *           \a v is contained in the conflict, 0 otherwise.
+ *
+ *   \param v The variable of which the coefficient is determined.
+ */
+      virtual double coeff(ABA_VARIABLE *v);
+
+/*! Writes the conflict constraint on an output stream.
+ *
+ *   \param out The output stream.
+ */
+      virtual void print(ostream &out);
+
+    private:
+
+/*! The references to the pool slots of the variables of the conflict.
+ */
+      ABA_ARRAY<ABA_POOLSLOTREF<ABA_VARIABLE, ABA_CONSTRAINT>*> var_;
+
+/*! The coefficients of the variables of the conflict.
+ */
+      ABA_ARRAY<double> coeff_;
+
+      ABA_CONFLICTCON(const ABA_CONFLICTCON &rhs);
+      const ABA_CONFLICTCON &operator=(const ABA_CONFLICTCON &rhs);
+  };
+
+#endif  // ABA_CONFLICTCON_H
+
+/*! \class ABA_CONFLICTCON
+ *  \brief conflict constraint
+ */
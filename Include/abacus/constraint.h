@@ -49,9 +49,7 @@ class ABA_LPSUB;
 
 template<class BaseType, class CoType> class ABA_ACTIVE;
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
 class  ABA_CONSTRAINT :  public ABA_CONVAR  {
   friend class ABA_LPSUB;
   public:
@@ -101,13 +99,12 @@ class  ABA_CONSTRAINT :  public ABA_CONVAR  {
 /*! The destructor.
  */
     virtual ~ABA_CONSTRAINT();
-#ifdef ABACUS_PARALLEL
 
 /*! The message constructor creates the constraint from an ABA_MESSAGE.
  *
  *\param msg The ABA_MESSAGE object from which the constraint is initialized.
  */
-    ABA_CONSTRAINT(const ABA_MASTER *master, ABA_MESSAGE &msg);
+    ABA_CONSTRAINT(ABA_MASTER *master, ABA_MESSAGE &msg);
 
 /*! Packs the data of the constraint in an ABA_MESSAGE object. 
  *
@@ -119,7 +116,6 @@ class  ABA_CONSTRAINT :  public ABA_CONVAR  {
  * \param msg The ABA_MESSAGE object in which the constraint is packed.
  */
     virtual void pack(ABA_MESSAGE &msg) const;
-#endif
 
 /*! \return A pointer to the sense of the constraint.
  */
@@ -146,6 +142,18 @@ class  ABA_CONSTRAINT :  public ABA_CONVAR  {
  * \return false otherwise.
  */
     bool liftable() const;
+
+/*! Checks if the constraint is given by an explicit row.
+ *
+ * The bound propagation of the subproblems (see ABA_SUB::_propagate())
+ * only takes into account constraints given by an explicit row, since
+ * their row format can be generated without problem specific knowledge.
+ * The default implementation returns \a false.
+ *
+ * \return true If the constraint is given by an explicit row,
+ * \return false otherwise.
+ */
+    virtual bool explicitRow() const;
   
 /*! Checks if the constraint is valid for the subproblem sub. 
  *
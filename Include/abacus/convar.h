@@ -66,6 +66,7 @@ template<class BaseType, class CoType> class ABA_CUTBUFFER;
 
 #ifdef ABACUS_PARALLEL
 #include "abacus/id.h"
+#endif
 
 class ABA_MESSAGE;
 
@@ -74,7 +75,7 @@ class ABA_MESSAGE;
 #define SROWCON_CLASSID 8003            // preliminary
 #define NUMVAR_CLASSID  8004            // preliminary
 #define COLVAR_CLASSID  8005            // preliminary
-#endif
+#define CONFLICTCON_CLASSID 8006        // preliminary
 
 class  ABA_CONVAR : public ABA_ABACUSROOT  {
   friend class ABA_POOLSLOT<ABA_CONSTRAINT, ABA_VARIABLE>;
@@ -86,6 +87,7 @@ class  ABA_CONVAR : public ABA_ABACUSROOT  {
   friend class ABA_CUTBUFFER<ABA_CONSTRAINT, ABA_VARIABLE>;
   friend class ABA_CUTBUFFER<ABA_VARIABLE, ABA_CONSTRAINT>;
   friend class ABA_SUB;
+  friend class ABA_MASTER;
   public:
 
 /*! The constructor.
@@ -105,7 +107,6 @@ class  ABA_CONVAR : public ABA_ABACUSROOT  {
 /*! The destructor.
  */
     virtual ~ABA_CONVAR();
-#ifdef ABACUS_PARALLEL
 
 /*! The message constructor creates the constraint/variable from an ABA_MESSAGE.
  *
@@ -136,7 +137,18 @@ class  ABA_CONVAR : public ABA_ABACUSROOT  {
  *                  is packed.
  */
     virtual void pack(ABA_MESSAGE &msg) const;
+#ifdef ABACUS_PARALLEL
     virtual int classId() const = 0;
+#else
+
+/*! \return The identification of the class of the constraint/variable,
+ *   which is passed to ABA_MASTER::unpackConVar().
+ *
+ *   This function has to be redefined in derived classes whose objects
+ *   should be stored in a checkpoint. The default implementation
+ *   terminates the program.
+ */
+    virtual int classId() const;
 #endif
 
 /*! Checks if the constraint/variable is active in at least one active subproblem. 
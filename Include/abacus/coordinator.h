@@ -0,0 +1,233 @@
+/*!\file
+ * \author The ABACUS developers
+ * \brief coordinator of a distributed optimization.
+ *
+ * If the parameter {\tt Workers} is positive, the enumeration tree is
+ * processed sequentially until there are {\tt WorkerRampUp} open
+ * subproblems per worker. Then {\tt Workers} processes are forked, each
+ * of which continues with its share of the open subproblems, while the
+ * original process becomes the coordinator of these workers (see
+ * ABA_MASTER::_startWorkers()). The workers are connected to the
+ * coordinator by local stream sockets, over which messages are exchanged
+ * with ABA_MESSAGE::send() and ABA_MESSAGE::receive().
+ *
+ * \par
+ * The coordinator
+ * <ul>
+ * <li> passes new primal bounds and new globally valid cuts of a
+ *      worker to all other workers,
+ * <li> balances the load: if a worker runs out of open subproblems, the
+ *      worker with the most open subproblems is asked to send half of them,
+ * <li> computes the global dual bound from the dual bounds reported by the
+ *      workers and stops all workers if the required guarantee is reached,
+ *      a worker exceeds a resource limit, or all workers are idle,
+ * <li> accumulates the statistics of the workers and takes the problem
+ *      specific data (see ABA_MASTER::packCheckpoint()) from the worker
+ *      which has found the best feasible solution.
+ * </ul>
+ *
+ * \par
+ * Open subproblems are sent with ABA_SUB::pack(), the cuts of the cut
+ * pool by value with ABA_CONVAR::pack(). Therefore, an application has to
+ * redefine ABA_MASTER::unpackSub() and, for its own constraints,
+ * ABA_MASTER::unpackConVar(). Since the constraint pool and the variables
+ * must be identical in all processes, no variables may be generated,
+ * and locally valid cuts cannot be sent.
+ *
+ * \par
+ * The protocol only requires a connected stream socket per worker.
+ * Hence, workers could also be connected via TCP, but only the start of
+ * local workers by \a fork() is implemented.
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#ifndef ABA_COORDINATOR_H
+#define ABA_COORDINATOR_H
+
+#include "abacus/abacusroot.h"
+#include "abacus/array.h"
+#include "abacus/master.h"
+
+class ABA_MESSAGE;
+
+  class  ABA_COORDINATOR :  public ABA_ABACUSROOT  {
+    public:
+
+/*! \brief The tags of the messages between the coordinator and the workers.
+ *
+ *   Each message starts with its tag.
+ *
+ *   \param StatusTag Worker: the number of open subproblems and their
+ *                    dual bound.
+ *   \param IncumbentTag Both: a new primal bound.
+ *   \param CutsTag Both: new globally valid cuts of the cut pool.
+ *   \param IdleTag Worker: no open subproblems are left.
+ *   \param DonateTag Coordinator: send at most the given number of open
+ *                    subproblems.
+ *   \param SubsTag Both: open subproblems and their dual bound.
+ *   \param StopTag Coordinator: stop the optimization.
+ *   \param DoneTag Worker: the status, the statistics, and possibly the
+ *                  problem specific data of a terminated worker.
+ */
+      enum TAG {StatusTag, IncumbentTag, CutsTag, IdleTag, DonateTag,
+                SubsTag, StopTag, DoneTag};
+
+/*! \brief The constructor.
+ *
+ *   \param master A pointer to the corresponding master of the optimization.
+ *   \param fd The connected sockets of the workers.
+ *   \param pid The process ids of the workers.
+ *   \param base The statistics of the master when the workers were started
+ *               (see ABA_MASTER::_packStatistics()).
+ */
+      ABA_COORDINATOR(ABA_MASTER *master, const ABA_ARRAY<int> &fd,
+                      const ABA_ARRAY<int> &pid, const ABA_MESSAGE &base);
+
+/*! The destructor closes the connections.
+ */
+      ~ABA_COORDINATOR();
+
+/*! \brief Coordinates the workers until all of them have terminated.
+ *
+ *   \return The status of the distributed optimization.
+ */
+      ABA_MASTER::STATUS run();
+
+    private:
+
+/*! Processes the message \a in_ received from worker \a w.
+ */
+      void handle(int w);
+
+/*! Asks busy workers for open subproblems for the idle workers.
+ */
+      void balance();
+
+/*! Checks if the optimization can be stopped.
+ */
+      void checkTermination();
+
+/*! Sends a stop message to all workers which have not terminated yet.
+ */
+      void stopAll(ABA_MASTER::STATUS status);
+
+/*! \brief Appends the message \a msg to the output queue of worker \a w.
+ *
+ *   The queue is sent without blocking in \a run(). Otherwise, the
+ *   coordinator and a worker could block each other if both send
+ *   large messages at the same time.
+ */
+      void post(int w, const ABA_MESSAGE &msg);
+
+/*! Sends as much of the output queue of worker \a w as possible without blocking.
+ */
+      void flush(int w);
+
+/*! Kills all workers and terminates the program after worker \a w has failed.
+ */
+      void abort(int w);
+
+/*! A pointer to the corresponding master of the optimization.
+ */
+      ABA_MASTER *master_;
+
+/*! The number of workers.
+ */
+      int nWorkers_;
+
+/*! The sockets of the workers.
+ */
+      ABA_ARRAY<int> fd_;
+
+/*! The process ids of the workers.
+ */
+      ABA_ARRAY<int> pid_;
+
+/*! The number of open subproblems of each worker.
+ */
+      ABA_ARRAY<int> nOpen_;
+
+/*! The dual bound of the open subproblems of each worker.
+ */
+      ABA_ARRAY<double> dualBound_;
+
+/*! \a true if the worker has no open subproblems.
+ */
+      ABA_ARRAY<bool> idle_;
+
+/*! \a true if the worker has been asked to donate subproblems and
+ *   has not answered yet.
+ */
+      ABA_ARRAY<bool> asked_;
+
+/*! The worker asked for subproblems for an idle worker, or -1.
+ */
+      ABA_ARRAY<int> donor_;
+
+/*! \a true if the worker has terminated.
+ */
+      ABA_ARRAY<bool> done_;
+
+/*! The messages which still have to be sent to each worker.
+ */
+      ABA_ARRAY<ABA_MESSAGE*> queue_;
+
+/*! The number of bytes of \a queue_ which have been sent already.
+ */
+      ABA_ARRAY<long> sent_;
+
+/*! The statistics of the master when the workers were started.
+ */
+      ABA_MESSAGE *base_;
+
+/*! The last received message.
+ */
+      ABA_MESSAGE *in_;
+
+/*! The worker which has found the best primal bound, or -1 if it has
+ *   been found before the workers were started.
+ */
+      int bestWorker_;
+
+/*! \a true if the workers have been asked to stop.
+ */
+      bool stopping_;
+
+/*! The status of the distributed optimization.
+ */
+      ABA_MASTER::STATUS status_;
+
+      ABA_COORDINATOR(const ABA_COORDINATOR &rhs);
+      const ABA_COORDINATOR &operator=(const ABA_COORDINATOR &rhs);
+  };
+
+#endif  // ABA_COORDINATOR_H
+
+/*! \class ABA_COORDINATOR
+ *  \brief coordinator of a distributed optimization
+ */
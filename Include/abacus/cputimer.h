@@ -74,6 +74,13 @@
  *   \a times which is common on \UNIX/ systems, although not defined
  *   in the \CEE/-ANSI-standard.
  *
+ * \par
+ *   If the system provides a cpu clock per thread, the cpu time of the
+ *   calling thread is returned instead. Hence, the threads racing the
+ *   simplex methods and the heuristic threads do not contribute to the
+ *   timers of the branch-and-cut algorithm, which must be started and
+ *   stopped by the same thread.
+ *
 */
       virtual long theTime() const;
   };
@@ -44,9 +44,7 @@ using namespace std;
 
 class ABA_GLOBAL;
 
-#ifdef ABACUS_PARALLEL
 class ABA_MESSAGE;
-#endif
   class  ABA_CSENSE : public ABA_ABACUSROOT  { 
     public: 
 
@@ -79,7 +77,6 @@ class ABA_MESSAGE;
  *               {\tt L} or {\tt l} stand for \a Less.
  */
       ABA_CSENSE(ABA_GLOBAL *glob, char s);
-#ifdef ABACUS_PARALLEL
 
 /*! The message constructor creates the ABA_CSENSE from an ABA_MESSAGE.
  *
@@ -92,7 +89,6 @@ class ABA_MESSAGE;
  *  \param msg The ABA_MESSAGE object in which the sense is packed.
  */
       void pack(ABA_MESSAGE &msg) const;
-#endif
 
 /*! \brief The output operator 
  * writes the sense on an output stream in the form \a <=, \a =, or \a >=.
@@ -0,0 +1,162 @@
+/*!\file
+ * \author The ABACUS developers
+ * \brief information shared by the diving heuristics.
+ *
+ * The diving heuristics of all subproblems (see ABA_DIVER) share the
+ * pseudocosts of the variables, i.e., the average change of the value of
+ * the linear program per unit change of a variable when it is rounded down
+ * or up, and the values of the variables in the best feasible solution
+ * found by a linear program. The variables are identified by the indices
+ * of their slots in the default pool of variables.
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#ifndef ABA_DIVEINFO_H
+#define ABA_DIVEINFO_H
+
+#include "abacus/abacusroot.h"
+#include "abacus/array.h"
+
+class ABA_MASTER;
+
+  class  ABA_DIVEINFO :  public ABA_ABACUSROOT  {
+    public:
+
+/*! \brief The constructor.
+ *
+ *   \param master A pointer to the corresponding master of the optimization.
+ */
+      ABA_DIVEINFO(ABA_MASTER *master);
+
+//! The destructor.
+      ~ABA_DIVEINFO();
+
+/*! \brief Adds an observation to the pseudocost of a variable.
+ *
+ *   \param index The index of the slot of the variable.
+ *   \param up If \a true, the variable has been rounded up, otherwise down.
+ *   \param gain The change of the value of the linear program per unit
+ *                   change of the variable.
+ */
+      void pseudoCost(int index, bool up, double gain);
+
+/*! \return The pseudocost of a variable. If the variable has not been
+ *           rounded in this direction yet, the average pseudocost of all
+ *           variables is returned, or 1 if there is no observation at all.
+ *
+ *   \param index The index of the slot of the variable.
+ *   \param up If \a true, the pseudocost for rounding up is returned,
+ *                 otherwise the one for rounding down.
+ */
+      double pseudoCost(int index, bool up) const;
+
+/*! Removes the values of the variables of the previous best solution.
+ */
+      void clearIncumbent();
+
+/*! \brief Stores the value of a variable in the best feasible solution.
+ *
+ *   \param index The index of the slot of the variable.
+ *   \param x The value of the variable.
+ */
+      void incumbent(int index, double x);
+
+/*! \return true If the value of the variable in the best feasible solution
+ *                is known,
+ *   \return false otherwise.
+ *
+ *   \param index The index of the slot of the variable.
+ *   \param x Holds the value of the variable if the return value is \a true.
+ */
+      bool incumbent(int index, double &x) const;
+
+/*! \return true If a feasible solution has been stored,
+ *   \return false otherwise.
+ */
+      bool hasIncumbent() const;
+
+    private:
+
+/*! Enlarges the arrays such that the slot \a index can be stored.
+ */
+      void realloc(int index);
+
+/*! A pointer to the corresponding master of the optimization.
+ */
+      ABA_MASTER *master_;
+
+/*! The sum of the observed pseudocosts of each variable for rounding down.
+ */
+      ABA_ARRAY<double> downSum_;
+
+/*! The sum of the observed pseudocosts of each variable for rounding up.
+ */
+      ABA_ARRAY<double> upSum_;
+
+/*! The number of observations of each variable for rounding down.
+ */
+      ABA_ARRAY<int> downNum_;
+
+/*! The number of observations of each variable for rounding up.
+ */
+      ABA_ARRAY<int> upNum_;
+
+/*! The sum of all observed pseudocosts for rounding down and up.
+ */
+      double totalSum_[2];
+
+/*! The number of all observations for rounding down and up.
+ */
+      int totalNum_[2];
+
+/*! The value of each variable in the best feasible solution.
+ */
+      ABA_ARRAY<double> incumbent_;
+
+/*! \a true if the value of the variable in \a incumbent_ is known.
+ */
+      ABA_ARRAY<bool> known_;
+
+/*! \a true if a feasible solution has been stored.
+ */
+      bool hasIncumbent_;
+
+      ABA_DIVEINFO(const ABA_DIVEINFO &rhs);
+      const ABA_DIVEINFO &operator=(const ABA_DIVEINFO &rhs);
+  };
+
+inline bool ABA_DIVEINFO::hasIncumbent() const
+  {
+    return hasIncumbent_;
+  }
+
+#endif  // ABA_DIVEINFO_H
+
+/*! \class ABA_DIVEINFO
+ *  \brief information shared by the diving heuristics
+ */
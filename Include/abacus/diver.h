@@ -0,0 +1,174 @@
+/*!\file
+ * \author The ABACUS developers
+ * \brief diving heuristics of a subproblem.
+ *
+ * A diver repeatedly rounds a fractional discrete variable of the
+ * solution of the linear program of the subproblem by changing one of its
+ * bounds, and solves the linear program again with the dual simplex
+ * method, until the solution is integral or the linear program is
+ * infeasible. If the linear program becomes infeasible, the last rounding
+ * is reversed once. The diving heuristics differ in the selection of the
+ * rounded variable and the direction of the rounding.
+ *
+ * \par
+ * The dive is performed in the linear program of the subproblem. Afterwards
+ * the bounds and the basis of the subproblem are restored and the linear
+ * program is solved again, such that no subproblems are generated.
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#ifndef ABA_DIVER_H
+#define ABA_DIVER_H
+
+#include "abacus/abacusroot.h"
+#include "abacus/array.h"
+#include "abacus/buffer.h"
+#include "abacus/master.h"
+
+class ABA_SUB;
+
+  class  ABA_DIVER :  public ABA_ABACUSROOT  {
+    public:
+
+/*! \brief The constructor.
+ *
+ *   \param master A pointer to the corresponding master of the optimization.
+ *   \param sub The subproblem whose linear program is used for the dive.
+ *              Its linear program must have been solved to optimality.
+ */
+      ABA_DIVER(ABA_MASTER *master, ABA_SUB *sub);
+
+//! The destructor.
+      ~ABA_DIVER();
+
+/*! \brief Performs a dive.
+ *
+ *   \return 1 If a feasible solution has been found,
+ *   \return 0 otherwise.
+ *
+ *   \param strat The diving heuristic.
+ *   \param primalValue Holds the value of the feasible solution if
+ *                      the return value is 1.
+ */
+      int dive(ABA_MASTER::DIVINGSTRAT strat, double &primalValue);
+
+    private:
+
+/*! \brief Selects the variable which is rounded next.
+ *
+ *   \return 0 If a fractional variable has been selected,
+ *   \return 1 if the solution of the linear program is integral.
+ *
+ *   \param strat The diving heuristic.
+ *   \param j Holds the selected variable.
+ *   \param up Is \a true if the variable should be rounded up, and
+ *             \a false if it should be rounded down.
+ */
+      int select(ABA_MASTER::DIVINGSTRAT strat, int &j, bool &up);
+
+/*! \brief Counts for each variable the rows of the linear program that
+ *   might be violated if the variable is rounded down or up.
+ */
+      void locks();
+
+/*! Rounds variable \a j down or up by changing its bound.
+ */
+      void round(int j, bool up);
+
+/*! \brief Solves the linear program with the dual simplex method.
+ *
+ *   \return 0 If the linear program has been solved to optimality,
+ *   \return 1 if it is infeasible or its value exceeds the primal bound.
+ */
+      int solve();
+
+/*! \brief Checks if the integral solution of the linear program is
+ *   feasible with ABA_SUB::feasible().
+ *
+ *   \return 1 If the solution is feasible,
+ *   \return 0 otherwise.
+ */
+      int check();
+
+/*! Restores the bounds and the basis of the linear program of the subproblem.
+ */
+      void restore();
+
+/*! \return The index of the slot of variable \a j in its pool.
+ */
+      int index(int j) const;
+
+/*! A pointer to the corresponding master of the optimization.
+ */
+      ABA_MASTER *master_;
+
+/*! The subproblem whose linear program is used for the dive.
+ */
+      ABA_SUB *sub_;
+
+/*! The lower bounds of the variables during the dive.
+ */
+      ABA_ARRAY<double> lBound_;
+
+/*! The upper bounds of the variables during the dive.
+ */
+      ABA_ARRAY<double> uBound_;
+
+/*! The solution of the last linear program.
+ */
+      ABA_ARRAY<double> x_;
+
+/*! The value of the last linear program.
+ */
+      double value_;
+
+/*! The variables whose bounds have been changed.
+ */
+      ABA_BUFFER<int> changed_;
+
+/*! \a true if the bounds of the variable have been changed.
+ */
+      ABA_ARRAY<bool> isChanged_;
+
+/*! The number of rows that might be violated if a variable is rounded down.
+ */
+      ABA_ARRAY<int> downLock_;
+
+/*! The number of rows that might be violated if a variable is rounded up.
+ */
+      ABA_ARRAY<int> upLock_;
+
+      ABA_DIVER(const ABA_DIVER &rhs);
+      const ABA_DIVER &operator=(const ABA_DIVER &rhs);
+  };
+
+#endif  // ABA_DIVER_H
+
+/*! \class ABA_DIVER
+ *  \brief diving heuristics of a subproblem
+ */
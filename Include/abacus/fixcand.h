@@ -80,6 +80,9 @@ template<class BaseType, class CoType> class ABA_POOLSLOTREF;
       void saveCandidates(ABA_SUB *sub);
 
 /*! Tries to fix as many candidates as possible.
+ *   The global bounds of the candidates which cannot be fixed are
+ *   tightened according to the reduced cost criterion (see
+ *   ABA_SUB::tightenByRedCost()).
  *
  *   The new variable status is both stored in the global variable status
  *   of the class ABA_MASTER and in the local variable status of ABA_SUB.
@@ -99,6 +102,14 @@ template<class BaseType, class CoType> class ABA_POOLSLOTREF;
  */
       void fixByRedCost(ABA_CUTBUFFER<ABA_VARIABLE, ABA_CONSTRAINT> *addVarBuffer);
 
+/*! \brief Tightens the global bound opposite to the bound the candidate
+ *   \a i is at.
+ *
+ *   \return true If the bound has been tightened,
+ *   \return false otherwise.
+ */
+      bool tighten(int i);
+
 /*! Deletes all allocated memory of members.
  *
  *  The member pointers are set to 0 that multiple deletion cannot
@@ -125,6 +136,18 @@ template<class BaseType, class CoType> class ABA_POOLSLOTREF;
       /*! The left hand side of the expression evaluated for fixing.
        */
       ABA_BUFFER<double>           *lhs_;
+
+      /*! The absolute values of the reduced costs of the candidates.
+       */
+      ABA_BUFFER<double>           *reco_;
+
+      /*! The bound the candidates are at.
+       */
+      ABA_BUFFER<double>           *bound_;
+
+      /*! The value of the linear program when the candidates were saved.
+       */
+      double                        value_;
       ABA_FIXCAND(const ABA_FIXCAND &rhs);
       const ABA_FIXCAND &operator=(const ABA_FIXCAND &rhs);
   };
@@ -42,9 +42,7 @@ using namespace std;
 
 class ABA_GLOBAL;
 
-#ifdef ABACUS_PARALLEL
 class ABA_MESSAGE;
-#endif
 
   class  ABA_FSVARSTAT :  public ABA_ABACUSROOT  { 
     public: 
@@ -97,21 +95,19 @@ class ABA_MESSAGE;
  *   \param fsVarStat The status is initialized with a copy of \a *fsVarStat.
  */
       ABA_FSVARSTAT(ABA_FSVARSTAT *fsVarStat);
-#ifdef ABACUS_PARALLEL
 
 /*! The message constructor creates the status from an |ABA_MESSAGE.
  *
  *     \param glob A pointer to a global object.
  *     \param msg The message from which the object is initialized.
  */
-      ABA_FSVARSTAT(const ABA_GLOBAL *glob, ABA_MESSAGE &msg);
+      ABA_FSVARSTAT(ABA_GLOBAL *glob, ABA_MESSAGE &msg);
 
 /*! The function \a pack() packs the data of the status in an ABA_MESSAGE.
  *
  *   \param msg The ABA_MESSAGE object in which the status is packed.
  */
       void pack(ABA_MESSAGE &msg) const;
-#endif
 
 /*! \brief The output operator writes the status and, if the status is
  *  \a Fixed or \a Set, also its value on an output stream.
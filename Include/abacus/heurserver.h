@@ -0,0 +1,183 @@
+/*!\file
+ * \author The ABACUS developers
+ * \brief asynchronous primal heuristics.
+ *
+ * The cutting plane algorithm of a subproblem posts copies of the solutions
+ * of its linear programs to a queue of bounded length. Heuristic threads
+ * take the solutions from the queue and apply the function
+ * ABA_MASTER::asyncImprove() to them. If the queue is full, the oldest
+ * solution is discarded, hence the optimization never waits for the
+ * heuristics.
+ *
+ * \par
+ * The solutions are generated and deleted only by the optimization,
+ * because the reference counters of the pool slots of the active variables
+ * are not protected by a mutex. The heuristic threads only read them.
+ * The best value found by the heuristic threads is collected by the
+ * optimization with the function \a harvest(), such that the primal bound
+ * is only updated by the optimization.
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#ifndef ABA_HEURSERVER_H
+#define ABA_HEURSERVER_H
+
+#include "abacus/abacusroot.h"
+#include "abacus/array.h"
+#include "abacus/buffer.h"
+
+#include <pthread.h>
+
+class ABA_MASTER;
+class ABA_SUB;
+class ABA_VARIABLE;
+class ABA_CONSTRAINT;
+
+template<class BaseType, class CoType> class ABA_LPSOLUTION;
+
+  class  ABA_HEURSERVER :  public ABA_ABACUSROOT  {
+    public:
+
+/*! \brief The constructor
+ *   starts the heuristic threads.
+ *
+ *   \param master A pointer to the corresponding master of the optimization.
+ *   \param nThreads The number of heuristic threads.
+ *   \param queueSize The maximal number of solutions waiting in the queue.
+ *                    At least one solution is stored.
+ */
+      ABA_HEURSERVER(ABA_MASTER *master, int nThreads, int queueSize);
+
+/*! The destructor
+ *   stops the heuristic threads and deletes all solutions.
+ */
+      ~ABA_HEURSERVER();
+
+/*! \brief Waits until the heuristic threads have finished the solutions
+ *   they are working on and stops them.
+ *
+ *   The waiting solutions are discarded. The best value found can still
+ *   be collected with \a harvest(). Afterwards, solutions passed to
+ *   \a post() are processed synchronously.
+ */
+      void stop();
+
+/*! \brief Posts the solution of the last linear program of a subproblem.
+ *
+ *   If no heuristic thread could be started, the function
+ *   ABA_MASTER::asyncImprove() is applied immediately.
+ *
+ *   \param sub The subproblem.
+ */
+      void post(ABA_SUB *sub);
+
+/*! \brief Collects the best value found by the heuristic threads since
+ *   the last call and deletes the processed solutions.
+ *
+ *   \return 1 If a feasible solution has been found,
+ *   \return 0 otherwise.
+ *
+ *   \param primalValue Holds the value of the best feasible solution if
+ *                      the return value is 1.
+ */
+      int harvest(double &primalValue);
+
+    private:
+
+/*! \brief Stores the value of a feasible solution if it is better than
+ *   the best one stored since the last \a harvest().
+ *
+ *   The mutex must be held.
+ */
+      void found(double primalValue);
+
+/*! \brief Deletes the solutions processed by the heuristic threads.
+ *
+ *   The mutex must be held.
+ */
+      void deleteProcessed();
+
+/*! The function of the heuristic threads.
+ *
+ *   \param heurServer A pointer to the ABA_HEURSERVER.
+ */
+      static void *heuristic(void *heurServer);
+
+/*! A pointer to the corresponding master of the optimization.
+ */
+      ABA_MASTER *master_;
+
+/*! The waiting solutions, a ring buffer starting at \a first_.
+ */
+      ABA_ARRAY<ABA_LPSOLUTION<ABA_VARIABLE, ABA_CONSTRAINT>*> queue_;
+
+/*! The position of the oldest waiting solution in \a queue_.
+ */
+      int first_;
+
+/*! The number of waiting solutions.
+ */
+      int nQueue_;
+
+/*! The solutions processed by the heuristic threads, which are deleted
+ *   by the next \a post() or \a harvest().
+ */
+      ABA_BUFFER<ABA_LPSOLUTION<ABA_VARIABLE, ABA_CONSTRAINT>*> processed_;
+
+/*! \a true if a feasible solution has been found since the last \a harvest().
+ */
+      bool found_;
+
+/*! The value of the best feasible solution found since the last \a harvest().
+ */
+      double primalValue_;
+
+/*! \a true if the heuristic threads should terminate.
+ */
+      bool done_;
+
+/*! The heuristic threads, of which the first \a nRunning_ could be started.
+ */
+      ABA_ARRAY<pthread_t> thread_;
+
+/*! The number of running heuristic threads.
+ */
+      int nRunning_;
+
+      pthread_mutex_t mutex_;
+      pthread_cond_t  cond_;
+
+      ABA_HEURSERVER(const ABA_HEURSERVER &rhs);
+      const ABA_HEURSERVER &operator=(const ABA_HEURSERVER &rhs);
+  };
+
+#endif  // ABA_HEURSERVER_H
+
+/*! \class ABA_HEURSERVER
+ *  \brief asynchronous primal heuristics
+ */
@@ -83,9 +83,12 @@ class ABA_COLUMN;
      *                  but not the optimal solution has been found.
      *  \param Infeasible The linear program is primal infeasible.
      *  \param Unbounded The linear program is unbounded.
+     *  \param LimitReached The dual simplex method has been stopped since
+     *                      the value of the linear program has reached the
+     *                      objective limit (see \a setObjectiveLimit()).
      */
       enum OPTSTAT{Optimal, Unoptimized, Error,
-                   Feasible, Infeasible, Unbounded};
+                   Feasible, Infeasible, Unbounded, LimitReached};
 
       /*! \brief This enumeration describes if parts of the solution like \f$x\f$-values,
        *  reduced costs, etc. are available.
@@ -103,8 +106,18 @@ class ABA_COLUMN;
        *                            a crossover to a basis.
        * \param BarrierNoCrossover The barrier method without crossover.
        * \param Approximate An approximative solver
+       * \param Race The primal and the dual simplex method solve copies
+       *             of the linear program concurrently, and the solution of
+       *             the first one finishing is used.
        */
-      enum METHOD {Primal, Dual, BarrierAndCrossover, BarrierNoCrossover, Approximate};
+      enum METHOD {Primal, Dual, BarrierAndCrossover, BarrierNoCrossover, Approximate,
+                   Race};
+
+      /*! \brief Literal values for the enumerators of the corresponding
+       *  enumeration type. The order of the enumerators is preserved.
+       *  (e.g., {\tt METHOD\_[0]=="Primal"})
+       */
+      static const char *METHOD_[];
 
 /*! The constructor.
  *
@@ -297,6 +310,15 @@ class ABA_COLUMN;
  */
       virtual void changeUBound(int i, double newUb);
 
+/*! Changes the bounds of several columns at once.
+ *
+ *   \param ind The columns.
+ *   \param lb The new lower bounds of the columns.
+ *   \param ub The new upper bounds of the columns.
+ */
+      virtual void changeBounds(ABA_BUFFER<int> &ind, ABA_BUFFER<double> &lb,
+                                ABA_BUFFER<double> &ub);
+
 /*! Pivots the slack variables  stored in the buffer \a rows into the basis.
  *
  *   \return 0 All variables could be pivoted in,
@@ -344,6 +366,45 @@ class ABA_COLUMN;
  *   \param limit Stores the iteration limit if the  return value is 0.
  */
       int getSimplexIterationLimit(int &limit);
+
+/*! \brief Sets the objective limit of the dual simplex method.
+ *
+ *   If the value of the linear program is worse than \a limit, i.e., greater
+ *   for a minimization problem and less for a maximization problem, the dual
+ *   simplex method can be stopped and \a optimize() returns \a LimitReached.
+ *   With an infinite \a limit the optimization is never stopped.
+ *
+ *   \return 0 If the objective limit could be set,
+ *   \return 1 otherwise.
+ *
+ *   \param limit The new objective limit.
+ */
+      int setObjectiveLimit(double limit);
+
+/*! \brief Can be called if the last linear program has been solved with
+ *   the dual simplex method and is infeasible.
+ *
+ *   Then a dual ray proves the infeasibility, i.e., the linear combination
+ *   of the rows with the multipliers of the ray is violated by all
+ *   values of the columns within their bounds.
+ *
+ *   \return 0 On success,
+ *   \return 1 otherwise.
+ *
+ *   \param ray Holds after the execution the multiplier of each row.
+ *                  The sign of the multipliers depends on the LP-solver.
+ */
+      int getDualRay(double *ray);
+
+/*! \return The number of iterations of the LP-solver in the last
+ *           optimization, or 0 if it is not provided by the LP-solver.
+ */
+      int nIterations();
+
+/*! \return true If the LP-solver provides a barrier method,
+ *   \return false otherwise.
+ */
+      bool barrierAvailable();
       ABA_CPUTIMER* lpSolverTime() { return &lpSolverTime_; }
 
     protected:
@@ -594,6 +655,15 @@ class ABA_COLUMN;
       */
       virtual void    _changeUBound(int i, double newUb) = 0;
 
+      /*! \brief The function \a _changeBounds() sets the bounds of the
+       *  columns \a ind to \a lb and \a ub.
+       *
+       *  The default implementation changes the bounds one by one. It should
+       *  be redefined if the LP-solver can change several bounds at once.
+      */
+      virtual void    _changeBounds(ABA_BUFFER<int> &ind, ABA_BUFFER<double> &lb,
+                                    ABA_BUFFER<double> &ub);
+
       /*! \brief The function \a pivotSlackVariableIn() pivots the slack variables
        *  stored in the buffer \a rows into the basis.
        *
@@ -639,6 +709,54 @@ class ABA_COLUMN;
        */
       virtual int _getSimplexIterationLimit(int &limit) = 0;
 
+      /*! \brief The function \a _setObjectiveLimit() sets the objective
+       *  limit of the dual simplex method.
+       *
+       *  The default implementation returns 1, i.e., the LP-solver does not
+       *  support an objective limit.
+       *
+       *  \return 0 If the objective limit could be set,
+       *  \return 1 otherwise.
+       *
+       *  \param limit The new objective limit.
+       */
+      virtual int _setObjectiveLimit(double limit);
+
+      /*! \brief The function \a _getDualRay() determines a dual ray
+       *  proving the infeasibility of the last linear program.
+       *
+       *  The default implementation returns 1, i.e., the LP-solver does not
+       *  provide a dual ray.
+       *
+       *  \return 0 If the dual ray could be determined,
+       *  \return 1 otherwise.
+       *
+       *  \param ray Stores the multiplier of each row.
+       */
+      virtual int _getDualRay(double *ray);
+
+      /*! \brief The function \a _race() solves the linear program with the
+       *  method \a Race.
+       *
+       *  The default implementation calls the primal simplex method, i.e.,
+       *  the LP-solver does not support racing.
+       */
+      virtual OPTSTAT _race();
+
+      /*! \brief The function \a _nIterations() returns the number of
+       *  iterations of the LP-solver in the last optimization.
+       *
+       *  The default implementation returns 0.
+       */
+      virtual int _nIterations();
+
+      /*! \brief The function \a _barrierAvailable() returns \a true if
+       *  the function \a _barrier() does not fall back to another method.
+       *
+       *  The default implementation returns \a true.
+       */
+      virtual bool _barrierAvailable();
+
       /*! A pointer to the corresponding master of the optimization.
        */
       ABA_MASTER *master_;
@@ -0,0 +1,156 @@
+/*!\file
+ * \author The ABACUS developers
+ * \brief statistics of the methods solving the linear programs.
+ *
+ * For each situation in which a linear program is solved and each method,
+ * the number of solved linear programs, the cpu time of the LP-solver, and
+ * the number of iterations are recorded. The adaptive selection of the
+ * method (see ABA_SUB::chooseLpMethod()) tries each candidate method a few
+ * times in each situation, and chooses the fastest one afterwards.
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#ifndef ABA_LPMETHODSTAT_H
+#define ABA_LPMETHODSTAT_H
+
+#include "abacus/abacusroot.h"
+#include "abacus/lp.h"
+
+class ABA_MASTER;
+
+  class  ABA_LPMETHODSTAT :  public ABA_ABACUSROOT  {
+    public:
+
+/*! The situations in which a linear program is solved.
+ *
+ *   \param RootLp The first linear program of the root node.
+ *   \param FirstLp The first linear program of another subproblem.
+ *   \param ConAdded Constraints but no variables have been added.
+ *   \param VarAdded Variables but no constraints have been added.
+ *   \param OtherLp Constraints and variables have been added, or
+ *                  only removed.
+ *   \param NoSituation The method has not been chosen by
+ *                      ABA_SUB::chooseLpMethod(). Nothing is recorded.
+ */
+      enum SITUATION {RootLp, FirstLp, ConAdded, VarAdded, OtherLp,
+                      NoSituation};
+
+/*! Literal values for the enumerators of SITUATION.
+ */
+      static const char *SITUATION_[];
+
+/*! \brief The constructor.
+ *
+ *   \param master A pointer to the corresponding master of the optimization.
+ */
+      ABA_LPMETHODSTAT(ABA_MASTER *master);
+
+//! The destructor.
+      ~ABA_LPMETHODSTAT();
+
+/*! \brief The output operator writes the recorded averages of each
+ *   situation and method to an output stream.
+ *
+ *   \return A reference to the output stream.
+ *
+ *   \param out The output stream.
+ *   \param rhs The statistics being output.
+ */
+      friend ostream &operator<<(ostream &out, const ABA_LPMETHODSTAT &rhs);
+
+/*! \brief Records a solved linear program.
+ *
+ *   \param situation The situation in which the linear program was solved.
+ *   \param method The method with which it was solved.
+ *   \param centiSeconds The cpu time of the LP-solver in centi seconds.
+ *   \param nIterations The number of iterations of the LP-solver.
+ */
+      void record(SITUATION situation, ABA_LP::METHOD method,
+                  long centiSeconds, int nIterations);
+
+/*! \brief Chooses a method for a situation.
+ *
+ *   As long as a candidate method has been applied less than
+ *   {\tt LpMethodTrials} times in this situation, it is chosen,
+ *   where \a preferred is tried first. Afterwards, the method with the
+ *   smallest average cpu time is chosen. Ties are broken by the average
+ *   number of iterations and then in favor of \a preferred.
+ *
+ *   \return The chosen method.
+ *
+ *   \param situation The situation.
+ *   \param preferred The method chosen by the fixed rule.
+ *   \param barrier If \a true, the barrier method is a candidate besides
+ *                  the primal and the dual simplex method.
+ */
+      ABA_LP::METHOD choose(SITUATION situation, ABA_LP::METHOD preferred,
+                            bool barrier) const;
+
+    private:
+
+/*! \return The average cpu time of \a method in \a situation.
+ */
+      double avgTime(int situation, int method) const;
+
+/*! \return The average number of iterations of \a method in \a situation.
+ */
+      double avgIterations(int situation, int method) const;
+
+/*! The number of situations in which statistics are recorded.
+ */
+      enum {nSituations = NoSituation};
+
+/*! The number of methods.
+ */
+      enum {nMethods = ABA_LP::Race + 1};
+
+/*! A pointer to the corresponding master of the optimization.
+ */
+      ABA_MASTER *master_;
+
+/*! The number of linear programs solved in each situation by each method.
+ */
+      int nSolved_[nSituations][nMethods];
+
+/*! The cpu time of the LP-solver in centi seconds.
+ */
+      long centiSeconds_[nSituations][nMethods];
+
+/*! The number of iterations of the LP-solver.
+ */
+      long nIterations_[nSituations][nMethods];
+
+      ABA_LPMETHODSTAT(const ABA_LPMETHODSTAT &rhs);
+      const ABA_LPMETHODSTAT &operator=(const ABA_LPMETHODSTAT &rhs);
+  };
+
+#endif  // ABA_LPMETHODSTAT_H
+
+/*! \class ABA_LPMETHODSTAT
+ *  \brief statistics of the methods solving the linear programs
+ */
@@ -60,6 +60,8 @@ class ABA_VARIABLE;
     friend class ABA_BOUNDBRANCHRULE;
     friend class ABA_VALBRANCHRULE;
     friend class ABA_CONBRANCHRULE;
+    friend class ABA_PROPAGATOR;
+    friend class ABA_DIVER;
     friend class COPBRANCHRULE;
     public: 
 
@@ -257,6 +259,14 @@ class ABA_VARIABLE;
 */
       virtual void changeUBound(int i, double newUb);
 
+/*! Sets the bounds of the variables \a ind to \a lb and \a ub.
+ *
+ *   It is not allowed to change the bounds of
+ *   an eliminated variable. This will cause a run-time error.
+*/
+      virtual void changeBounds(ABA_BUFFER<int> &ind, ABA_BUFFER<double> &lb,
+                                ABA_BUFFER<double> &ub);
+
 /*! Sets the maximal number of variables to \a newSize.
 */
       virtual void varRealloc(int newSize);
@@ -270,6 +280,18 @@ class ABA_VARIABLE;
       void constraint2row(ABA_BUFFER<ABA_CONSTRAINT*> &newCons,
                           ABA_BUFFER<ABA_ROW*> &newRows);
 
+/*! \brief Returns a new row holding the row generated in \a rowBuf
+ *   and clears \a rowBuf.
+ *
+ *   If at least half of the storage of \a rowBuf is used, its nonzeros
+ *   are transferred by \a ABA_ROW::swap() and \a rowBuf receives new storage
+ *   of the same size. Otherwise the nonzeros are copied to a row of the
+ *   exact length in order to save memory.
+ *
+ *   \param rowBuf The row generated by \a ABA_CONSTRAINT::genRow().
+ */
+      ABA_ROW *extractRow(ABA_ROW &rowBuf);
+
 /*! Returns \a true if the function can be  eliminated.
  *
  *   This function may be only applied to variables which are fixed or set!
@@ -44,9 +44,7 @@ using namespace std;
 
 class ABA_GLOBAL;
 
-#ifdef ABACUS_PARALLEL
 class ABA_MESSAGE;
-#endif
 
   class ABA_LPVARSTAT :  public ABA_ABACUSROOT  { 
     public: 
@@ -93,21 +91,19 @@ class ABA_MESSAGE;
  */
 
       ABA_LPVARSTAT(ABA_LPVARSTAT *lpVarStat);
-#ifdef ABACUS_PARALLEL
 
 /*! The message constructor creates the ABA_LPVARSTAT from a message.
  *
  *     \param glob A pointer to a global object.
  *     \param msg The message from which the object is initialized.
  */
-      ABA_LPVARSTAT(const ABA_GLOBAL *glob, ABA_MESSAGE &msg);
+      ABA_LPVARSTAT(ABA_GLOBAL *glob, ABA_MESSAGE &msg);
 
 /*! The function \a pack() packs the data of the ABA_LPVARSTAT in a message.
  *
  *   \param msg The ABA_MESSAGE object in which the status is packed.
  */
       void pack(ABA_MESSAGE &msg) const;
-#endif
 
 /*! \brief The output operator
  *   writes the \a STATUS to an output stream
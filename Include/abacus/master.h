@@ -53,9 +53,10 @@
 #include "abacus/string.h"
 #include "abacus/standardpool.h"
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
 class ABA_CONVAR;
+
+#ifdef ABACUS_PARALLEL
 class ABA_PARMASTER;
 class ABA_NOTIFYSERVER;
 #endif
@@ -68,14 +69,29 @@ class ABA_CONSTRAINT;
 class ABA_HISTORY;
 class ABA_OPENSUB;
 class ABA_FIXCAND;
+class ABA_DIVEINFO;
+class ABA_HEURSERVER;
+class ABA_LPMETHODSTAT;
+class ABA_SEPSTAT;
+class ABA_TREELOG;
+class ABA_CHECKPOINT;
+class ABA_SPILLFILE;
+class ABA_WORKER;
+class ABA_COORDINATOR;
 class ABA_LPMASTEROSI;
 class OsiSolverInterface;
 
 template<class BaseType, class CoType> class ABA_STANDARDPOOL;
+template<class BaseType, class CoType> class ABA_LPSOLUTION;
 
   class  ABA_MASTER :  public ABA_GLOBAL  {
     friend class ABA_SUB;
     friend class ABA_FIXCAND;
+    friend class ABA_CHECKPOINT;
+    friend class ABA_WORKER;
+    friend class ABA_COORDINATOR;
+    friend class ABA_DIVER;
+    friend class ABA_HEURSERVER;
 #ifdef ABACUS_PARALLEL
     friend ABA_NOTIFYSERVER;
     friend ABA_PARMASTER;
@@ -223,6 +239,45 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
        */
       static const char* SKIPPINGMODE_[];
 
+      /*! \brief This enumeration defines the diving heuristics applied in
+       *  the subproblems (see ABA_DIVER).
+       *
+       *  \param FractionalDiving The variable closest to an integer is
+       *                          rounded to this integer.
+       *  \param CoefficientDiving The variable with the fewest rows that
+       *                           might be violated by its rounding is
+       *                           rounded.
+       *  \param PseudoCostDiving The variable is selected and rounded
+       *                          according to its pseudocosts.
+       *  \param GuidedDiving The variable closest to its value in the best
+       *                      feasible solution is rounded towards this value.
+       *  \param RotatingDiving The diving heuristics are applied in turn.
+       */
+      enum DIVINGSTRAT {FractionalDiving, CoefficientDiving, PseudoCostDiving,
+                        GuidedDiving, RotatingDiving};
+
+      /*! \brief Literal values for the enumerators of the corresponding
+       *  enumeration type. The order of the enumerators is preserved.
+       *  (e.g., {\tt DIVINGSTRAT\_[0]=="Fractional"})
+       */
+      static const char* DIVINGSTRAT_[];
+
+      /*! \brief This enumeration defines how the method solving a linear
+       *  program is chosen by ABA_SUB::chooseLpMethod().
+       *
+       *  \param FixedLpMethod The method is chosen by a fixed rule.
+       *  \param AdaptiveLpMethod The method is chosen by the recorded
+       *                          cpu times of the methods in the same
+       *                          situation (see ABA_LPMETHODSTAT).
+       */
+      enum LPMETHODSEL {FixedLpMethod, AdaptiveLpMethod};
+
+      /*! \brief Literal values for the enumerators of the corresponding
+       *  enumeration type. The order of the enumerators is preserved.
+       *  (e.g., {\tt LPMETHODSEL\_[0]=="Fixed"})
+       */
+      static const char* LPMETHODSEL_[];
+
       /*! \brief This enumeration defines the ways for automatic constraint elimination
        *  during the cutting plane phase.
        *
@@ -262,8 +317,12 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
        *              file.
        *  \param Pipe Output for the tree interface is pipe to the
        *	      standard output.
+       *  \param Binary Output for the tree interface is written in a
+       *              compact binary format to a file by a background
+       *              thread (see ABA_TREELOG). It can be converted to
+       *              the format of \a File with the program {\tt abavbc}.
        */
-      enum VBCMODE {NoVbc, File, Pipe};
+      enum VBCMODE {NoVbc, File, Pipe, Binary};
 
       /*! \brief Literal values for the enumerators of the corresponding
        *  enumeration type. The order of the enumerators is preserved.
@@ -326,7 +385,6 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
 
 //! The destructor.
       virtual ~ABA_MASTER();
-#ifdef ABACUS_PARALLEL
 
 /*! \brief The virtual function \a unpackConVar()
  *   constructs and unpacks an object of some subclass of ABA_CONVAR from a Message.
@@ -350,7 +408,7 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
  *     The class identification of the subclass of ABA_CONVAR
  *      which should be unpacked.
  */
-      virtual ABA_CONVAR *unpackConVar(ABA_MESSAGE &msg, int classId) const;
+      virtual ABA_CONVAR *unpackConVar(ABA_MESSAGE &msg, int classId);
 
 /*! Construicts and unpacks an object of some subclass of ABA_BRANCHRULE from a Message.
  *
@@ -368,7 +426,7 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
  *     The class identification of the subclass of ABA_BRANCHRULE
  *      which should be unpacked.
  */
-      virtual ABA_BRANCHRULE *unpackBranchrule(ABA_MESSAGE &msg, int classId) const;
+      virtual ABA_BRANCHRULE *unpackBranchrule(ABA_MESSAGE &msg, int classId);
 
 /*! \brief The pure virtual function \a unpackSub()
  *   constructs and unpacks an object of the user defined subclass of ABA_SUB from a Message.
@@ -379,9 +437,127 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
  *
  *   \param msg The message from which the subclass of ABA_SUB is unpacked.
  */
+#ifdef ABACUS_PARALLEL
       virtual ABA_SUB *unpackSub(ABA_MESSAGE &msg) = 0;
+#else
+
+/*! \brief The virtual function \a unpackSub()
+ *   constructs and unpacks an object of the user defined subclass of ABA_SUB
+ *   from a Message.
+ *
+ *   In the sequential version this function is only required
+ *   if the parameter {\tt CheckpointInterval} or {\tt Workers} is
+ *   positive or {\tt CheckpointRestart} is true. The default implementation
+ *   terminates the program with an error message.
+ *
+ *   \return A Pointer to a newly constructed object of the user defined subclass of ABA_SUB.
+ *
+ *   \param msg The message from which the subclass of ABA_SUB is unpacked.
+ */
+      virtual ABA_SUB *unpackSub(ABA_MESSAGE &msg);
+
+/*! \brief The virtual function \a packCheckpoint()
+ *   packs problem specific data of a derived class into a checkpoint.
+ *
+ *   It is called after the data of ABA_MASTER has been packed and
+ *   can be used to store, e.g., the best known feasible solution.
+ *   The default implementation does nothing.
+ *
+ *   \param msg The message the data is packed in.
+ */
+      virtual void packCheckpoint(ABA_MESSAGE &msg) const;
+
+/*! \brief The virtual function \a unpackCheckpoint()
+ *   restores the data packed by \a packCheckpoint() from a checkpoint.
+ *
+ *   The default implementation does nothing.
+ *
+ *   \param msg The message the data is unpacked from.
+ */
+      virtual void unpackCheckpoint(ABA_MESSAGE &msg);
 #endif
 
+/*! \brief Registers an additional pool of constraints, e.g., a pool
+ *   of problem specific cuts.
+ *
+ *   The constraints of a registered pool can be packed like those of the
+ *   cut pool, i.e., they are saved in checkpoints, in spilled subproblems,
+ *   and sent to the workers of a distributed optimization. The registered
+ *   pools get the numbers 3, 4, \ldots of \a defaultPool() in the order
+ *   of their registration. Therefore, the pools have to be registered in
+ *   the same order in each run, e.g., in \a initializeOptimization().
+ *
+ *   The pool is not deleted by the master.
+ *
+ *   \param pool A pointer to the pool.
+ */
+      void registerConPool(ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE> *pool);
+
+/*! \return The number of default pools including the registered pools.
+ */
+      int nDefaultPools() const;
+
+/*! \brief Gives a problem specific separator a name for the
+ *   separator statistics output at the end of the optimization.
+ *
+ *   The separator is called with ABA_SUB::startSeparator() and
+ *   ABA_SUB::stopSeparator().
+ *
+ *   \param separator The number of the separator, at least
+ *                    ABA_SEPSTAT::FirstUser.
+ *   \param name The name of the separator. The string is not copied.
+ */
+      void registerSeparator(int separator, const char *name);
+
+/*! \brief Provides a temporary dense vector, e.g., for scattering a
+ *   sparse vector in ABA_ROWCON::slack().
+ *
+ *   All elements of the vector are 0. The caller must reset each element
+ *   it has changed to 0 before the vector is requested again. As the
+ *   vector is shared, it must not be used by the threads of the
+ *   asynchronous primal heuristics.
+ *
+ *   \return A pointer to the first of at least \a size elements.
+ *
+ *   \param size The required number of elements.
+ */
+      double *zeroScratch(int size);
+
+/*! \return A pointer to the default pool with number \a i, i.e.,
+ *   the constraint pool for \a i = 0, the cut pool for \a i = 1, the
+ *   variable pool for \a i = 2, and the registered constraint pools
+ *   (see \a registerConPool()) for \a i \f$\ge\f$ 3, or 0 if there is
+ *   no such pool.
+ *
+ *   This function and \a defaultPoolIndex() are used to identify
+ *   pool slots when active sets or branching rules are packed.
+ *
+ *   \param i The number of the default pool.
+ */
+      void *defaultPool(int i) const;
+
+/*! \return The number of the default pool \a pool (see \a defaultPool()),
+ *   or -1 if \a pool is not one of the default pools.
+ *
+ *   \param pool A pointer to a pool.
+ */
+      int defaultPoolIndex(const void *pool) const;
+
+/*! \return true If the constraints/variables of the default pool with
+ *               number \a pool are currently packed by value instead of
+ *               by a reference to their pool slot,
+ *   \return false otherwise.
+ *
+ *   Only the constraints of the cut pool and of the registered pools are
+ *   packed by value, if open subproblems are sent to another process of a
+ *   distributed optimization (see the parameter {\tt Workers}). The
+ *   constraints of the constraint pool and the variables are identical in
+ *   all processes.
+ *
+ *   \param pool The number of the default pool (see \a defaultPool()).
+ */
+      bool packByValue(int pool) const;
+
 /*! Performs the optimization by \bab.
  *
  *   The status of the optimization.
@@ -598,6 +774,19 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
  */
       bool pricing() const;
 
+/*! \brief This version of the function \a pricing() switches the
+ *   generation of variables on or off.
+ *
+ *   It must be called before the optimization starts, e.g., in
+ *   \a initializeParameters(), if the problem specific parameters
+ *   decide if all variables are generated initially. Several features,
+ *   e.g., the diving heuristics and the \a Workers, require that
+ *   no variables are generated.
+ *
+ *   \param on If \a true, variables are generated.
+ */
+      void pricing(bool on);
+
 /*! \return A pointer to the object holding the optimization sense of the problem.
  */
       const ABA_OPTSENSE *optSense() const;
@@ -704,6 +893,10 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
  */
       int nNewRoot() const;
 
+/*! \return The number of restarts of the root node.
+ */
+      int nRootRestarts() const;
+
 /*! \return The number of subproblems which have already
  *   been selected from the set of open subproblems.
  */
@@ -1047,6 +1240,173 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
 */
       void fixSetByRedCost(bool on);
 
+/*! \return true Then the bounds of the variables are tightened by the
+ *                   propagation of constraints given by an explicit row.
+ *   \return false Then no bound propagation is performed.
+ */
+      bool boundPropagation() const;
+
+/*! Turns the bound propagation on or off.
+ *
+ *   \param on If \a true, then the bound propagation is turned on.
+ *                 Otherwise it is turned off.
+ */
+      void boundPropagation(bool on);
+
+/*! \return true Then the dual simplex method is stopped as soon as the
+ *                   value of the linear program of a subproblem exceeds the
+ *                   primal bound.
+ *   \return false Then the linear programs are always solved to optimality.
+ */
+      bool objectiveCutoff() const;
+
+/*! Turns the objective cutoff of the linear programs on or off.
+ *
+ *   \param on If \a true, then the objective cutoff is turned on.
+ *                 Otherwise it is turned off.
+ */
+      void objectiveCutoff(bool on);
+
+/*! \return true Then conflict constraints are derived from infeasible
+ *                   linear programs.
+ *   \return false Then no conflict analysis is performed.
+ */
+      bool conflictAnalysis() const;
+
+/*! Turns the conflict analysis on or off.
+ *
+ *   \param on If \a true, then the conflict analysis is turned on.
+ *                 Otherwise it is turned off.
+ */
+      void conflictAnalysis(bool on);
+
+/*! \return The maximal number of variables of a conflict constraint.
+ */
+      int maxConflictSize() const;
+
+/*! \brief Sets the maximal number of variables of a conflict constraint.
+ *
+ *   \param max The new maximal number of variables.
+ */
+      void maxConflictSize(int max);
+
+/*! \return The frequency of the diving heuristics. They are applied in
+ *           the subproblems of every \a divingFrequency() level of the
+ *           enumeration tree, starting with the root. If it is 0, no
+ *           diving heuristics are applied.
+ */
+      int divingFrequency() const;
+
+/*! \brief Sets the frequency of the diving heuristics.
+ *
+ *   \param f The new frequency.
+ */
+      void divingFrequency(int f);
+
+/*! \return The diving heuristics applied in the subproblems.
+ */
+      DIVINGSTRAT divingStrategy() const;
+
+/*! \brief Sets the diving heuristics applied in the subproblems.
+ *
+ *   \param strat The new diving heuristics.
+ */
+      void divingStrategy(DIVINGSTRAT strat);
+
+/*! \return The number of threads applying the asynchronous primal
+ *           heuristic \a asyncImprove(). If it is 0, the heuristic is
+ *           not applied.
+ */
+      int heuristicThreads() const;
+
+/*! \brief Sets the number of threads applying the asynchronous primal
+ *   heuristic.
+ *
+ *   \param n The new number of threads.
+ */
+      void heuristicThreads(int n);
+
+/*! \return The maximal number of solutions of linear programs waiting for
+ *           the asynchronous primal heuristic.
+ */
+      int heuristicQueueSize() const;
+
+/*! \brief Sets the maximal number of solutions of linear programs waiting
+ *   for the asynchronous primal heuristic.
+ *
+ *   \param n The new maximal number.
+ */
+      void heuristicQueueSize(int n);
+
+/*! \return The selection of the method solving the linear programs.
+ */
+      LPMETHODSEL lpMethodSelection() const;
+
+/*! \brief Sets the selection of the method solving the linear programs.
+ *
+ *   \param sel The new selection.
+ */
+      void lpMethodSelection(LPMETHODSEL sel);
+
+/*! \return The number of times each method is tried in a situation before
+ *           the adaptive selection chooses the fastest one.
+ */
+      int lpMethodTrials() const;
+
+/*! \brief Sets the number of times each method is tried in a situation
+ *   by the adaptive selection.
+ *
+ *   \param n The new number of trials.
+ */
+      void lpMethodTrials(int n);
+
+/*! \return true If the first linear program of the root node is solved by
+ *                a race of the primal and the dual simplex method,
+ *   \return false otherwise.
+ */
+      bool lpRace() const;
+
+/*! \brief Turns the race for the first linear program of the root node
+ *   on or off.
+ *
+ *   \param on If \a true, then the race is turned on.
+ *                 Otherwise it is turned off.
+ */
+      void lpRace(bool on);
+
+/*! \return The share of the variables which must be globally fixed to zero
+ *           at the end of the root node for a restart of the root, or 0 if
+ *           the root is never restarted.
+ */
+      double rootRestart() const;
+
+/*! \brief Sets the share of the variables globally fixed to zero
+ *   for a restart of the root.
+ *
+ *   If the share is reached when the root node would be branched, the
+ *   variables fixed to zero are removed from the default variable pool and
+ *   a new root node is optimized on the reduced problem with the current
+ *   pool of cutting planes. Variables must therefore not be referenced
+ *   outside of the pools if the restart is turned on.
+ *
+ *   \param share The new share, 0 turns the restart off.
+ */
+      void rootRestart(double share);
+
+/*! \return The share of the average improvement of the dual bound per
+ *           second in the root node, below which the cutting plane
+ *           algorithm of the other subproblems skips separators and stops
+ *           cutting, or 0 if the cutting is not adapted.
+ */
+      double adaptiveCutting() const;
+
+/*! \brief Sets the share of the average improvement of the dual bound per
+ *   second in the root node for the adaptive cutting.
+ *
+ *   \param share The new share, 0 turns the adaptive cutting off.
+ */
+      void adaptiveCutting(double share);
+
 /*! \return true Then the linear program is output every iteration of the
  *                   subproblem optimization.
  *   \return false The linear program is not output.
@@ -1398,6 +1758,28 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
  *   after the optimization process is finished.
  */
       virtual void terminateOptimization();
+
+/*! \brief Can be redefined in derived classes in order to implement
+ *   primal heuristics which are applied asynchronously to the solutions
+ *   of the linear programs (see ABA_HEURSERVER).
+ *
+ *   The function is only called if the parameter {\tt HeuristicThreads}
+ *   is positive. It is called concurrently by the heuristic threads while
+ *   the optimization continues. Hence, it must not modify any data of the
+ *   optimization, and the feasible solution should be stored by the
+ *   derived class under the protection of a mutex. The primal bound is
+ *   updated by the optimization. The default implementation does nothing.
+ *
+ *   \return 0 If no feasible solution could be found,
+ *   \return 1 otherwise.
+ *
+ *   \param lpSolution The solution of a linear program together with the
+ *                     active variables. It must not be modified.
+ *   \param primalValue Should hold the value of the feasible solution,
+ *                          if one is found.
+ */
+      virtual int asyncImprove(ABA_LPSOLUTION<ABA_VARIABLE, ABA_CONSTRAINT> *lpSolution,
+                               double &primalValue);
       
 #ifdef ABACUS_PARALLEL
      ABA_PARMASTER *parmaster_;
@@ -1457,6 +1839,85 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
  *   fulfilled 0 is returned.
  */
       ABA_SUB   *select();
+
+/*! \brief Writes a checkpoint of the open subproblems before the
+ *   optimization is stopped since a resource limit is exceeded,
+ *   if checkpoints are written at all.
+ */
+      void _finalCheckpoint();
+
+/*! \brief Fathoms all subproblems of the tree, including open subproblems
+ *   which have been received from another process of a distributed
+ *   optimization and have no father.
+ */
+      void _fathomTree();
+
+/*! \brief Opens the spill file.
+ *
+ *   If no name of the spill file is given, its name is constructed like
+ *   the name of the log-file of the tree with the extension {\tt .spill}.
+ *   The file of a worker of a distributed optimization gets the process
+ *   id as additional extension.
+ */
+      void _openSpillFile();
+
+/*! \brief Updates the primal bound by the best value found by the
+ *   asynchronous primal heuristic since the last call.
+ */
+      void _harvestHeuristics();
+
+/*! \return true If a variable is globally fixed to zero,
+ *   \return false otherwise.
+ *
+ *   \param v The variable.
+ */
+      bool _fixedToZero(ABA_VARIABLE *v) const;
+
+/*! \return true If the share of the variables of the default variable pool
+ *                globally fixed to zero has reached {\tt RootRestart},
+ *   \return false otherwise.
+ */
+      bool _rootRestartDue() const;
+
+/*! \brief Restarts the optimization with a new root node.
+ *
+ *   The old root node is deleted, the variables globally fixed to zero
+ *   which are no longer referenced are removed from the default variable
+ *   pool, and the new root node generated by \a firstSub() is inserted in
+ *   the set of open subproblems.
+ */
+      void _restartRoot();
+
+#ifndef ABACUS_PARALLEL
+/*! \brief Distributes the open subproblems to {\tt Workers} new processes
+ *   and coordinates them until the optimization terminates.
+ *
+ *   In the worker processes this function returns after the worker has
+ *   been set up, and the optimization continues with the remaining open
+ *   subproblems.
+ *
+ *   \return true In the coordinating process, after the distributed
+ *                optimization has terminated,
+ *   \return false in the worker processes.
+ */
+      bool _startWorkers();
+
+/*! Packs the counters and the cpu timers of the statistics.
+ */
+      void _packStatistics(ABA_MESSAGE &msg) const;
+
+/*! \brief Unpacks the statistics packed by \a _packStatistics().
+ *
+ *   \param msg The message the statistics are unpacked from.
+ *   \param base If \a base is 0, the counters are replaced and the times
+ *               are added. Otherwise, the statistics packed in \a base are
+ *               subtracted from the unpacked ones before they are added.
+ *               This is used to accumulate the statistics of the workers
+ *               of a distributed optimization, which start with a copy of
+ *               the statistics of the coordinator.
+ */
+      void _unpackStatistics(ABA_MESSAGE &msg, ABA_MESSAGE *base);
+#endif
       int initLP();
 
 /*! Writes the string \a info to the stream associated with the Tree Interface.
@@ -1536,6 +1997,23 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
  */
       ABA_FIXCAND *fixCand() const;
 
+/*! returns a pointer to the object storing the information shared by the diving heuristics.
+ */
+      ABA_DIVEINFO *diveInfo() const;
+
+/*! returns a pointer to the server of the asynchronous primal heuristics,
+ *  or 0 if they are not applied.
+ */
+      ABA_HEURSERVER *heurServer() const;
+
+/*! returns a pointer to the statistics of the methods solving the linear programs.
+ */
+      ABA_LPMETHODSTAT *lpMethodStat() const;
+
+/*! returns a pointer to the statistics of the separators.
+ */
+      ABA_SEPSTAT *sepStat() const;
+
 /*! Sets the root of the remaining \bac\ tree to \a newRoot.
  *
  *   If \a reoptimize is \a true a reoptimization of the
@@ -1615,6 +2093,16 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
       */
       ABA_STANDARDPOOL<ABA_VARIABLE, ABA_CONSTRAINT> *varPool_;
 
+      /*! The constraint pools registered by \a registerConPool(),
+       *  or 0 if no pool has been registered.
+       */
+      ABA_BUFFER<ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE>*> *conPools_;
+
+      /*! The vector returned by \a zeroScratch(), or 0 if it has not
+       *  been requested yet.
+       */
+      ABA_ARRAY<double> *zeroScratch_;
+
       /*! The best known primal bound.
        */
       double           primalBound_;
@@ -1631,6 +2119,10 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
        */
       ABA_FIXCAND         *fixCand_;
 
+      /*! The information shared by the diving heuristics.
+       */
+      ABA_DIVEINFO        *diveInfo_;
+
       /*! If \a true, then constraints are generated in the optimization.
        */
       bool             cutting_;
@@ -1658,6 +2150,71 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
        */
       ostream         *treeStream_;
 
+      /*! A pointer to the binary log of the tree if \a VbcLog_ is \a Binary.
+       */
+      ABA_TREELOG     *treeLog_;
+
+      /*! The size of the buffers of the binary tree log in bytes.
+       */
+      int              vbcBufferSize_;
+
+      /*! A pointer to the writer of checkpoints, or 0 if neither checkpoints
+       *  are written nor the optimization is restarted from a checkpoint.
+       */
+      ABA_CHECKPOINT  *checkpoint_;
+
+      /*! \brief The wall-clock time in seconds between two checkpoints.
+       *
+       *  If this value is 0, then no checkpoints are written.
+       */
+      int              checkpointInterval_;
+
+      /*! The name of the checkpoint file.
+       */
+      ABA_STRING       checkpointFile_;
+
+      /*! If \a true, the optimization is restarted from the checkpoint file.
+       */
+      bool             checkpointRestart_;
+
+      /*! \brief The limit in megabytes for the estimated memory of the
+       *  local data of the open subproblems.
+       *
+       *  If this value is 0, then no subproblems are spilled to disk.
+       */
+      int              spillMemory_;
+
+      /*! The file for the local data of spilled subproblems, or 0 if
+       *  \a spillMemory_ is 0.
+       */
+      ABA_SPILLFILE   *spillFile_;
+
+      /*! \brief The number of worker processes of a distributed optimization.
+       *
+       *  If this value is 0, then the optimization is not distributed.
+       */
+      int              workers_;
+
+      /*! \brief The number of open subproblems per worker which are
+       *  generated before the workers are started.
+       */
+      int              workerRampUp_;
+
+      /*! A pointer to the connection to the coordinator if this process is
+       *  a worker of a distributed optimization, 0 otherwise.
+       */
+      ABA_WORKER      *worker_;
+
+      /*! A pointer to the coordinator of the workers if this process
+       *  has started a distributed optimization, 0 otherwise.
+       */
+      ABA_COORDINATOR *coordinator_;
+
+      /*! If \a true, the constraints of the cut pool and of the
+       *  registered pools are packed by value.
+       */
+      bool             packByValue_;
+
       /*! \brief The guarantee in percent which should be 
        * reached when the optimization stops.
        *     
@@ -1732,6 +2289,85 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
        */
       bool             fixSetByRedCost_;
 
+      /*! If \a true, then the bounds of the variables are tightened by
+       *  bound propagation.
+       */
+      bool             boundPropagation_;
+
+      /*! If \a true, then the primal bound is passed as objective limit
+       *  to the LP-solver.
+       */
+      bool             objectiveCutoff_;
+
+      /*! If \a true, then conflict constraints are derived from infeasible
+       *  linear programs.
+       */
+      bool             conflictAnalysis_;
+
+      /*! The maximal number of variables of a conflict constraint.
+       */
+      int              maxConflictSize_;
+
+      /*! The diving heuristics are applied in every \a divingFrequency_
+       *  level of the enumeration tree.
+       */
+      int              divingFrequency_;
+
+      /*! The diving heuristics applied in the subproblems.
+       */
+      DIVINGSTRAT      divingStrategy_;
+
+      /*! The number of threads applying the asynchronous primal heuristic.
+       */
+      int              heuristicThreads_;
+
+      /*! The maximal number of solutions of linear programs waiting for
+       *  the asynchronous primal heuristic.
+       */
+      int              heuristicQueueSize_;
+
+      /*! A pointer to the server of the asynchronous primal heuristics,
+       *  or 0 if \a heuristicThreads_ is 0.
+       */
+      ABA_HEURSERVER  *heurServer_;
+
+      /*! The selection of the method solving the linear programs.
+       */
+      LPMETHODSEL      lpMethodSelection_;
+
+      /*! The number of times each method is tried in a situation by the
+       *  adaptive selection.
+       */
+      int              lpMethodTrials_;
+
+      /*! If \a true, the first linear program of the root node is solved
+       *  by a race of the primal and the dual simplex method.
+       */
+      bool             lpRace_;
+
+      /*! The share of the variables globally fixed to zero at the end of
+       *  the root node required for a restart of the root, 0 if the root
+       *  is never restarted.
+       */
+      double           rootRestart_;
+
+      /*! \a true if the root node has requested a restart.
+       */
+      bool             restartRoot_;
+
+      /*! The share of the average improvement of the dual bound per second
+       *  in the root node for the adaptive cutting, 0 if it is turned off.
+       */
+      double           adaptiveCutting_;
+
+      /*! The statistics of the methods solving the linear programs.
+       */
+      ABA_LPMETHODSTAT *lpMethodStat_;
+
+      /*! The statistics of the separators.
+       */
+      ABA_SEPSTAT      *sepStat_;
+
       /*! If \a true, then the linear program is output every iteration.
        */
       bool             printLP_;
@@ -1877,6 +2513,10 @@ template<class BaseType, class CoType> class ABA_STANDARDPOOL;
       /*! The number of changes of the root of the remaining \bab\ tree.
        */
       int nNewRoot_;
+
+      /*! The number of restarts of the root node.
+       */
+      int nRootRestarts_;
       ABA_MASTER(const ABA_MASTER &rhs);
       const ABA_MASTER &operator=(const ABA_MASTER& rhs);
   };
@@ -1904,6 +2544,11 @@ inline double ABA_MASTER::dualBound() const
     return dualBound_;
   }
 
+inline bool ABA_MASTER::packByValue(int pool) const
+  {
+    return packByValue_ && pool != 0 && pool != 2;
+  }
+
 inline ABA_SUB* ABA_MASTER::root() const
   {
     return root_;
@@ -1934,6 +2579,26 @@ inline ABA_FIXCAND *ABA_MASTER::fixCand() const
     return fixCand_;
   }
 
+inline ABA_DIVEINFO *ABA_MASTER::diveInfo() const
+  {
+    return diveInfo_;
+  }
+
+inline ABA_HEURSERVER *ABA_MASTER::heurServer() const
+  {
+    return heurServer_;
+  }
+
+inline ABA_LPMETHODSTAT *ABA_MASTER::lpMethodStat() const
+  {
+    return lpMethodStat_;
+  }
+
+inline ABA_SEPSTAT *ABA_MASTER::sepStat() const
+  {
+    return sepStat_;
+  }
+
 inline ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE> *ABA_MASTER::conPool() const
   {
     return conPool_;
@@ -2053,6 +2718,11 @@ inline int ABA_MASTER::nNewRoot() const
     return nNewRoot_;
   }
 
+inline int ABA_MASTER::nRootRestarts() const
+  {
+    return nRootRestarts_;
+  }
+
 inline int ABA_MASTER::nSubSelected() const
   {
     return nSubSelected_;
@@ -2068,6 +2738,136 @@ inline void ABA_MASTER::fixSetByRedCost(bool on)
     fixSetByRedCost_ = on;
   }
 
+inline bool ABA_MASTER::boundPropagation() const
+  {
+    return boundPropagation_;
+  }
+
+inline void ABA_MASTER::boundPropagation(bool on)
+  {
+    boundPropagation_ = on;
+  }
+
+inline bool ABA_MASTER::objectiveCutoff() const
+  {
+    return objectiveCutoff_;
+  }
+
+inline void ABA_MASTER::objectiveCutoff(bool on)
+  {
+    objectiveCutoff_ = on;
+  }
+
+inline bool ABA_MASTER::conflictAnalysis() const
+  {
+    return conflictAnalysis_;
+  }
+
+inline void ABA_MASTER::conflictAnalysis(bool on)
+  {
+    conflictAnalysis_ = on;
+  }
+
+inline int ABA_MASTER::maxConflictSize() const
+  {
+    return maxConflictSize_;
+  }
+
+inline void ABA_MASTER::maxConflictSize(int max)
+  {
+    maxConflictSize_ = max;
+  }
+
+inline int ABA_MASTER::divingFrequency() const
+  {
+    return divingFrequency_;
+  }
+
+inline void ABA_MASTER::divingFrequency(int f)
+  {
+    divingFrequency_ = f;
+  }
+
+inline ABA_MASTER::DIVINGSTRAT ABA_MASTER::divingStrategy() const
+  {
+    return divingStrategy_;
+  }
+
+inline void ABA_MASTER::divingStrategy(DIVINGSTRAT strat)
+  {
+    divingStrategy_ = strat;
+  }
+
+inline int ABA_MASTER::heuristicThreads() const
+  {
+    return heuristicThreads_;
+  }
+
+inline void ABA_MASTER::heuristicThreads(int n)
+  {
+    heuristicThreads_ = n;
+  }
+
+inline int ABA_MASTER::heuristicQueueSize() const
+  {
+    return heuristicQueueSize_;
+  }
+
+inline void ABA_MASTER::heuristicQueueSize(int n)
+  {
+    heuristicQueueSize_ = n;
+  }
+
+inline ABA_MASTER::LPMETHODSEL ABA_MASTER::lpMethodSelection() const
+  {
+    return lpMethodSelection_;
+  }
+
+inline void ABA_MASTER::lpMethodSelection(LPMETHODSEL sel)
+  {
+    lpMethodSelection_ = sel;
+  }
+
+inline int ABA_MASTER::lpMethodTrials() const
+  {
+    return lpMethodTrials_;
+  }
+
+inline void ABA_MASTER::lpMethodTrials(int n)
+  {
+    lpMethodTrials_ = n;
+  }
+
+inline bool ABA_MASTER::lpRace() const
+  {
+    return lpRace_;
+  }
+
+inline void ABA_MASTER::lpRace(bool on)
+  {
+    lpRace_ = on;
+  }
+
+inline double ABA_MASTER::rootRestart() const
+  {
+    return rootRestart_;
+  }
+
+inline void ABA_MASTER::rootRestart(double share)
+  {
+    rootRestart_ = share;
+  }
+
+inline double ABA_MASTER::adaptiveCutting() const
+  {
+    return adaptiveCutting_;
+  }
+
+inline void ABA_MASTER::adaptiveCutting(double share)
+  {
+    adaptiveCutting_ = share;
+  }
+
 inline bool ABA_MASTER::printLP() const
   {
     return printLP_;
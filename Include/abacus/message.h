@@ -43,6 +43,7 @@
 
 #ifndef ABA_MESSAGE_H
 #define ABA_MESSAGE_H
+#ifdef ABACUS_PARALLEL
 #include "abacus/messagebase.h"
 #include <ace/SOCK_Stream.h>
   class  ABA_MESSAGE : public ABA_MESSAGEBASE { 
@@ -60,6 +61,18 @@
       ~ABA_MESSAGE();
       ACE_SOCK_Stream& stream();
 
+/*! @name
+ *  The base class has no functions for \a unsigned \a long, which is
+ *  the type of the sequence number of an ABA_ID. Such values are
+ *  transferred as a \a long.
+ */
+//@{
+      using ABA_MESSAGEBASE::pack;
+      using ABA_MESSAGEBASE::unpack;
+      void pack(unsigned long x);
+      void unpack(unsigned long &x);
+//@}
+
     protected: 
 
 /*! @name 
@@ -77,6 +90,415 @@ inline ACE_SOCK_Stream& ABA_MESSAGE::stream()
   return stream_;
 }
 
+inline void ABA_MESSAGE::pack(unsigned long x)
+{
+  pack((long) x);
+}
+
+inline void ABA_MESSAGE::unpack(unsigned long &x)
+{
+  long h;
+  unpack(h);
+  x = (unsigned long) h;
+}
+
+
+#else  // ABACUS_PARALLEL
+
+#include "abacus/global.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*! In the sequential version the message is a contiguous buffer in
+ *  memory, which grows automatically if it is full. The data is
+ *  stored in the representation of the machine. A message can be
+ *  written to and read from a file, e.g., for a checkpoint of the
+ *  optimization, or sent over a file descriptor, e.g., a pipe or a
+ *  local socket. Since the buffer is contiguous, it can also be copied
+ *  to shared memory with \a data() and \a length(), and a message can
+ *  be unpacked directly from such memory after \a attach().
+ *
+ *  \par
+ *  No function of the message is virtual and all \a pack() and \a unpack()
+ *  functions are inline. Arrays are copied as a single block.
+ */
+  class  ABA_MESSAGE : public ABA_ABACUSROOT { 
+    public: 
+
+/*! The constructor. 
+ *
+ *   \param glob A pointer to the corresponding global object.
+ *   \param size The initial size of the buffer in bytes.
+ */
+      ABA_MESSAGE(ABA_GLOBAL *glob, int size = 4096);
+
+//! The destructor.
+      ~ABA_MESSAGE();
+
+/*! @name 
+ *   The functions \a pack() append data to the end of the message,
+ *   the functions \a unpack() extract the data in the same order
+ *   from the message.
+ */
+//@{
+      void pack(short x);
+      void pack(int x);
+      void pack(unsigned x);
+      void pack(long x);
+      void pack(unsigned long x);
+      void pack(double x);
+      void pack(bool x);
+      void pack(char x);
+      void pack(const int *x, int n);
+      void pack(const double *x, int n);
+      void pack(const char *x, int n);
+      void unpack(short &x);
+      void unpack(int &x);
+      void unpack(unsigned &x);
+      void unpack(long &x);
+      void unpack(unsigned long &x);
+      void unpack(double &x);
+      void unpack(bool &x);
+      void unpack(char &x);
+      void unpack(int *x, int n);
+      void unpack(double *x, int n);
+      void unpack(char *x, int n);
+//@}
+
+/*! \brief Appends \a n bytes to the message without initializing them.
+ *
+ *   This function allows to pack data of a different representation,
+ *   e.g., an array of enumerators, without a temporary copy.
+ *
+ *   \return A pointer to the \a n new bytes. It becomes invalid
+ *           if further data is packed.
+ */
+      char *packBytes(long n);
+
+/*! \brief Unpacks \a n bytes without copying them.
+ *
+ *   \return A pointer to the next \a n bytes of the message. It
+ *           becomes invalid if data is packed or the message is cleared.
+ */
+      const char *unpackBytes(long n);
+
+/*! Appends the complete contents of the message \a x.
+ */
+      void pack(const ABA_MESSAGE &x);
+
+/*! \return The next integer of the message.
+ */
+      int unpackInt();
+
+/*! Removes all data from the message.
+ */
+      void clear();
+
+/*! \return The number of bytes in the message.
+ *
+ *   The length is a \a long, such that a message, e.g., a checkpoint of
+ *   a large enumeration tree, can exceed 2 GB on 64 bit systems.
+ */
+      long length() const;
+
+/*! \return The number of bytes which have not been unpacked yet.
+ */
+      long remaining() const;
+
+/*! \brief Writes the message to a file.
+ *
+ *   First the length of the message is written, then the data.
+ *
+ *   \return 0 If the message could be written,
+ *   \return 1 otherwise.
+ *
+ *   \param file The file the message is written to.
+ */
+      int write(FILE *file) const;
+
+/*! \brief Reads a message written by the function \a write()
+ *   and replaces the current contents of the message.
+ *
+ *   \return 0 If the message could be read,
+ *   \return 1 otherwise.
+ *
+ *   \param file The file the message is read from.
+ */
+      int read(FILE *file);
+
+/*! \brief Sends the message over a file descriptor, e.g., a pipe or a
+ *   connected local socket.
+ *
+ *   First the length of the message is sent, then the data.
+ *
+ *   \return 0 If the message could be sent,
+ *   \return 1 otherwise.
+ *
+ *   \param fd The file descriptor.
+ */
+      int send(int fd) const;
+
+/*! \brief Receives a message sent by the function \a send()
+ *   and replaces the current contents of the message.
+ *
+ *   \return 0 If the message could be received,
+ *   \return 1 otherwise, in particular if the sender closed the connection.
+ *
+ *   \param fd The file descriptor.
+ */
+      int receive(int fd);
+
+/*! \return A pointer to the data of the message.
+ */
+      const char *data() const;
+
+/*! \brief Replaces the contents of the message by \a n bytes of \a data,
+ *   e.g., in shared memory or in a file mapped to memory.
+ *
+ *   The data is not copied, hence it must not be changed or released
+ *   as long as it is unpacked. If further data is packed, the message
+ *   is copied to a buffer of its own first.
+ *
+ *   \param data The data of the message.
+ *   \param n The number of bytes of the message.
+ */
+      void attach(const char *data, long n);
+
+/*! \brief Exchanges the contents of the message with the contents of \a rhs.
+ *
+ *   Only the buffers are exchanged, such that a message can be handed
+ *   over to another thread without copying it.
+ */
+      void swap(ABA_MESSAGE &rhs);
+
+    private:
+
+/*! Appends the \a n bytes of \a data to the message.
+ */
+      void append(const void *data, long n);
+
+/*! Copies the next \a n bytes of the message to \a data.
+ */
+      void extract(void *data, long n);
+
+/*! Enlarges the buffer such that at least \a n bytes can be stored.
+ */
+      void realloc(long n);
+
+/*! A pointer to the corresponding global object.
+ */
+      ABA_GLOBAL *glob_;
+
+/*! The buffer.
+ */
+      char *buf_;
+
+/*! \a true if the buffer has been allocated by the message,
+ *   \a false if the data has been attached.
+ */
+      bool owner_;
+
+/*! The size of the buffer.
+ */
+      long size_;
+
+/*! The number of bytes in the buffer.
+ */
+      long n_;
+
+/*! The position of the next byte which is unpacked.
+ */
+      long pos_;
+
+      ABA_MESSAGE(const ABA_MESSAGE &rhs);
+      const ABA_MESSAGE &operator=(const ABA_MESSAGE &rhs);
+  };
+
+  inline void ABA_MESSAGE::append(const void *data, long n)
+  {
+    if (n_ + n > size_) realloc(n_ + n);
+    memcpy(buf_ + n_, data, n);
+    n_ += n;
+  }
+
+  inline void ABA_MESSAGE::extract(void *data, long n)
+  {
+    if (pos_ + n > n_) {
+      glob_->err() << "ABA_MESSAGE::extract(): unpacking beyond the end ";
+      glob_->err() << "of the message." << endl;
+      exit(Fatal);
+    }
+    memcpy(data, buf_ + pos_, n);
+    pos_ += n;
+  }
+
+  inline char *ABA_MESSAGE::packBytes(long n)
+  {
+    if (n_ + n > size_) realloc(n_ + n);
+    n_ += n;
+    return buf_ + n_ - n;
+  }
+
+  inline const char *ABA_MESSAGE::unpackBytes(long n)
+  {
+    if (pos_ + n > n_) {
+      glob_->err() << "ABA_MESSAGE::unpackBytes(): unpacking beyond the end ";
+      glob_->err() << "of the message." << endl;
+      exit(Fatal);
+    }
+    pos_ += n;
+    return buf_ + pos_ - n;
+  }
+
+  inline void ABA_MESSAGE::pack(short x)
+  {
+    append(&x, sizeof(short));
+  }
+
+  inline void ABA_MESSAGE::pack(int x)
+  {
+    append(&x, sizeof(int));
+  }
+
+  inline void ABA_MESSAGE::pack(const ABA_MESSAGE &x)
+  {
+    append(x.buf_, x.n_);
+  }
+
+  inline void ABA_MESSAGE::pack(unsigned x)
+  {
+    append(&x, sizeof(unsigned));
+  }
+
+  inline void ABA_MESSAGE::pack(long x)
+  {
+    append(&x, sizeof(long));
+  }
+
+  inline void ABA_MESSAGE::pack(unsigned long x)
+  {
+    append(&x, sizeof(unsigned long));
+  }
+
+  inline void ABA_MESSAGE::pack(double x)
+  {
+    append(&x, sizeof(double));
+  }
+
+  inline void ABA_MESSAGE::pack(bool x)
+  {
+    char c = x ? 1 : 0;
+    append(&c, 1);
+  }
+
+  inline void ABA_MESSAGE::pack(char x)
+  {
+    append(&x, 1);
+  }
+
+  inline void ABA_MESSAGE::pack(const int *x, int n)
+  {
+    append(x, (long) n*sizeof(int));
+  }
+
+  inline void ABA_MESSAGE::pack(const double *x, int n)
+  {
+    append(x, (long) n*sizeof(double));
+  }
+
+  inline void ABA_MESSAGE::pack(const char *x, int n)
+  {
+    append(x, n);
+  }
+
+  inline void ABA_MESSAGE::unpack(short &x)
+  {
+    extract(&x, sizeof(short));
+  }
+
+  inline void ABA_MESSAGE::unpack(int &x)
+  {
+    extract(&x, sizeof(int));
+  }
+
+  inline void ABA_MESSAGE::unpack(unsigned &x)
+  {
+    extract(&x, sizeof(unsigned));
+  }
+
+  inline void ABA_MESSAGE::unpack(long &x)
+  {
+    extract(&x, sizeof(long));
+  }
+
+  inline void ABA_MESSAGE::unpack(unsigned long &x)
+  {
+    extract(&x, sizeof(unsigned long));
+  }
+
+  inline void ABA_MESSAGE::unpack(double &x)
+  {
+    extract(&x, sizeof(double));
+  }
+
+  inline void ABA_MESSAGE::unpack(bool &x)
+  {
+    char c;
+    extract(&c, 1);
+    x = c ? true : false;
+  }
+
+  inline void ABA_MESSAGE::unpack(char &x)
+  {
+    extract(&x, 1);
+  }
+
+  inline void ABA_MESSAGE::unpack(int *x, int n)
+  {
+    extract(x, (long) n*sizeof(int));
+  }
+
+  inline void ABA_MESSAGE::unpack(double *x, int n)
+  {
+    extract(x, (long) n*sizeof(double));
+  }
+
+  inline void ABA_MESSAGE::unpack(char *x, int n)
+  {
+    extract(x, n);
+  }
+
+  inline int ABA_MESSAGE::unpackInt()
+  {
+    int x;
+    extract(&x, sizeof(int));
+    return x;
+  }
+
+  inline void ABA_MESSAGE::clear()
+  {
+    n_   = 0;
+    pos_ = 0;
+    if (!owner_) size_ = 0;
+  }
+
+  inline long ABA_MESSAGE::length() const
+  {
+    return n_;
+  }
+
+  inline long ABA_MESSAGE::remaining() const
+  {
+    return n_ - pos_;
+  }
+
+  inline const char *ABA_MESSAGE::data() const
+  {
+    return buf_;
+  }
+
+#endif  // ABACUS_PARALLEL
 
 #endif  // ABA_MESSAGE_H
 
@@ -104,6 +104,18 @@
  */
       virtual void increase(int size);
 
+#ifndef ABACUS_PARALLEL
+/*! Replaces the constraints/variables of the pool by the ones
+ * packed by the function ABA_STANDARDPOOL::pack().
+ *
+ * This function redefines the virtual function of the base class
+ * ABA_STANDARDPOOL because we have to rebuild the hash table.
+ *
+ * \param msg The message from which the pool is unpacked.
+ */
+      virtual void unpack(ABA_MESSAGE &msg);
+#endif
+
 /*! \brief Determines the number of constraints that 
  * have not been inserted into the pool, because an equivalent was already
  * present.
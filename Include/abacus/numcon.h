@@ -72,13 +72,12 @@
 
 //! The destructor.
       virtual ~ABA_NUMCON();
-#ifdef ABACUS_PARALLEL
 
 /*! The message constructor creates the constraint from an ABA_MESSAGE.
  *
  *   \param msg The ABA_MESSAGE object from which the constraint is initialized.
  */
-      ABA_NUMCON(const ABA_MASTER *master, ABA_MESSAGE &msg);
+      ABA_NUMCON(ABA_MASTER *master, ABA_MESSAGE &msg);
 
 /*! Packs the data of the constraint in an ABA_MESSAGE object.
  *
@@ -91,7 +90,11 @@
  *   \return The class identification.
  */
       virtual int classId() const;
-#endif
+
+/*! \return Always \a true, since the coefficients are given by the
+ *   columns of the variables.
+ */
+      virtual bool explicitRow() const;
 
 /*! The output operator writes the identification number and the right hand side to an output stream.
  *
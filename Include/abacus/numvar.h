@@ -88,13 +88,12 @@
 
 //! The destructor.
       virtual ~ABA_NUMVAR();
-#ifdef ABACUS_PARALLEL
 
 /*! The message constructor creates the variable from an ABA_MESSAGE.
  *
  *   \param msg  The ABA_MESSAGE object from which the variable is initialized.
  */
-      ABA_NUMVAR(const ABA_MASTER *master, ABA_MESSAGE &msg);
+      ABA_NUMVAR(ABA_MASTER *master, ABA_MESSAGE &msg);
 
 /*! Packs the data of the variable in an ABA_MESSAGE object.
  *
@@ -107,7 +106,6 @@
  *   \return The class identification.
  */
       virtual int classId() const;
-#endif
 
 /*! Writes the number of the variable to an output stream.
  *
@@ -50,6 +50,8 @@ class ABA_SUB;
   class  ABA_OPENSUB :  public ABA_ABACUSROOT  {
   friend class ABA_SUB;
   friend class ABA_MASTER;
+  friend class ABA_CHECKPOINT;
+  friend class ABA_WORKER;
 #ifdef ABACUS_PARALLEL
   friend class ABA_SUBSERVER;
   friend class ABA_PARMASTER;
@@ -126,6 +128,22 @@ class ABA_SUB;
 /*! Removes all elements from the set of opens subproblems.
  */
       void prune();
+#ifndef ABACUS_PARALLEL
+
+/*! \brief Writes the local data of open subproblems to the spill file
+ *   of the master if their estimated memory exceeds \a memoryLimit bytes.
+ *
+ *   The least promising subproblems according to their dual bounds are
+ *   spilled first, until the estimated memory falls below three quarters
+ *   of \a memoryLimit, such that not every new subproblem causes spilling.
+ *
+ *   The data of a processed father is counted once for its unprocessed sons
+ *   which do not have their own data yet.
+ *
+ *   \return The number of spilled subproblems.
+ */
+      int spill(long memoryLimit);
+#endif
 
 /*! \brief Updates the member \a dualBound_ 
  *  according to the dual bounds of the subproblems contained in this set.
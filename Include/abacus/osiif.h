@@ -39,6 +39,7 @@
 #include <CoinBuild.hpp>
 
 class ABA_LPMASTEROSI;
+struct OsiRace;
 
   class  ABA_OSIIF :  public virtual ABA_LP  {
     public:
@@ -99,6 +100,44 @@ class ABA_LPMASTEROSI;
        ****************************************************************/
       OsiSolverInterface *osiLP_;
 
+/*! \brief The interface of the solver type used before the last switch
+ *   between the exact and the approximate solver, or 0.
+ *
+ *   It holds the same linear program as \a osiLP_ and is reused by the next
+ *   switch, such that the matrix is not copied again. Every modification of
+ *   the linear program deletes it.
+ */
+      OsiSolverInterface *standbyLP_;
+
+/*! \brief The last race of the simplex methods if its losing thread has
+ *   not been joined yet, or 0.
+ */
+      OsiRace *race_;
+
+/*! \brief The primal and the dual solution of the last linear program
+ *   solved by the approximate solver, or 0.
+ *
+ *   They are kept if rows or columns are added, which are appended to the
+ *   linear program, since \a xValStatus_ and \a yValStatus_ are reset by
+ *   every modification.
+ */
+      double *approxX_;
+      double *approxY_;
+
+/*! \brief The number of columns and rows of the linear program when
+ *   \a approxX_ and \a approxY_ were stored.
+ */
+      int approxNCol_;
+      int approxNRow_;
+
+/*! \brief Waits for the losing thread of the last race and deletes its
+ *   copy of the linear program.
+ *
+ *   It is called before the next linear program is solved and by the
+ *   destructor, such that at most one losing thread runs at a time.
+ */
+      void joinRace();
+
       /***************************************************
        * Helper functions to free allocated memory
        **************************************************/
@@ -351,6 +390,14 @@ class ABA_LPMASTEROSI;
   */
       virtual void _changeUBound(int i, double newUb);
 
+ /*! Sets the bounds of the columns \a ind to \a lb and \a ub with
+  * a single call of the solver.
+  *
+  * It redefines the virtual function of the base class \a LP.
+  */
+      virtual void _changeBounds(ABA_BUFFER<int> &ind, ABA_BUFFER<double> &lb,
+                                 ABA_BUFFER<double> &ub);
+
  /*! \brief Pivots the slack variables
   * stored in the buffer \a rows into the basis. This function defines
   * the pure virtual function of the base class \a LP.
@@ -405,6 +452,37 @@ class ABA_LPMASTEROSI;
   */
       OsiSolverInterface* switchInterfaces(SOLVERTYPE newMethod);
 
+ /*! \brief Deletes the interface kept by the last switch between
+  *  exact and approximate solvers, as the linear program is modified
+  */
+      void discardStandby();
+
+ /*! \brief Stores the primal and dual solution of the approximate solver
+  *  for the crash basis of the next switch to the exact solver
+  */
+      void saveApprox();
+
+ /*! \brief Deletes the stored solution of the approximate solver, as
+  *  rows or columns are removed or the exact solver takes over
+  */
+      void discardApprox();
+
+ /*! \brief Loads a crash basis constructed from the stored solution of the
+  *  approximate solver into the exact solver
+  *
+  *  Structural variables strictly between their bounds become basic. The
+  *  slack variables of the rows added after the approximate solution had
+  *  been computed are basic, the columns added since then are nonbasic.
+  *  If there are more basic variables than rows, the structural variables
+  *  closest to a bound become nonbasic, and if this is not enough, the
+  *  free ones. The basis is completed with the slack variables of the
+  *  constraints with the smallest absolute dual values. The basis is only
+  *  loaded if it has exactly one basic variable per row.
+  *
+  *  \param exact The interface of the exact solver.
+  */
+      void crashBasis(OsiSolverInterface *exact);
+
  /*! \brief Initializes the problem with a dummy row
   *  To be used with CPLEX if there are no rows
   */
@@ -451,6 +529,58 @@ class ABA_LPMASTEROSI;
  *  \param limit Stores the iteration limit if the return value is 0.
  */
       virtual int _getSimplexIterationLimit(int &limit);
+
+/*! \brief Sets the dual objective limit of the solver interface.
+ *
+ *  It redefines the virtual function of the base class \a LP.
+ *
+ *  \return 0 If the objective limit could be set,
+ *  \return 1 otherwise.
+ *
+ *  \param limit The new objective limit.
+ */
+      virtual int _setObjectiveLimit(double limit);
+
+/*! \brief Determines a dual ray of the infeasible linear program with
+ *  the solver interface.
+ *
+ *  It redefines the virtual function of the base class \a LP.
+ *
+ *  \return 0 If the dual ray could be determined,
+ *  \return 1 otherwise.
+ *
+ *  \param ray Stores the multiplier of each row.
+ */
+      virtual int _getDualRay(double *ray);
+
+/*! \brief Races the primal and the dual simplex method on copies of the
+ *  linear program in two threads.
+ *
+ *  The copy solved first replaces the linear program of the solver
+ *  interface. As the other thread cannot be interrupted by the solver
+ *  interface, it continues in the background until it is joined by
+ *  \a joinRace() before the next linear program is solved. Therefore, the
+ *  LP-solver must be thread-safe. The solver time of the race is the
+ *  elapsed time until the winner has finished, since the cpu time of the
+ *  racing threads is not measured by the cpu timers.
+ *  If no thread can be started, the primal simplex method is used.
+ *
+ *  It redefines the virtual function of the base class \a LP.
+ */
+      virtual OPTSTAT _race();
+
+/*! \return The number of iterations of the solver interface in the last
+ *  optimization.
+ *
+ *  It redefines the virtual function of the base class \a LP.
+ */
+      virtual int _nIterations();
+
+/*! \return false, since Osi implements no barrier method.
+ *
+ *  It redefines the virtual function of the base class \a LP.
+ */
+      virtual bool _barrierAvailable();
       ABA_LPMASTEROSI *lpMasterOsi_;
 
 /*! The value of the optimal solution.
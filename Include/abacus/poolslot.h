@@ -114,6 +114,19 @@ class ABA_ID;
 /*! \return A pointer to the constraint/variable in the pool slot.
  */
       BaseType *conVar() const;
+
+/*! \return A pointer to the pool the slot belongs to.
+ */
+      ABA_POOL<BaseType, CoType> *pool() const;
+
+/*! \return The number of the slot in its ABA_STANDARDPOOL, or -1 if
+ *   the pool of the slot is not an ABA_STANDARDPOOL.
+ */
+      int index() const;
+
+/*! \return The version number of the constraint/variable of the slot.
+ */
+      unsigned long version() const;
 #ifdef ABACUS_PARALLEL
 
 /*! \brief Returns the system wide identification
@@ -169,10 +182,6 @@ class ABA_ID;
  */
       void removeConVarFromPool();
 
-/*! \return The version number of the constraint/variable of the slot.
- */
-      unsigned long version() const;
-
 /*! \return A pointer to the corresponding master of the optimization.
  */
       ABA_MASTER *master();
@@ -192,6 +201,10 @@ class ABA_ID;
       /*! A pointer to the corresponding pool.
        */
       ABA_POOL<BaseType, CoType> *pool_;
+
+      /*! The number of the slot in its ABA_STANDARDPOOL.
+       */
+      int index_;
       ABA_POOLSLOT(const ABA_POOLSLOT<BaseType, CoType> &rhs);
       const ABA_POOLSLOT<BaseType, CoType> 
             &operator=(const ABA_POOLSLOT<BaseType, CoType> &rhs);
@@ -0,0 +1,242 @@
+/*!\file
+ * \author The ABACUS developers
+ * \brief bound propagation of a subproblem.
+ *
+ * The propagator derives bounds of the discrete variables of an active
+ * subproblem from the minimal and maximal activities of the active
+ * constraints which are given by an explicit row
+ * (see ABA_CONSTRAINT::explicitRow()). Let
+ * \f$\sum_j a_j x_j \le \beta\f$ be such a constraint and
+ * \f$\underline{\alpha}\f$ its minimal activity with respect to the local
+ * bounds \f$l\f$ and \f$u\f$ of the variables. Then for \f$a_j > 0\f$ the
+ * upper bound of \f$x_j\f$ can be tightened to
+ * \f$\lfloor(\beta - \underline{\alpha} + a_j l_j)/a_j\rfloor\f$, and
+ * analogously for \f$a_j < 0\f$ and for \f$\ge\f$-constraints.
+ *
+ * \par
+ * The activities are updated incrementally for the variables whose
+ * bounds have changed since the last call, e.g., by branching, fixing,
+ * or setting, and only the affected constraints are processed again.
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#ifndef ABA_PROPAGATOR_H
+#define ABA_PROPAGATOR_H
+
+#include "abacus/abacusroot.h"
+#include "abacus/array.h"
+#include "abacus/buffer.h"
+#include "abacus/csense.h"
+
+class ABA_MASTER;
+class ABA_SUB;
+class ABA_CONSTRAINT;
+class ABA_VARIABLE;
+
+  class  ABA_PROPAGATOR :  public ABA_ABACUSROOT  {
+    public:
+
+/*! \brief The constructor.
+ *
+ *   \param master A pointer to the corresponding master of the optimization.
+ *   \param sub The active subproblem whose bounds are propagated.
+ */
+      ABA_PROPAGATOR(ABA_MASTER *master, ABA_SUB *sub);
+
+//! The destructor.
+      ~ABA_PROPAGATOR();
+
+/*! \brief Tightens the local bounds of the discrete variables of the
+ *   subproblem.
+ *
+ *   If the constraints or the variables of the subproblem have changed
+ *   since the last call, the rows are generated again.
+ *
+ *   \return 0 If no contradiction has been detected,
+ *   \return 1 if the subproblem is infeasible.
+ *
+ *   \param newValues Is set to \a true if a bound has been changed
+ *                    such that the last LP-solution is cut off.
+ */
+      int propagate(bool &newValues);
+
+/*! \return The number of bounds tightened in the last call of \a propagate().
+ */
+      int nTightened() const;
+
+    private:
+
+/*! Generates the rows of the constraints and the activities.
+ */
+      void build();
+
+/*! \return true If the active constraints or variables of the subproblem
+ *                differ from the ones of \a build(),
+ *   \return false otherwise.
+ */
+      bool changed() const;
+
+/*! \brief Updates the activities of the constraints containing variable
+ *   \a j after its bounds have changed and adds them to the queue.
+ */
+      void update(int j);
+
+/*! Computes the activities of the constraint \a r from scratch.
+ */
+      void activity(int r);
+
+/*! \brief Derives new bounds from the constraint \a r.
+ *
+ *   \return 0 If no contradiction has been detected,
+ *   \return 1 otherwise.
+ */
+      int propagateRow(int r, bool &newValues);
+
+/*! \brief Tightens a bound of the discrete variable \a j.
+ *
+ *   If the new bound equals the other bound, the variable is set with
+ *   ABA_SUB::set(). Otherwise, the local bound and the bound in the
+ *   linear program are changed.
+ *
+ *   \return 0 If no contradiction has been detected,
+ *   \return 1 otherwise.
+ *
+ *   \param upper If \a true, \a x is a new upper bound, otherwise a new
+ *                lower bound.
+ */
+      int tighten(int j, bool upper, double x, bool &newValues);
+
+/*! \brief Adds the contributions of the bounds \a lb and \a ub of a variable
+ *   with coefficient \a a to the activities of constraint \a r.
+ *
+ *   \param sign Is 1 for adding and -1 for removing the contributions.
+ */
+      void contribute(int r, double a, double lb, double ub, int sign);
+
+/*! A pointer to the corresponding master of the optimization.
+ */
+      ABA_MASTER *master_;
+
+/*! The subproblem whose bounds are propagated.
+ */
+      ABA_SUB *sub_;
+
+/*! The active constraints when the rows have been generated.
+ */
+      ABA_ARRAY<ABA_CONSTRAINT*> cons_;
+
+/*! The active variables when the rows have been generated.
+ */
+      ABA_ARRAY<ABA_VARIABLE*> vars_;
+
+/*! The number of propagated constraints.
+ */
+      int nRow_;
+
+/*! The beginning of each row in \a rowVar_ and \a rowCoeff_.
+ */
+      ABA_ARRAY<int> rowBeg_;
+
+/*! The variables of the nonzeros of the rows.
+ */
+      ABA_ARRAY<int> rowVar_;
+
+/*! The coefficients of the nonzeros of the rows.
+ */
+      ABA_ARRAY<double> rowCoeff_;
+
+/*! The beginning of each column in \a colRow_ and \a colCoeff_.
+ */
+      ABA_ARRAY<int> colBeg_;
+
+/*! The rows of the nonzeros of the columns.
+ */
+      ABA_ARRAY<int> colRow_;
+
+/*! The coefficients of the nonzeros of the columns.
+ */
+      ABA_ARRAY<double> colCoeff_;
+
+/*! The sense of each row.
+ */
+      ABA_ARRAY<ABA_CSENSE::SENSE> sense_;
+
+/*! The right hand side of each row.
+ */
+      ABA_ARRAY<double> rhs_;
+
+/*! The finite part of the minimal activity of each row.
+ */
+      ABA_ARRAY<double> minAct_;
+
+/*! The finite part of the maximal activity of each row.
+ */
+      ABA_ARRAY<double> maxAct_;
+
+/*! The number of infinite contributions to the minimal activity of each row.
+ */
+      ABA_ARRAY<int> minInf_;
+
+/*! The number of infinite contributions to the maximal activity of each row.
+ */
+      ABA_ARRAY<int> maxInf_;
+
+/*! The lower bounds of the variables included in the activities.
+ */
+      ABA_ARRAY<double> lBound_;
+
+/*! The upper bounds of the variables included in the activities.
+ */
+      ABA_ARRAY<double> uBound_;
+
+/*! The rows which have to be processed.
+ */
+      ABA_BUFFER<int> queue_;
+
+/*! \a true if the row is contained in \a queue_.
+ */
+      ABA_ARRAY<bool> inQueue_;
+
+/*! The number of bounds tightened in the last call of \a propagate().
+ */
+      int nTightened_;
+
+      ABA_PROPAGATOR(const ABA_PROPAGATOR &rhs);
+      const ABA_PROPAGATOR &operator=(const ABA_PROPAGATOR &rhs);
+  };
+
+inline int ABA_PROPAGATOR::nTightened() const
+  {
+    return nTightened_;
+  }
+
+#endif  // ABA_PROPAGATOR_H
+
+/*! \class ABA_PROPAGATOR
+ *  \brief bound propagation of a subproblem
+ */
@@ -94,7 +94,6 @@
 
 //! The destructor.
       ~ABA_ROW();
-#ifdef ABACUS_PARALLEL
 
 /*! \brief The message constructor
  *    creates the row from an ABA_MESSAGE.
@@ -112,7 +111,6 @@
  *   \param msg The ABA_MESSAGE object in which the row is packed.
  */
       void pack(ABA_MESSAGE &msg) const;
-#endif
 
 /*! \brief The output operator
  *   writes the row on an output stream in format like {\tt -2.5 x1 + 3 x3 <= 7}.
@@ -166,6 +164,13 @@
  */
       void copy(const ABA_ROW &row);
 
+/*! \brief Exchanges the nonzeros, the sense, and the right hand side of
+ *   this row and of \a row without copying any nonzero.
+ *
+ *   \param row The row being exchanged with this row.
+ */
+      void swap(ABA_ROW &row);
+
 /*! \brief Removes the indices listed in \a buf
  *   from the support of the row and subtracts \a rhsDelta from
  *   its right hand side.
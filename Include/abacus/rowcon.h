@@ -98,14 +98,13 @@
 
 //! The destructor.
       virtual ~ABA_ROWCON();
-#ifdef ABACUS_PARALLEL
 
 /*! \brief The message constructor
  *   creates the constraint from an ABA_MESSAGE.
  *
  *   \param msg The ABA_MESSAGE object from which the constraint is initialized.
  */
-      ABA_ROWCON(const ABA_MASTER *master, ABA_MESSAGE &msg);
+      ABA_ROWCON(ABA_MASTER *master, ABA_MESSAGE &msg);
 
 /*! Packs the data of the constraint in an ABA_MESSAGE object.
  *
@@ -118,7 +117,10 @@
  *   \return The class identification.
  */
       virtual int classId() const;
-#endif
+
+/*! \return Always \a true, since the constraint is given by its row.
+ */
+      virtual bool explicitRow() const;
 
 /*! \brief Computes the coefficient of a variable which
  *   must be of type ABA_NUMVAR.
@@ -134,6 +136,22 @@
  */
       virtual double coeff(ABA_VARIABLE *v);
 
+/*! Computes the slack of a vector associated with the variable set \a variables.
+ *
+ *   It redefines the virtual function \a slack() of the base class
+ *   ABA_CONSTRAINT. The vector is stored by the numbers of the variables,
+ *   such that the left hand side is the sparse scalar product
+ *   \a ABA_SPARVEC::dot() of the row and the vector, instead of a call of
+ *   \a coeff() for each variable.
+ *
+ *   \return The slack of the vector \a x.
+ *
+ *   \param variables The variable set, all variables must be of type ABA_NUMVAR.
+ *   \param x An array of length equal to the number of variables.
+ */
+      virtual double slack(ABA_ACTIVE<ABA_VARIABLE, ABA_CONSTRAINT> *variables,
+                           double *x);
+
 /*! Writes the row format of the constraint on an output stream.
  *
  *   It redefines the virtual function \a print() of the base class
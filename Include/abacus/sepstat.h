@@ -0,0 +1,226 @@
+/*!\file
+ * \author The ABACUS developers
+ * \brief statistics of the separators.
+ *
+ * For each separator the number of calls, the number of generated cutting
+ * planes, the cpu time, and the improvement of the dual bound are recorded,
+ * separately for the root node. The improvement of the dual bound by the
+ * linear program following a separation round is attributed to the
+ * separators of the round in proportion to the number of cutting planes
+ * they have generated. With these statistics the cutting plane algorithm
+ * of the subproblems below the root skips separators, whose improvement
+ * of the dual bound per second in the root is small (see
+ * ABA_SUB::startSeparator()), and stops cutting if the improvement per
+ * second falls below a share of the average of the root.
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#ifndef ABA_SEPSTAT_H
+#define ABA_SEPSTAT_H
+
+#include "abacus/abacusroot.h"
+#include "abacus/array.h"
+
+class ABA_MASTER;
+
+  class  ABA_SEPSTAT :  public ABA_ABACUSROOT  {
+    public:
+
+/*! The separators known to the framework.
+ *
+ *   \param Pool The separation from the pool of cutting planes
+ *               (see ABA_SUB::constraintPoolSeparation()).
+ *   \param FirstUser The first number of a problem specific separator.
+ */
+      enum SEPARATOR {Pool, FirstUser};
+
+/*! \brief The constructor.
+ *
+ *   \param master A pointer to the corresponding master of the optimization.
+ */
+      ABA_SEPSTAT(ABA_MASTER *master);
+
+//! The destructor.
+      ~ABA_SEPSTAT();
+
+/*! \brief The output operator writes the statistics of each separator
+ *   to an output stream.
+ *
+ *   \return A reference to the output stream.
+ *
+ *   \param out The output stream.
+ *   \param rhs The statistics being output.
+ */
+      friend ostream &operator<<(ostream &out, const ABA_SEPSTAT &rhs);
+
+/*! \brief Gives a separator a name for the output of the statistics.
+ *
+ *   Separators without a name are output with their number.
+ *
+ *   \param separator The number of the separator, at least \a FirstUser.
+ *   \param name The name of the separator. The string is not copied and
+ *               must exist as long as the statistics.
+ */
+      void registerSeparator(int separator, const char *name);
+
+/*! \return The name of the separator, or 0 if no name has been registered.
+ *
+ *   \param separator The number of the separator.
+ */
+      const char *name(int separator) const;
+
+/*! \brief Starts a separator.
+ *
+ *   \param separator The number of the separator.
+ *   \param nBuffered The number of cutting planes in the buffer of the
+ *                    subproblem before the separator is called.
+ */
+      void start(int separator, int nBuffered);
+
+/*! \brief Stops a separator and records its time and cutting planes.
+ *
+ *   \param separator The number of the separator.
+ *   \param nBuffered The number of cutting planes in the buffer of the
+ *                    subproblem after the separator has been called.
+ *   \param root If \a true, the separator has been called in the root node.
+ */
+      void stop(int separator, int nBuffered, bool root);
+
+/*! \brief Records the number of cutting planes generated by the
+ *   whole separation round.
+ *
+ *   \param nCuts The number of cutting planes.
+ */
+      void round(int nCuts);
+
+/*! \brief Attributes the improvement of the dual bound by the linear
+ *   program following the last separation round to its separators.
+ *
+ *   \param gain The improvement of the dual bound in percent.
+ *   \param centiSeconds The cpu time of the separation round and the
+ *                       linear program.
+ *   \param root If \a true, the round has been performed in the root node.
+ */
+      void attribute(double gain, long centiSeconds, bool root);
+
+/*! \brief Forgets the last separation round without attributing an
+ *   improvement of the dual bound to it.
+ */
+      void clearRound();
+
+/*! \return The average improvement of the dual bound per second of
+ *           the cutting plane algorithm in the root node, or 0 if the root
+ *           has not performed a separation round.
+ */
+      double rootRate() const;
+
+/*! \brief Checks if a separator should be called below the root node.
+ *
+ *   \return true If the separator has not been called in the root, or
+ *                its improvement of the dual bound per second has been
+ *                at least \a share times rootRate(),
+ *   \return false otherwise.
+ *
+ *   \param separator The number of the separator.
+ *   \param share The share of the average rate of the root.
+ */
+      bool profitable(int separator, double share) const;
+
+/*! \return The improvement of the dual bound per second.
+ *
+ *   As the cpu time is measured in centi seconds, at least one centi second
+ *   is assumed.
+ *
+ *   \param gain The improvement of the dual bound.
+ *   \param centiSeconds The cpu time in centi seconds.
+ */
+      static double rate(double gain, long centiSeconds);
+
+    private:
+
+/*! \brief Enlarges the arrays such that the statistics of \a separator
+ *   can be stored.
+ */
+      void realloc(int separator);
+
+/*! A pointer to the corresponding master of the optimization.
+ */
+      ABA_MASTER *master_;
+
+/*! The number of separators for which statistics are stored.
+ */
+      int nSeparators_;
+
+/*! The cpu time and the number of buffered cutting planes when the
+ *   separator has been started.
+ */
+      ABA_ARRAY<long> startTime_;
+      ABA_ARRAY<int>  startCuts_;
+
+/*! The number of calls, generated cutting planes, cpu time in centi
+ *   seconds, and attributed improvement of the dual bound of each separator.
+ */
+      ABA_ARRAY<int>    nCalls_;
+      ABA_ARRAY<int>    nCuts_;
+      ABA_ARRAY<long>   centiSeconds_;
+      ABA_ARRAY<double> gain_;
+
+/*! The cpu time and the attributed improvement of the dual bound of each
+ *   separator in the root node.
+ */
+      ABA_ARRAY<long>   rootCentiSeconds_;
+      ABA_ARRAY<double> rootGain_;
+
+/*! The cutting planes generated by each separator in the last
+ *   separation round.
+ */
+      ABA_ARRAY<int> roundCuts_;
+
+/*! The names of the separators given by registerSeparator().
+ */
+      ABA_ARRAY<const char*> name_;
+
+/*! The cutting planes generated by the whole last separation round.
+ */
+      int roundTotal_;
+
+/*! The cpu time of the cutting plane algorithm and the improvement of the
+ *   dual bound in the root node.
+ */
+      long   rootTime_;
+      double rootGainTotal_;
+
+      ABA_SEPSTAT(const ABA_SEPSTAT &rhs);
+      const ABA_SEPSTAT &operator=(const ABA_SEPSTAT &rhs);
+  };
+
+#endif  // ABA_SEPSTAT_H
+
+/*! \class ABA_SEPSTAT
+ *  \brief statistics of the separators
+ */
@@ -36,9 +36,7 @@
 #include "abacus/branchrule.h"
 #include "abacus/fsvarstat.h"
 
-#ifdef ABACUS_PARALLEL
 class ABA_MESSAGE;
-#endif
 
   class  ABA_SETBRANCHRULE :  public ABA_BRANCHRULE  { 
     public: 
@@ -55,7 +53,6 @@ class ABA_MESSAGE;
 
 //! The destructor.
       virtual ~ABA_SETBRANCHRULE();
-#ifdef ABACUS_PARALLEL
 
 /*! \brief The message constructor
  *   creates the ABA_SETBRANCHRULE from an ABA_MESSAGE.
@@ -65,7 +62,7 @@ class ABA_MESSAGE;
  *     \param
  *       msg The message from which the object is initialized.
  */
-      ABA_SETBRANCHRULE(const ABA_MASTER *master, ABA_MESSAGE &msg);
+      ABA_SETBRANCHRULE(ABA_MASTER *master, ABA_MESSAGE &msg);
 
 /*! Packs the data of the ABA_SETBRANCHRULE in an ABA_MESSAGE object.
  *  
@@ -84,7 +81,6 @@ class ABA_MESSAGE;
  *   \return The class identification.
  */
       virtual int classId() const;
-#endif
 
 /*! \brief The output operator
  *   writes the number of the branching variable and its status on an output stream.
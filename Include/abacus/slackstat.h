@@ -43,9 +43,7 @@ using namespace std;
 
 class ABA_GLOBAL;
 
-#ifdef ABACUS_PARALLEL
 class ABA_MESSAGE;
-#endif
 
   class  ABA_SLACKSTAT :  public ABA_ABACUSROOT  { 
     public: 
@@ -76,21 +74,19 @@ class ABA_MESSAGE;
  *   \param status The slack variable receives the status \a status.
  */
       ABA_SLACKSTAT(const ABA_GLOBAL *glob, STATUS status);
-#ifdef ABACUS_PARALLEL
 
 /*! The message constructor creates the status from a message.
  *
  *     \param glob A pointer to a global object.
  *     \param msg The message from which the object is initialized.
  */
-      ABA_SLACKSTAT(const ABA_GLOBAL *glob, ABA_MESSAGE &msg);
+      ABA_SLACKSTAT(ABA_GLOBAL *glob, ABA_MESSAGE &msg);
 
 /*! Packs the data of the status in a message.
  *
  *   \param msg The ABA_MESSAGE object in which the status is packed.
  */
       void pack(ABA_MESSAGE &msg) const;
-#endif
 
 /*! \brief The output operator
  *   writes the status to an output stream in the
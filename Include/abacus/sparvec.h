@@ -43,9 +43,7 @@
 #include "abacus/array.h"
 #include "abacus/buffer.h"
 
-#ifdef ABACUS_PARALLEL
 class ABA_MESSAGE;
-#endif
 
   class  ABA_SPARVEC :  public ABA_ABACUSROOT  {
     public:
@@ -58,7 +56,10 @@ class ABA_MESSAGE;
  *  \param reallocFac The reallocation factor (in percent of the
  *     original size), which is used in a default reallocation if a variable
  *     is inserted when the sparse vector is already full. Its default value
- *     is 10.  
+ *     is 10. This factor is the only growth rule of the sparse vector,
+ *     i.e., a default reallocation increases the size by \a reallocFac
+ *     percent plus one element, and also \a reserve() increases it at
+ *     least by this amount.
  *
  * If no memory for \a support_ and \a coeff_ is
  * allocated then an automatic allocation will be performed when the
@@ -85,7 +86,8 @@ class ABA_MESSAGE;
  *       \param reallocFac The reallocation factor (in percent of the original
  *                     size), which is used in a default reallocation if
  *                     a variable is inserted when the sparse vector is already
- *                     full. Its default value is 10.
+ *                     full. Its default value is 10. It determines the
+ *                     growth as in the previous constructor.
  *
  *   If \a size is 0, then also no elements are copied in the \a for-loop
  *   since \a nnz_ will be also 0.
@@ -114,7 +116,6 @@ class ABA_MESSAGE;
 
 //! The destructor.
       ~ABA_SPARVEC();
-#ifdef ABACUS_PARALLEL
 
 /*! The message constructor creates the sparse vector from an ABA_MESSAGE.
  *
@@ -123,7 +124,7 @@ class ABA_MESSAGE;
  *     \param
  *       msg The message from which the object is initialized.
  */
-      ABA_SPARVEC(const ABA_GLOBAL *glob, ABA_MESSAGE &msg);
+      ABA_SPARVEC(ABA_GLOBAL *glob, ABA_MESSAGE &msg);
 
 /*! Packs the data of the sparse vector in an ABA_MESSAGE object.
  *
@@ -131,7 +132,6 @@ class ABA_MESSAGE;
  *                  is packed.
  */
       void pack(ABA_MESSAGE &msg) const;
-#endif
 
 /*! \brief The assignment operator
  *   requires that the left hand and the
@@ -237,10 +237,33 @@ class ABA_MESSAGE;
  */
       double norm();
 
-/*! Increases the size of the sparse vector by \a reallocFac_ percent of the original size. 
+/*! \brief Computes the scalar product of the sparse vector with a
+ *   dense vector.
+ *
+ *   The loop gathers the components of \a x in blocks of four
+ *   elements with independent partial sums, such that the
+ *   multiplications are not serialized by the additions. Therefore,
+ *   the result can differ in the last bits from the sum in the order
+ *   of the nonzeros.
+ *
+ *   \return The sum of \a coeff(i) * \a x[support(i)] over all nonzeros.
+ *   \param x The dense vector. It must have at least a length
+ *                equal to the maximal element in the support plus 1.
+ */
+      double dot(const double *x) const;
+
+/*! \brief This version of \a dot()
+ *   computes the scalar product with a dense vector stored in an ABA_ARRAY.
+ */
+      double dot(const ABA_ARRAY<double> &x) const;
+
+/*! \brief Increases the size of the sparse vector by \a reallocFac_ percent
+ *   of the original size plus one element.
  *
  *   This function is
- *   called if an automatic reallocation takes place.
+ *   called if an automatic reallocation takes place. Because the size
+ *   grows geometrically for a positive \a reallocFac_, a sparse vector
+ *   built by \a insert() is reallocated only a logarithmic number of times.
  */
       void realloc();
 
@@ -254,6 +277,25 @@ class ABA_MESSAGE;
  *                      stored in the sparse vector.
  */
       void realloc(int newSize);
+
+/*! \brief Enlarges the sparse vector such that at least \a newSize
+ *   nonzeros can be stored without reallocation.
+ *
+ *   If a reallocation is necessary, the size is increased at least as in
+ *   the default reallocation with \a realloc(), i.e., by \a reallocFac_
+ *   percent. The sparse vector is never shortened.
+ *
+ *   \param newSize The minimal number of nonzeros that can be stored.
+ */
+      void reserve(int newSize);
+
+/*! \brief Exchanges the support, the coefficients, the sizes, and the
+ *   reallocation factors of the sparse vector and of \a rhs without
+ *   copying any nonzero.
+ *
+ *   \param rhs The sparse vector being exchanged with this sparse vector.
+ */
+      void swap(ABA_SPARVEC &rhs);
     protected:
 
 /*! \brief Terminates the program with an error message if \a i is negative
@@ -283,7 +325,7 @@ class ABA_MESSAGE;
 
       /*! \brief If a new element is inserted but the sparse
        *  vector is full, then its size is increased
-       *  by \a reallocFac_ percent.
+       *  by \a reallocFac_ percent plus one element.
        */
       double reallocFac_;
 
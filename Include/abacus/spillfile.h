@@ -0,0 +1,145 @@
+/*!\file
+ * \author The ABACUS developers
+ * \brief file for the local data of spilled subproblems.
+ *
+ * If the parameter {\tt SpillMemory} is positive and the estimated memory
+ * of the local data of the open subproblems exceeds this limit, then the
+ * local data of the least promising open subproblems is written to a
+ * spill file and deleted (see ABA_OPENSUB::spill()). It is read back when
+ * such a subproblem is selected for processing.
+ *
+ * \par
+ * Each record is an ABA_MESSAGE as written by ABA_MESSAGE::write(). The
+ * space of removed records is reused by later records (first fit), such
+ * that the size of the file is bounded by the largest amount of spilled
+ * data plus fragmentation.
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#ifndef ABA_SPILLFILE_H
+#define ABA_SPILLFILE_H
+
+#include "abacus/abacusroot.h"
+#include "abacus/string.h"
+#include "abacus/buffer.h"
+
+#include <stdio.h>
+
+class ABA_MASTER;
+class ABA_MESSAGE;
+
+  class  ABA_SPILLFILE :  public ABA_ABACUSROOT  {
+    public:
+
+/*! \brief The constructor
+ *   creates the spill file.
+ *
+ *   \param master A pointer to the corresponding master of the optimization.
+ *   \param fileName The name of the spill file.
+ */
+      ABA_SPILLFILE(ABA_MASTER *master, const char *fileName);
+
+/*! The destructor closes and removes the spill file.
+ */
+      ~ABA_SPILLFILE();
+
+/*! \brief Writes a message to the spill file.
+ *
+ *   \return The position of the record in the file.
+ *
+ *   \param msg The message which is written.
+ *   \param size Is set to the number of bytes reserved for the record.
+ *               It has to be passed to \a remove().
+ */
+      long write(const ABA_MESSAGE &msg, long &size);
+
+/*! Reads the record at position \a offset into the message \a msg.
+ */
+      void read(long offset, ABA_MESSAGE &msg);
+
+/*! Releases the \a size bytes of the record at position \a offset.
+ */
+      void remove(long offset, long size);
+
+/*! \return The number of bytes of the records in the spill file.
+ */
+      long used() const;
+
+/*! \return The size of the spill file in bytes.
+ */
+      long size() const;
+
+    private:
+
+/*! A pointer to the corresponding master of the optimization.
+ */
+      ABA_MASTER *master_;
+
+/*! The name of the spill file.
+ */
+      ABA_STRING fileName_;
+
+/*! The spill file.
+ */
+      FILE *file_;
+
+/*! The size of the spill file.
+ */
+      long size_;
+
+/*! The number of bytes of the records in the spill file.
+ */
+      long used_;
+
+/*! The positions of the free parts of the file.
+ */
+      ABA_BUFFER<long> freeOffset_;
+
+/*! The sizes of the free parts of the file.
+ */
+      ABA_BUFFER<long> freeSize_;
+
+      ABA_SPILLFILE(const ABA_SPILLFILE &rhs);
+      const ABA_SPILLFILE &operator=(const ABA_SPILLFILE &rhs);
+  };
+
+inline long ABA_SPILLFILE::used() const
+  {
+    return used_;
+  }
+
+inline long ABA_SPILLFILE::size() const
+  {
+    return size_;
+  }
+
+#endif  // ABA_SPILLFILE_H
+
+/*! \class ABA_SPILLFILE
+ *  \brief file for the local data of spilled subproblems
+ */
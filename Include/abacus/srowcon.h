@@ -93,14 +93,13 @@
 
 //! The destructor.
       virtual ~ABA_SROWCON();
-#ifdef ABACUS_PARALLEL
 
 /*! \brief The message constructor
  *   creates the constraint from an ABA_MESSAGE.
  *
  *   \param msg The ABA_MESSAGE object from which the constraint is initialized.
  */
-      ABA_SROWCON(const ABA_MASTER *master, ABA_MESSAGE &msg);
+      ABA_SROWCON(ABA_MASTER *master, ABA_MESSAGE &msg);
 
 /*! Packs the data of the constraint in an ABA_MESSAGE object.
  *
@@ -117,7 +116,6 @@
  *   \return The class identification.
  */
       virtual int classId() const;
-#endif
 
 /*! \brief Generates the row format of the constraint
  *   associated with the variable set \a var.
@@ -42,9 +42,7 @@
 #include "abacus/list.h"
 #include "abacus/pool.h"
 
-#ifdef ABACUS_PARALLEL
 class ABA_MESSAGE;
-#endif
 
 #ifdef ABACUS_NEW_TEMPLATE_SYNTAX
 template<class BaseType, class CoType>
@@ -84,13 +82,36 @@ public:
  * \param master A pointer to the corresponding master of the optimization.
  * \param msg The message from which the object is initialized.
  */
-  ABA_STANDARDPOOL(const ABA_MASTER*master,ABA_MESSAGE&msg);
+  ABA_STANDARDPOOL(ABA_MASTER*master,ABA_MESSAGE&msg);
 
 /*! Packs all data of the pool in an ABA_MESSAGE object.
  *
  * \param msg The ABA_MESSAGE object in which the pool is packed.
  */
   void pack(ABA_MESSAGE&msg)const;
+#else
+
+/*! Packs the constraints/variables of the pool in an ABA_MESSAGE object.
+ *
+ * The number of the slot of each constraint/variable is preserved if the
+ * pool is restored by the function \a unpack().
+ *
+ * \param msg The ABA_MESSAGE object in which the pool is packed.
+ */
+  void pack(ABA_MESSAGE&msg)const;
+
+/*! Replaces the constraints/variables of the pool by the ones
+ * packed in an ABA_MESSAGE object by the function \a pack().
+ *
+ * \warning The constraints/variables currently in the pool are deleted.
+ * Therefore, they must not be referenced.
+ *
+ * The function is virtual such that a derived pool can rebuild its own
+ * data structures, e.g., the hash table of an ABA_NONDUPLPOOL.
+ *
+ * \param msg The message from which the pool is unpacked.
+ */
+  virtual void unpack(ABA_MESSAGE&msg);
 #endif
 #ifdef ABACUS_NEW_TEMPLATE_SYNTAX
 
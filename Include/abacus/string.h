@@ -39,9 +39,7 @@ using namespace std;
 
 class ABA_GLOBAL;
 
-#ifdef ABACUS_PARALLEL
 class ABA_MESSAGE;
-#endif
   class  ABA_STRING :  public ABA_ABACUSROOT  {
     public:
 
@@ -72,7 +70,6 @@ class ABA_MESSAGE;
 
 //! The destructor.
       ~ABA_STRING();
-#ifdef ABACUS_PARALLEL
 
 /*! \brief The message constructor
  *   creates the ABA_STRING from an ABA_MESSAGE.
@@ -92,7 +89,6 @@ class ABA_MESSAGE;
  *   \param msg The ABA_MESSAGE object in which the string is packed.
  */
       void pack(ABA_MESSAGE &msg) const;
-#endif
 
 /*! \brief The assignment operator
  *   makes a copy of the right hand side and reallocates memory if required.
@@ -47,6 +47,7 @@
 #include "abacus/list.h"
 #include "abacus/bstack.h"
 #include "abacus/lp.h"
+#include "abacus/lpmethodstat.h"
 #include "abacus/fsvarstat.h"
 #include "abacus/buffer.h"
 #include "abacus/vartype.h"
@@ -54,6 +55,7 @@
 
 class ABA_LPSUB;
 class ABA_TAILOFF;
+class ABA_PROPAGATOR;
 class ABA_BRANCHRULE;
 class ABA_LPVARSTAT;
 class ABA_VARIABLE;
@@ -66,15 +68,20 @@ template<class BaseType, class CoType> class ABA_POOL;
 template<class BaseType, class CoType> class ABA_POOLSLOT;
 template<class BaseType, class CoType> class ABA_LPSOLUTION;
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
+
+#ifdef ABACUS_PARALLEL
 #include "abacus/id.h"
 #include "abacus/subserver.h"
 #endif
 
   class  ABA_SUB :  public ABA_ABACUSROOT  {
     friend class ABA_MASTER;
+    friend class ABA_CHECKPOINT;
+    friend class ABA_WORKER;
     friend class ABA_BOUNDBRANCHRULE;
+    friend class ABA_PROPAGATOR;
+    friend class ABA_DIVER;
     friend class ABA_OPENSUB;
     friend class ABA_LPSOLUTION<ABA_CONSTRAINT, ABA_VARIABLE>;
     friend class ABA_LPSOLUTION<ABA_VARIABLE, ABA_CONSTRAINT>;
@@ -192,6 +199,36 @@ template<class BaseType, class CoType> class ABA_LPSOLUTION;
  *   \param msg The ABA_MESSAGE object in which the subproblem is packed.
  */
       virtual void pack(ABA_MESSAGE &msg) const;
+#else
+
+/*! \brief The message constructor
+ *   restores an open subproblem from an ABA_MESSAGE written by \a pack(),
+ *   e.g., when the optimization is restarted from a checkpoint.
+ *
+ *   The active constraints and variables must already be available in the
+ *   default pools of the master. The father of the subproblem is not
+ *   restored and has to be set by the caller.
+ *
+ *   \param master A pointer to the corresponding master of the optimization.
+ *   \param msg The ABA_MESSAGE object from which the subproblem is initialized.
+ */
+      ABA_SUB(ABA_MASTER *master, ABA_MESSAGE &msg);
+
+/*! Packs the data of an open subproblem in an ABA_MESSAGE object.
+ *
+ *   This virtual function has to be redefined
+ *   in a derived class if additional data should be packed. In this
+ *   case the \a pack() function of the base class must be called
+ *   by the \a pack() function of the derived class.
+ *
+ *   An unprocessed subproblem does not have its own active sets yet.
+ *   Then the active sets and the local data of the father are packed
+ *   together with the branching rule, such that the message constructor
+ *   yields a subproblem which can be activated without its father.
+ *
+ *   \param msg The ABA_MESSAGE object in which the subproblem is packed.
+ */
+      virtual void pack(ABA_MESSAGE &msg) const;
 #endif
 
 /*! \return Whether using the exact solver is forced.
@@ -213,6 +250,12 @@ template<class BaseType, class CoType> class ABA_LPSOLUTION;
  */
       STATUS status() const;
 
+/*! \return true If the local data of the subproblem has been written
+ *                   to the spill file of the master,
+ *   \return false otherwise.
+ */
+      bool spilled() const;
+
 /*! \return The number of active variables.
  */
       int nVar() const;
@@ -810,6 +853,20 @@ template<class BaseType, class CoType> class ABA_LPSOLUTION;
  */
       double lpRankBranchingRule(ABA_BRANCHRULE *branchRule, int iterLimit = -1);
 
+/*! \brief Computes the objective limit passed to the LP-solver.
+ *
+ *   If the value of the linear program is worse than the limit, the
+ *   subproblem can be fathomed, hence the dual simplex method can be stopped.
+ *   The limit takes into account the tolerance of
+ *   ABA_MASTER::primalViolated() and integer objective function values.
+ *
+ *   \return The objective limit, or an infinite value if no feasible
+ *   solution is known, the parameter {\tt ObjectiveCutoff} is \a false, or
+ *   variables are generated, since then the value of the linear program
+ *   is no dual bound.
+ */
+      virtual double objectiveLimit();
+
 /*! Compares the ranks of two branching samples.
  *
  *   For maximimization problem that rank
@@ -1039,6 +1096,31 @@ template<class BaseType, class CoType> class ABA_LPSOLUTION;
  */
       virtual int separate();
 
+/*! \brief Starts a problem specific separator within \a separate().
+ *
+ *   The statistics of the separators (see ABA_SEPSTAT) record the cpu time
+ *   and the cutting planes of the separator until \a stopSeparator() is
+ *   called. If the parameter {\tt AdaptiveCutting} is positive, a separator
+ *   whose improvement of the dual bound per second has been small in the
+ *   root node is skipped in the other subproblems, unless the solution of
+ *   the linear program is integral.
+ *
+ *   \return true If the separator should be called,
+ *   \return false if it should be skipped. Then \a stopSeparator() must not
+ *                 be called.
+ *
+ *   \param separator The number of the separator, at least
+ *                    ABA_SEPSTAT::FirstUser.
+ */
+      bool startSeparator(int separator);
+
+/*! \brief Stops a problem specific separator started with
+ *   \a startSeparator().
+ *
+ *   \param separator The number of the separator.
+ */
+      void stopSeparator(int separator);
+
 /*! \brief Can be used as an entry point for
  *   application specific elimination of constraints by redefinig it
  *   in derived classes. 
@@ -1160,10 +1242,18 @@ template<class BaseType, class CoType> class ABA_LPSOLUTION;
 /*! Controls the method used to solve a linear programming relaxation.
  *
  *   The default implementation
- *   chooses the barrier method for the first linear program of the root
+ *   chooses the primal simplex method for the first linear program of the root
  *   node and for all other linear programs it tries to choose a method
  *   such that phase 1 of the simplex method is not required.
  *
+ * \par
+ *   If the parameter {\tt LpMethodSelection} is {\tt Adaptive}, this
+ *   choice is only preferred, and the method is chosen by the statistics of
+ *   the cpu times of the methods in the same situation
+ *   (see ABA_LPMETHODSTAT). If the parameter {\tt LpRace} is \a true,
+ *   the first linear program of the root node is solved by the method
+ *   ABA_LP::Race.
+ *
  *   \return The method the next linear programming relaxation is solved with.
  *
  *   \param nVarRemoved The number of removed variables.
@@ -1296,6 +1386,22 @@ template<class BaseType, class CoType> class ABA_LPSOLUTION;
  */
       virtual int setByRedCost();
 
+/*! \brief Tightens the bounds of discrete variables according to the
+ *   reduced cost criterion.
+ *
+ *   If a nonbasic discrete variable at its lower bound \f$l_i\f$ has the
+ *   reduced cost \f$d_i\f$, then each unit it is increased deteriorates the
+ *   value of the linear program by \f$|d_i|\f$. Hence, its upper bound
+ *   can be decreased to \f$l_i + \lfloor g/|d_i|\rfloor\f$, where \f$g\f$ is
+ *   the gap between the value of the linear program and the primal bound.
+ *   The same holds for variables at their upper bounds. This generalizes
+ *   \a setByRedCost() to variables with wide domains. The bounds of
+ *   the linear program are changed at once by \a updateBoundInLp().
+ *
+ *   \return The number of tightened bounds.
+ */
+      virtual int tightenByRedCost();
+
 /*! Fathoms a node and recursively tries to fathom its father.
  *
  *   If the root of the remaining \bac\ tree is fathomed we are done
@@ -1644,7 +1750,9 @@ template<class BaseType, class CoType> class ABA_LPSOLUTION;
 /*! \return True, if the approximative solver should be used to solve
  * the next linear program, false otherwise.
  *
- * The default implementation always returns false.
+ * The default implementation returns true only for the first linear
+ * program of the root node. Its approximate solution provides the crash
+ * basis of the exact solver (see ABA_OSIIF::switchInterfaces()).
  */
       virtual bool solveApproxNow();
 
@@ -1702,6 +1810,11 @@ template<class BaseType, class CoType> class ABA_LPSOLUTION;
        */
       ABA_TAILOFF *tailOff_;
 
+      /*! A pointer to the bound propagation, or 0 if it has not been
+       *  performed yet in the active subproblem.
+       */
+      ABA_PROPAGATOR *propagator_;
+
       /*! The dual bound of the subproblem.
        */
       double dualBound_;
@@ -1830,6 +1943,12 @@ template<class BaseType, class CoType> class ABA_LPSOLUTION;
  *   and we return 1, otherwise we return 0.
  *
  * \par
+ *   Besides the function \a improve(), the diving heuristics are applied
+ *   by \a dive(), and the solution of the linear program is posted to the
+ *   asynchronous primal heuristic (see ABA_HEURSERVER), whose best value
+ *   found so far is taken into account.
+ *
+ * \par
  *   If the upper bound has been initialized with the optimum solution
  *   or with the optimum solution plus/minus one these primal heuristics
  *   are skipped.
@@ -1841,6 +1960,50 @@ template<class BaseType, class CoType> class ABA_LPSOLUTION;
  */
       virtual int _improve(double &primalValue);
 
+/*! \brief Applies the diving heuristics of the class ABA_DIVER to the
+ *   solution of the linear program.
+ *
+ *   The diving heuristics are only applied in the first iteration of
+ *   the cutting plane algorithm of a subproblem whose level minus 1 is a
+ *   multiple of the parameter {\tt DivingFrequency}, and only if no
+ *   variables are generated. If the parameter {\tt DivingStrategy} is
+ *   {\tt Rotating}, the diving heuristic is chosen by the identification
+ *   number of the subproblem.
+ *
+ *   \return 1 If a feasible solution has been found,
+ *   \return 0 otherwise.
+ *
+ *   \param primalValue Holds the value of the feasible solution,
+ *                          if one has been found.
+ */
+      virtual int dive(double &primalValue);
+
+/*! \brief Replaces \a primalValue by \a value if \a status is 0 or
+ *   \a value is better, and sets \a status to 1.
+ */
+      void betterSolution(int &status, double &primalValue, double value);
+
+/*! \brief Checks if the cutting plane algorithm of a subproblem other than
+ *   the root stalls.
+ *
+ *   This is the case if the parameter {\tt AdaptiveCutting} is positive, the
+ *   solution of the linear program is fractional, and the improvement of
+ *   the dual bound per second by the last linear program is less than
+ *   {\tt AdaptiveCutting} times the average of the root node.
+ *
+ *   \return true If the cutting plane algorithm stalls,
+ *   \return false otherwise.
+ */
+      bool cuttingStalls();
+
+/*! \brief Stores the solution of the linear program as best feasible
+ *   solution for guided diving, if its value is not worse than the primal
+ *   bound.
+ *
+ *   \param value The value of the solution.
+ */
+      void storeIncumbent(double value);
+
 /*! \brief Returns 1, if a contradiction has been found,
  *   0 otherwise.
  *
@@ -1858,6 +2021,13 @@ template<class BaseType, class CoType> class ABA_LPSOLUTION;
  */
       virtual void updateBoundInLp(int i);
 
+/*! \brief Adapts the bounds of the variables \a variables in the linear
+ *   program to their local bounds with a single change of the linear program.
+ *
+ *   Eliminated variables are skipped.
+ */
+      virtual void updateBoundInLp(ABA_BUFFER<int> &variables);
+
 /*! \brief Returns the value which the upper and
  *   lower bounds of a variable should take after it is fixed or set.
  */
@@ -1928,6 +2098,71 @@ template<class BaseType, class CoType> class ABA_LPSOLUTION;
  */
       virtual void _deactivate();
 
+/*! Deletes the active constraints and variables together with their
+ *   statuses and bounds.
+ */
+      void deleteLocalData();
+
+#ifndef ABACUS_PARALLEL
+
+/*! \brief Packs the active constraints and variables together with
+ *   their statuses and bounds in an ABA_MESSAGE.
+ *
+ *   If the subproblem is unprocessed and has no own data yet, then the
+ *   data of the father is packed, from which it would be initialized.
+ *   The data of a spilled subproblem is copied from the spill file.
+ */
+      void packLocalData(ABA_MESSAGE &msg) const;
+
+/*! Unpacks the data packed by \a packLocalData().
+ */
+      void unpackLocalData(ABA_MESSAGE &msg);
+
+/*! \return An estimation of the memory in bytes used by the active
+ *   constraints and variables together with their statuses and bounds,
+ *   or 0 if the subproblem has no own data.
+ */
+      long localMemory() const;
+
+/*! \brief Writes the local data of an open subproblem to the spill file
+ *   of the master and deletes it.
+ *
+ *   The active constraints and variables are locked while the subproblem
+ *   is spilled, such that they are not removed from their pools. If
+ *   afterwards no unprocessed son of the father depends on the data of
+ *   the father anymore, the data of the father is deleted, too. This is not
+ *   done if the root of the remaining tree might be reoptimized.
+ *
+ *   \return The estimated number of bytes released.
+ */
+      long spill();
+
+/*! \brief Reads the local data of a spilled subproblem back from the spill
+ *   file and removes the locks set by \a spill().
+ */
+      void unspill();
+
+/*! \brief Locks or unlocks the active constraints and variables of the
+ *   local data of the subproblem.
+ *
+ *   \param lock If \a true, a lock is added to each active constraint and
+ *               variable, otherwise one is removed.
+ */
+      void lockLocalData(bool lock);
+
+/*! \brief Removes the subtree rooted at this subproblem from the
+ *   enumeration tree, since it is processed by another process of a
+ *   distributed optimization.
+ *
+ *   Like \a fathomTheSubTree(), the subproblems get the status \a Fathomed
+ *   and their local data is deleted. But they are neither reported in the
+ *   output nor in the statistics, the dual bounds of the fathers are not
+ *   updated, and no new root of the remaining tree is determined. A father
+ *   whose sons are all fathomed is transferred as well.
+ */
+      void transfer();
+#endif
+
 /*! \brief Tries to add variables
  *   to restore infeasibilities detected at initialization time.
  *
@@ -1969,6 +2204,40 @@ template<class BaseType, class CoType> class ABA_LPSOLUTION;
  */
       virtual int _setByLogImp(bool &newValues);
 
+/*! \brief Tightens the bounds of the discrete variables by the propagation
+ *   of the active constraints given by an explicit row (see ABA_PROPAGATOR).
+ *
+ *   The propagation is only performed if the parameter
+ *   {\tt BoundPropagation} is \a true and no variables are generated,
+ *   since the constraints are only propagated with respect to the
+ *   active variables.
+ *
+ *   \return 0 If no contradiction has been detected,
+ *   \return 1 if the subproblem is infeasible.
+ *
+ *   \param newValues Is set to \a true if a variable is set or bounded
+ *                    such that the last LP-solution is cut off.
+ */
+      virtual int _propagate(bool &newValues);
+
+/*! \brief Derives a conflict constraint from the infeasible linear program
+ *   and inserts it in the cut pool (see ABA_CONFLICTCON).
+ *
+ *   The dual ray of the linear program is aggregated to a globally valid
+ *   constraint, which is violated by the local bounds of the variables.
+ *   As many local bounds as possible are relaxed to the global bounds
+ *   such that the constraint stays violated. If the remaining local bounds
+ *   are those of binary variables, they form a conflict, which is excluded
+ *   from the whole enumeration tree by a conflict constraint.
+ *
+ *   The conflict analysis is only performed if the parameter
+ *   {\tt ConflictAnalysis} is \a true and no variables are generated.
+ *
+ *   \return 1 If a conflict constraint has been generated,
+ *   \return 0 otherwise.
+ */
+      virtual int conflictAnalysis();
+
 /*! Should be called if a subproblem turns out to be infeasible.
  *  
  *   It sets the dual bound of the subproblem correctly.
@@ -2088,12 +2357,27 @@ template<class BaseType, class CoType> class ABA_LPSOLUTION;
        */
       ABA_LP::METHOD lastLP_;
 
+      /*! \brief The situation in which the next linear program is solved,
+       *  or \a NoSituation if its method has not been chosen by
+       *  \a chooseLpMethod().
+       */
+      ABA_LPMETHODSTAT::SITUATION lpSituation_;
+
       ABA_CPUTIMER localTimer_;
 
       /*! \brief Indicates whether to force the use of an exact solver to 
        * prepare branching etc.
        */
       bool forceExactSolver_;
+
+      /*! \brief The position of the local data in the spill file of the
+       *  master, or -1 if the subproblem is not spilled.
+       */
+      long spillOffset_;
+
+      /*! The number of bytes reserved for the subproblem in the spill file.
+       */
+      long spillSize_;
  
       ABA_SUB(const ABA_SUB &rhs);
       const ABA_SUB &operator=(const ABA_SUB &rhs);
@@ -2246,6 +2530,11 @@ inline ABA_SUB::STATUS ABA_SUB::status() const
     return status_;
   }
 
+inline bool ABA_SUB::spilled() const
+  {
+    return spillOffset_ != -1;
+  }
+
 inline ABA_ACTIVE<ABA_CONSTRAINT, ABA_VARIABLE> *ABA_SUB::actCon() const
   {
     return actCon_;
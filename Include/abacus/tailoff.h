@@ -111,6 +111,25 @@ class ABA_SUB;
  */
       int diff(int nLps, double &d) const;
 
+/*! \brief Can be used to retrieve the improvement of the dual bound by the
+ *   last solved linear program and the cpu time spent for it.
+ *
+ *   The improvement is computed incrementally in \a update(), also if
+ *   no LP-history is stored.
+ *
+ *   \return 0 If the improvement is available, i.e., at least two
+ *                linear programs have been solved since the last reset,
+ *   \return 1 otherwise.
+ *
+ *   \param gain The improvement of the value of the last linear program
+ *               over the value of the previous one in percent relative to
+ *               the older value. It is negative if the dual bound has
+ *               been weakened.
+ *   \param centiSeconds The cpu time for separation and linear programming
+ *                       between the two linear programs in centi seconds.
+ */
+      int lastGain(double &gain, long &centiSeconds) const;
+
     private: 
 
 /*! A new LP-solution value can be stored by calling the function \a update(). 
@@ -141,6 +160,26 @@ class ABA_SUB;
       /*! The LP-values considered in the tailing off analysis.
        */
       ABA_RING<double> *lpHistory_;
+
+      /*! \a true if a linear program has been solved since the last reset.
+       */
+      bool hasLast_;
+
+      /*! The value of the last linear program and the cpu time for
+       *  separation and linear programming when it was solved.
+       */
+      double lastValue_;
+      long   lastTime_;
+
+      /*! \a true if \a gain_ and \a gainTime_ are available.
+       */
+      bool gainAvailable_;
+
+      /*! The improvement of the dual bound by the last linear program in
+       *  percent and the cpu time spent for it.
+       */
+      double gain_;
+      long   gainTime_;
   };
 #endif  // ABA_TAILOFF_H
 
@@ -0,0 +1,217 @@
+/*!\file
+ * \author The ABACUS developers
+ * \brief binary log of the enumeration tree.
+ *
+ * If the parameter {\tt VbcLog} is set to {\tt Binary}, then the
+ * events of the enumeration tree (new nodes, colors of nodes, global
+ * and local bounds) are not formatted as lines for the VBC-Tool
+ * but stored as fixed size binary records in a file. The records are
+ * collected in a buffer of bounded size. If this buffer is full it is
+ * handed to a background thread writing it to the file, while the
+ * optimization continues with a second buffer. Hence, the
+ * optimization is only blocked if the writer is slower than the
+ * generation of the events.
+ *
+ * The program {\tt abavbc} in the directory {\tt tools} converts such a
+ * file into the text format of the VBC-Tool.
+ *
+ * \par
+ * A file starts with the string ABA_TREELOG::magic() followed by
+ * the integer \a 1 as a check of the byte order. Then the records
+ * follow, each consisting of the one character ABA_TREELOG::RECORD, the
+ * cpu time in centiseconds as an integer, and the data of the record.
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#ifndef ABA_TREELOG_H
+#define ABA_TREELOG_H
+
+#include "abacus/abacusroot.h"
+
+#include <stdio.h>
+#include <pthread.h>
+
+class ABA_MASTER;
+
+  class  ABA_TREELOG :  public ABA_ABACUSROOT  {
+    public:
+
+/*! The types of the records of the binary tree log.
+ *
+ *   The enumerators are identical with the first character of the
+ *   corresponding instruction for the VBC-Tool.
+ *
+ *   \param NewNode A new node \a id with father \a fatherId (two integers).
+ *   \param PaintNode The node \a id gets the color \a color (two integers).
+ *   \param LowerBound A new global lower bound (a double).
+ *   \param UpperBound A new global upper bound (a double).
+ *   \param NodeBounds The local bounds of node \a id (an integer and
+ *                     two doubles). Infinite bounds are stored as \a HUGE_VAL.
+ */
+      enum RECORD {NewNode = 'N', PaintNode = 'P', LowerBound = 'L',
+                   UpperBound = 'U', NodeBounds = 'I'};
+
+/*! \return The string at the beginning of each binary tree log.
+ */
+      static const char *magic();
+
+/*! \brief The constructor
+ *   opens the file and starts the writer thread.
+ *
+ *   \param master A pointer to the corresponding master of the optimization.
+ *   \param fileName The name of the log-file.
+ *   \param bufferSize The size of each of the two buffers in bytes.
+ *                     At least 1024 bytes are allocated.
+ */
+      ABA_TREELOG(ABA_MASTER *master, const char *fileName, int bufferSize);
+
+/*! The destructor
+ *   writes all buffered records, stops the writer thread, and closes the file.
+ */
+      ~ABA_TREELOG();
+
+/*! Logs the new node \a id with father \a fatherId at time \a time.
+ */
+      void newNode(long time, int fatherId, int id);
+
+/*! Logs that the node \a id gets the color \a color.
+ */
+      void paintNode(long time, int id, int color);
+
+/*! Logs a new global lower bound.
+ */
+      void lowerBound(long time, double lb);
+
+/*! Logs a new global upper bound.
+ */
+      void upperBound(long time, double ub);
+
+/*! Logs the local lower bound \a lb and upper bound \a ub of node \a id.
+ */
+      void nodeBounds(long time, int id, double lb, double ub);
+
+/*! \brief Waits until all buffered records are written to the file
+ *   and flushes it.
+ */
+      void flush();
+
+/*! \brief Starts the writer thread if it is not running.
+ */
+      void startWriter();
+
+/*! \brief Writes all buffered records and stops the writer thread.
+ *
+ *   Afterwards the records are written synchronously until
+ *   \a startWriter() is called. This is required before the process
+ *   is forked (see ABA_MASTER::_startWorkers()).
+ */
+      void stopWriter();
+
+    private:
+
+/*! Appends the header of a record to the current buffer.
+ *
+ *   If there is not enough space left for a record
+ *   of maximal size the current buffer is passed to the writer thread
+ *   before.
+ */
+      void beginRecord(RECORD type, long time);
+
+/*! Appends the \a n bytes of \a data to the current buffer.
+ */
+      void append(const void *data, int n);
+
+/*! Passes the current buffer to the writer thread.
+ *
+ *   If the writer thread is still busy with the other buffer,
+ *   we have to wait.
+ */
+      void swapBuffers();
+
+/*! The function of the writer thread.
+ *
+ *   \param treeLog A pointer to the ABA_TREELOG.
+ */
+      static void *writer(void *treeLog);
+
+/*! A pointer to the corresponding master of the optimization.
+ */
+      ABA_MASTER *master_;
+
+/*! The log-file.
+ */
+      FILE *file_;
+
+/*! The size of each buffer.
+ */
+      int size_;
+
+/*! The buffer filled by the optimization.
+ */
+      char *fill_;
+
+/*! The number of bytes in \a fill_.
+ */
+      int nFill_;
+
+/*! The buffer written by the writer thread.
+ */
+      char *write_;
+
+/*! The number of bytes in \a write_, which still have to be written.
+ *
+ *   If \a nWrite_ is 0, then the writer thread is idle.
+ */
+      int nWrite_;
+
+/*! \a true if the writer thread should terminate.
+ */
+      bool done_;
+
+/*! \a true if the writer thread could be started.
+ */
+      bool running_;
+
+      pthread_t       thread_;
+      pthread_mutex_t mutex_;
+      pthread_cond_t  cond_;
+
+      ABA_TREELOG(const ABA_TREELOG &rhs);
+      const ABA_TREELOG &operator=(const ABA_TREELOG &rhs);
+  };
+
+inline const char *ABA_TREELOG::magic()
+  {
+    return "ABAVBC01";
+  }
+
+#endif  // ABA_TREELOG_H
+
+/*! \class ABA_TREELOG
+ *  \brief binary log of the enumeration tree
+ */
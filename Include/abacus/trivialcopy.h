@@ -0,0 +1,112 @@
+/*!\file
+ * \author The ABACUS developers
+ * \brief copying of elements of C-style arrays.
+ *
+ * The templates ABA_ARRAY, ABA_BUFFER, and the class ABA_SPARVEC copy
+ * their elements whenever they are reallocated, copied, or components are
+ * removed. For types that can be copied bitwise, i.e., the fundamental
+ * types and pointers, this is done with \a memcpy() and \a memmove(),
+ * for all other types with the assignment operator.
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef ABA_TRIVIALCOPY_H
+#define ABA_TRIVIALCOPY_H
+
+#include <string.h>
+
+/*! \brief The member \a value of the template ABA_TRIVIALCOPY is
+ *  nonzero if objects of the type \a Type can be copied bitwise.
+ *
+ * By default this is assumed for no type. The template is specialized
+ * for the fundamental types and for pointers. Further types can be added
+ * by a specialization, but only if they have neither a user defined
+ * assignment operator nor a user defined copy constructor.
+ */
+  template <class Type> class ABA_TRIVIALCOPY {
+    public:
+      enum { value = 0 };
+  };
+
+  template <class Type> class ABA_TRIVIALCOPY<Type*> {
+    public:
+      enum { value = 1 };
+  };
+
+  template <> class ABA_TRIVIALCOPY<bool>           { public: enum { value = 1 }; };
+  template <> class ABA_TRIVIALCOPY<char>           { public: enum { value = 1 }; };
+  template <> class ABA_TRIVIALCOPY<unsigned char>  { public: enum { value = 1 }; };
+  template <> class ABA_TRIVIALCOPY<short>          { public: enum { value = 1 }; };
+  template <> class ABA_TRIVIALCOPY<int>            { public: enum { value = 1 }; };
+  template <> class ABA_TRIVIALCOPY<unsigned>       { public: enum { value = 1 }; };
+  template <> class ABA_TRIVIALCOPY<long>           { public: enum { value = 1 }; };
+  template <> class ABA_TRIVIALCOPY<unsigned long>  { public: enum { value = 1 }; };
+  template <> class ABA_TRIVIALCOPY<float>          { public: enum { value = 1 }; };
+  template <> class ABA_TRIVIALCOPY<double>         { public: enum { value = 1 }; };
+
+/*! \brief The template ABA_ELEMENTCOPY copies elements between C-style
+ *  arrays.
+ *
+ * Since ABA_TRIVIALCOPY<Type>::value is a constant, the compiler
+ * removes the branch that is not taken.
+ */
+  template <class Type> class ABA_ELEMENTCOPY {
+    public:
+
+/*! Copies \a n elements between two arrays that must not overlap.
+ *
+ * \param to The first element of the destination.
+ * \param from The first element of the source.
+ * \param n The number of copied elements.
+ */
+      static void copy(Type *to, const Type *from, int n)
+      {
+        if (n <= 0) return;
+        if (ABA_TRIVIALCOPY<Type>::value)
+          memcpy((void*) to, (const void*) from, n*sizeof(Type));
+        else
+          for (int i = 0; i < n; i++) to[i] = from[i];
+      }
+
+/*! \brief Copies \a n elements to a position in front of the source,
+ *  where source and destination may overlap, as required for shifting
+ *  the components of an array to the left.
+ *
+ * \param to The first element of the destination, \a to \f$\le\f$ \a from.
+ * \param from The first element of the source.
+ * \param n The number of copied elements.
+ */
+      static void shiftLeft(Type *to, const Type *from, int n)
+      {
+        if (n <= 0 || to == from) return;
+        if (ABA_TRIVIALCOPY<Type>::value)
+          memmove((void*) to, (const void*) from, n*sizeof(Type));
+        else
+          for (int i = 0; i < n; i++) to[i] = from[i];
+      }
+  };
+
+#endif  // ABA_TRIVIALCOPY_H
@@ -35,9 +35,7 @@
 
 #include "abacus/branchrule.h"
 
-#ifdef ABACUS_PARALLEL
 class ABA_MESSAGE;
-#endif
 
   class  ABA_VALBRANCHRULE :  public ABA_BRANCHRULE  { 
     public: 
@@ -52,7 +50,6 @@ class ABA_MESSAGE;
 
 //! The destructor.
       virtual ~ABA_VALBRANCHRULE();
-#ifdef ABACUS_PARALLEL
 
 /*! \brief The message constructor
  *   creates the ABA_VALBRANCHRULE from an ABA_MESSAGE.
@@ -81,7 +78,6 @@ class ABA_MESSAGE;
  *   \return The class identification.
  */
       virtual int classId() const;
-#endif
 
 /*! \brief The output operator
  *   writes the branching variable together with its value to an output stream.
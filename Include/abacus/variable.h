@@ -47,9 +47,7 @@ class ABA_VARTYPE;
 class ABA_COLUMN;
 template<class BaseType, class CoType> class ABA_ACTIVE;
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
 
 
   class  ABA_VARIABLE :  public ABA_CONVAR  { 
@@ -87,7 +85,6 @@ template<class BaseType, class CoType> class ABA_ACTIVE;
 
 //! The destructor.
       virtual ~ABA_VARIABLE();
-#ifdef ABACUS_PARALLEL
 
 /*! \brief The message constructor
  *   creates the variable from an ABA_MESSAGE.
@@ -106,7 +103,6 @@ template<class BaseType, class CoType> class ABA_ACTIVE;
  *   \param msg The ABA_MESSAGE object in which the variable is packed.
  */
       virtual void pack(ABA_MESSAGE &msg) const;
-#endif
 
 
 /*! \return The type of the variable.
@@ -38,9 +38,7 @@ using namespace std;
 
 #include "abacus/abacusroot.h"
 
-#ifdef ABACUS_PARALLEL
 class ABA_MESSAGE;
-#endif
 
   class  ABA_VARTYPE :  public ABA_ABACUSROOT  { 
     public: 
@@ -63,7 +61,6 @@ class ABA_MESSAGE;
  *   \param t The variable type.
  */
       ABA_VARTYPE(TYPE t);
-#ifdef ABACUS_PARALLEL
 
 /*! \brief The message constructor
  *   creates the type from an ABA_MESSAGE.
@@ -77,7 +74,6 @@ class ABA_MESSAGE;
  *   \param msg The ABA_MESSAGE object in which the type is packed.
  */
       void pack(ABA_MESSAGE &msg) const;
-#endif
 
 /*! \brief The output operator
  *   writes the variable type to an output stream in
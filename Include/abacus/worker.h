@@ -0,0 +1,187 @@
+/*!\file
+ * \author The ABACUS developers
+ * \brief worker of a distributed optimization.
+ *
+ * A worker is a process forked by ABA_MASTER::_startWorkers(). It
+ * continues the sequential optimization with its share of the open
+ * subproblems and exchanges primal bounds, cuts, and open subproblems
+ * with the coordinator (see ABA_COORDINATOR) over a connected socket.
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#ifndef ABA_WORKER_H
+#define ABA_WORKER_H
+
+#include "abacus/abacusroot.h"
+#include "abacus/array.h"
+#include "abacus/master.h"
+
+class ABA_MESSAGE;
+
+  class  ABA_WORKER :  public ABA_ABACUSROOT  {
+    public:
+
+/*! \brief The constructor.
+ *
+ *   \param master A pointer to the corresponding master of the optimization.
+ *   \param fd The socket connected to the coordinator.
+ */
+      ABA_WORKER(ABA_MASTER *master, int fd);
+
+/*! The destructor closes the connection.
+ */
+      ~ABA_WORKER();
+
+/*! \brief Exchanges information with the coordinator after a subproblem
+ *   has been processed.
+ *
+ *   New cuts of the cut pool and a changed number of open subproblems
+ *   are reported, and the messages of the coordinator which have arrived
+ *   in the meantime are processed without waiting for further ones.
+ */
+      void communicate();
+
+/*! \brief Waits for open subproblems of other workers.
+ *
+ *   This function is called if the worker has no open subproblems left.
+ *
+ *   \return true If open subproblems have been received,
+ *   \return false if the optimization has been stopped.
+ */
+      bool idle();
+
+/*! \return true If the coordinator has stopped the optimization,
+ *   \return false otherwise.
+ */
+      bool stopped() const;
+
+/*! \brief Reports a new primal bound to the coordinator.
+ *
+ *   The bound is only sent if it has not been received from the coordinator.
+ *
+ *   \param x The new primal bound.
+ */
+      void primalBound(double x);
+
+/*! \brief Sends the final message to the coordinator.
+ *
+ *   \param status The status of the optimization of the worker.
+ */
+      void finish(ABA_MASTER::STATUS status);
+
+    private:
+
+/*! Sends the message \a msg to the coordinator.
+ */
+      void send(const ABA_MESSAGE &msg);
+
+/*! Waits for the next message of the coordinator and stores it in \a in_.
+ */
+      void receive();
+
+/*! \brief Processes the message \a in_ of the coordinator.
+ *
+ *   \return The tag of the message.
+ */
+      int handle();
+
+/*! Sends at most \a n open subproblems to the coordinator.
+ */
+      void donate(int n);
+
+/*! Inserts the open subproblems of the message \a in_.
+ */
+      void unpackSubs();
+
+/*! Sends the new globally valid cuts of the cut pool to the coordinator.
+ */
+      void sendCuts();
+
+/*! Inserts the cuts of the message \a in_ in the cut pool.
+ */
+      void unpackCuts();
+
+/*! Marks all cuts of the cut pool as known to the coordinator.
+ */
+      void markCuts();
+
+/*! A pointer to the corresponding master of the optimization.
+ */
+      ABA_MASTER *master_;
+
+/*! The socket connected to the coordinator.
+ */
+      int fd_;
+
+/*! The message sent last.
+ */
+      ABA_MESSAGE *out_;
+
+/*! The message received last.
+ */
+      ABA_MESSAGE *in_;
+
+/*! \a true if the coordinator has stopped the optimization.
+ */
+      bool stopped_;
+
+/*! The best primal bound known to the coordinator.
+ */
+      double primalBound_;
+
+/*! \a true if this worker has found the primal bound \a primalBound_.
+ */
+      bool found_;
+
+/*! The number of open subproblems reported last.
+ */
+      int nOpen_;
+
+/*! The dual bound of the open subproblems reported last.
+ */
+      double dualBound_;
+
+/*! \brief The version of each slot of the cut pool when its cut was sent
+ *   to or received from the coordinator.
+ */
+      ABA_ARRAY<unsigned long> known_;
+
+      ABA_WORKER(const ABA_WORKER &rhs);
+      const ABA_WORKER &operator=(const ABA_WORKER &rhs);
+  };
+
+inline bool ABA_WORKER::stopped() const
+  {
+    return stopped_;
+  }
+
+#endif  // ABA_WORKER_H
+
+/*! \class ABA_WORKER
+ *  \brief worker of a distributed optimization
+ */
@@ -0,0 +1,215 @@
+#!/bin/sh
+#
+# Benchmark of the TSP example of ABACUS 3.0
+#
+# usage: benchmark.sh [-r runs] [-s settings] [-o results] [instance ...]
+#        benchmark.sh -c baseline [-t tolerance] results
+#
+# In the first form the program tsp is applied to each instance
+# (default: berlin52.tsp eil76.tsp bier127.tsp) with each parameter
+# setting of the file settings (default: benchmark.settings), and
+# every combination is solved runs times (default: 3). For each run
+# a line with the tab separated columns
+#
+#   instance setting run status wall_s cpu_s nodes lps
+#   cuts_added cuts_removed peak_rss_kb best
+#
+# is written to the file results (default: benchmark.tsv). The first
+# line of the file holds the names of the columns. The columns are
+# only ever appended, such that older results can still be compared.
+#
+# In the second form the medians of the runs of each instance and
+# setting in results are compared with those in the file baseline.
+# The exit status is 1 if a wall time or a peak resident set size
+# exceeds the baseline by more than the relative tolerance
+# (default: 0.10), or if the status or the value of the best solution
+# differ, and 0 otherwise.
+#
+# The wall time and the peak resident set size are measured with
+# GNU time, which is looked up in the environment variable TIME_CMD
+# (default: /usr/bin/time). The parameters of ABACUS are read from
+# $ABACUS_DIR/.abacus as usual. Each run is carried out in the
+# directory benchmark.d/<setting>, which holds a copy of the file .tsp
+# with the parameters of the setting appended. Parameters of the
+# file .abacus can be redefined there, too.
+#
+
+runs=3
+settings=benchmark.settings
+results=benchmark.tsv
+baseline=
+tolerance=0.10
+
+while getopts r:s:o:c:t: opt; do
+  case $opt in
+    r) runs=$OPTARG ;;
+    s) settings=$OPTARG ;;
+    o) results=$OPTARG ;;
+    c) baseline=$OPTARG ;;
+    t) tolerance=$OPTARG ;;
+    *) echo "usage: $0 [-r runs] [-s settings] [-o results] [instance ...]" >&2
+       echo "       $0 -c baseline [-t tolerance] results" >&2
+       exit 2 ;;
+  esac
+done
+shift `expr $OPTIND - 1`
+
+#
+# comparison with the baseline
+#
+
+if [ -n "$baseline" ]; then
+  if [ $# -ne 1 ] || [ ! -r "$baseline" ] || [ ! -r "$1" ]; then
+    echo "$0: cannot read the baseline or the results" >&2
+    exit 2
+  fi
+
+  awk -F '\t' -v tol="$tolerance" '
+    function median(key, col,    n, i, j, v, a) {
+      n = cnt[key]
+      for (i = 1; i <= n; i++) {
+        v = val[key, col, i]
+        for (j = i - 1; j > 0 && a[j] > v; j--) a[j + 1] = a[j]
+        a[j + 1] = v
+      }
+      if (n % 2) return a[(n + 1)/2]
+      return (a[n/2] + a[n/2 + 1])/2
+    }
+
+    FNR == 1 {
+      for (c = 1; c <= NF; c++) col[FILENAME, $c] = c
+      file++
+      next
+    }
+
+    {
+      key = file SUBSEP $col[FILENAME, "instance"] SUBSEP $col[FILENAME, "setting"]
+      if (!((file, $col[FILENAME, "instance"], $col[FILENAME, "setting"]) in cnt))
+        order[++nKeys] = $col[FILENAME, "instance"] SUBSEP $col[FILENAME, "setting"]
+      n = ++cnt[key]
+      val[key, "wall_s", n]      = $col[FILENAME, "wall_s"]
+      val[key, "nodes", n]       = $col[FILENAME, "nodes"]
+      val[key, "lps", n]         = $col[FILENAME, "lps"]
+      val[key, "peak_rss_kb", n] = $col[FILENAME, "peak_rss_kb"]
+      status[key] = $col[FILENAME, "status"]
+      best[key]   = $col[FILENAME, "best"]
+    }
+
+    END {
+      printf "%-14s %-14s %10s %10s %8s %8s %8s %8s  %s\n", "instance",
+             "setting", "wall_base", "wall_cur", "wall", "nodes", "lps",
+             "rss", "verdict"
+      failed = 0
+      for (k = 1; k <= nKeys; k++) {
+        split(order[k], f, SUBSEP)
+        if (seen[order[k]]++) continue
+        b = 1 SUBSEP order[k]
+        c = 2 SUBSEP order[k]
+        if (!(b in cnt) || !(c in cnt)) {
+          printf "%-14s %-14s %s\n", f[1], f[2], \
+                 (b in cnt) ? "missing in results" : "missing in baseline"
+          continue
+        }
+        verdict = "ok"
+        for (q = 1; q <= 4; q++) {
+          name = q == 1 ? "wall_s" : q == 2 ? "nodes" : q == 3 ? "lps" : "peak_rss_kb"
+          mb = median(b, name)
+          mc = median(c, name)
+          ratio[name] = mb > 0 ? mc/mb : (mc > 0 ? 99.99 : 1.0)
+        }
+        if (ratio["wall_s"] > 1 + tol) verdict = "SLOWER"
+        if (ratio["peak_rss_kb"] > 1 + tol) verdict = verdict == "ok" ? "LARGER" : verdict ",LARGER"
+        if (status[b] != status[c] || best[b] != best[c])
+          verdict = verdict == "ok" ? "DIFFERENT" : verdict ",DIFFERENT"
+        if (verdict != "ok") failed = 1
+        printf "%-14s %-14s %10.2f %10.2f %8.3f %8.3f %8.3f %8.3f  %s\n", f[1],
+               f[2], median(b, "wall_s"), median(c, "wall_s"), ratio["wall_s"],
+               ratio["nodes"], ratio["lps"], ratio["peak_rss_kb"], verdict
+      }
+      exit failed
+    }' "$baseline" "$1"
+  exit $?
+fi
+
+#
+# running the benchmark
+#
+
+[ $# -eq 0 ] && set -- berlin52.tsp eil76.tsp bier127.tsp
+
+TIME_CMD=${TIME_CMD:-/usr/bin/time}
+here=`pwd`
+
+if [ ! -x ./tsp ]; then
+  echo "$0: the program tsp is missing, call \"make tsp\" first" >&2
+  exit 2
+fi
+if [ -z "$ABACUS_DIR" ]; then
+  echo "$0: environment variable ABACUS_DIR not found" >&2
+  exit 2
+fi
+if ! "$TIME_CMD" -f %M true >/dev/null 2>&1; then
+  echo "$0: $TIME_CMD is not GNU time, set TIME_CMD" >&2
+  exit 2
+fi
+
+printf 'instance\tsetting\trun\tstatus\twall_s\tcpu_s\tnodes\tlps\tcuts_added\tcuts_removed\tpeak_rss_kb\tbest\n' > "$results"
+
+grep -v '^#' "$settings" | while read setting params; do
+  [ -z "$setting" ] && continue
+
+# set up the directory of the setting
+  dir=benchmark.d/$setting
+  mkdir -p "$dir"
+  {
+    cat .tsp
+    echo
+    echo "# parameters of the benchmark setting $setting"
+    echo "OutputLevel Statistics"
+    echo "ShowBestTour false"
+    for p in $params; do
+      echo "$p" | sed 's/=/ /'
+    done
+  } > "$dir/.tsp"
+
+  for instance in "$@"; do
+    case $instance in
+      /*) file=$instance ;;
+      *)  file=$here/$instance ;;
+    esac
+    name=`basename "$instance" .tsp`
+
+    run=1
+    while [ $run -le "$runs" ]; do
+      log=$dir/$name.$run.log
+      (cd "$dir" && "$TIME_CMD" -f 'BENCHMARK %e %M' "$here/tsp" "$file") \
+        < /dev/null > "$log" 2>&1
+
+      awk -v instance="$name" -v setting="$setting" -v run=$run '
+        function seconds(t,    n, p, s, i) {
+          n = split(t, p, ":")
+          s = 0
+          for (i = 1; i <= n; i++) s = 60*s + p[i]
+          return s
+        }
+        /Number of subproblems/        { nodes = $NF }
+        /Number of solved LPs/         { lps = $NF }
+        /Number of added constraints/  { added = $NF }
+        /Number of removed constraints/{ removed = $NF }
+        /Total cpu time/               { cpu = seconds($NF) }
+        /^Best solution:/              { best = $NF }
+        /terminated with status/       { status = $NF; sub(/\.$/, "", status) }
+        /^BENCHMARK /                  { wall = $2; rss = $3 }
+        END {
+          if (status == "") status = "Failed"
+          if (best == "") best = "-"
+          printf "%s\t%s\t%d\t%s\t%.2f\t%.2f\t%d\t%d\t%d\t%d\t%d\t%s\n",
+                 instance, setting, run, status, wall, cpu, nodes, lps,
+                 added, removed, rss, best
+        }' "$log" >> "$results"
+
+      tail -n 1 "$results"
+      run=`expr $run + 1`
+    done
+  done
+done
@@ -0,0 +1,344 @@
+@q 2026 by the ABACUS developers @>
+
+@ All member functions are defined in the file {\tt comb.cc}.
+
+@(comb.cc@>=
+
+#include "tspmaster.h"
+#include "comb.h"
+#include "edge.h"
+#include "abacus/sorter.h"
+#include "abacus/message.h"
+
+@ The constructor.
+  \BeginArg
+  \docarg{|master|}{A pointer to the corresponding master of the optimization.}
+  \docarg{|nHandle|}{The number of nodes of the handle.}
+  \docarg{|handle|}{The nodes of the handle.}
+  \docarg{|nTeeth|}{The number of teeth, which must be odd and at least 3.}
+  \docarg{|toothStart|}{The nodes of tooth |j| are |teeth[toothStart[j]]|,
+                        \dots, |teeth[toothStart[j+1]-1]|. The size of
+                        this array must be at least |nTeeth + 1|.}
+  \docarg{|teeth|}{The nodes of the teeth.}
+  \EndArg
+  Like a subtour elimination constraint, the comb inequality has no
+  associated subproblem, is an $\le$-inequality, may be removed again
+  from the LP-relaxation, is globally valid, and can be lifted.
+  The right hand side is
+  $\vert H \vert + \sum_{j=1}^k \vert T_j \vert - k - (k+1)/2$.
+@(comb.cc@>=
+  COMB::COMB(ABA_MASTER *master, int nHandle, int *handle,
+             int nTeeth, int *toothStart, int *teeth) : @/
+    ABA_CONSTRAINT(master, 0, ABA_CSENSE::Less,
+                   nHandle + toothStart[nTeeth] - nTeeth - (nTeeth + 1)/2,
+                   true, false, true), @/
+    setStart_(master, nTeeth + 2), @/
+    nodes_(master, nHandle + toothStart[nTeeth]), @/
+    inHandle_(0), @/
+    tooth_(0)
+  {
+    @<store the handle@>;
+    @<store the teeth in the order of their smallest nodes@>;
+  }
+
+@ @<store the handle@>=
+  for (int i = 0; i < nHandle; i++)
+    nodes_[i] = handle[i];
+
+  setStart_[0] = 0;
+  setStart_[1] = nHandle;
+  sortNodes(0, nHandle);
+
+@ @<store the teeth in the order of their smallest nodes@>=
+  ABA_ARRAY<int> order(master, nTeeth);  // the teeth in the sorted order
+  ABA_ARRAY<int> smallest(master, nTeeth);  // the smallest node of each tooth
+
+  for (int j = 0; j < nTeeth; j++) {
+    order[j]    = j;
+    smallest[j] = teeth[toothStart[j]];
+    for (int k = toothStart[j] + 1; k < toothStart[j + 1]; k++)
+      if (teeth[k] < smallest[j]) smallest[j] = teeth[k];
+  }
+
+  ABA_SORTER<int, int> sorter(master);
+  sorter.quickSort(nTeeth, order, smallest);
+
+  int next = nHandle;  // the next free position of |nodes_|
+
+  for (int s = 0; s < nTeeth; s++) {
+    for (int l = toothStart[order[s]]; l < toothStart[order[s] + 1]; l++)
+      nodes_[next++] = teeth[l];
+    setStart_[s + 2] = next;
+    sortNodes(setStart_[s + 1], next);
+  }
+
+@ The message constructor restores a comb packed by the function |pack()|.
+  Since the sets have been sorted by the first constructor already, they
+  are unpacked in the same order, such that |hashKey()| and |equal()|
+  give the same results for the restored comb.
+  \BeginArg
+  \docarg{|master|}{A pointer to the corresponding master of the optimization.}
+  \docarg{|msg|}{The message from which the comb is unpacked.}
+  \EndArg
+
+@(comb.cc@>=
+  COMB::COMB(ABA_MASTER *master, ABA_MESSAGE &msg) : @/
+    ABA_CONSTRAINT(master, msg), @/
+    setStart_(master, msg), @/
+    nodes_(master, msg), @/
+    inHandle_(0), @/
+    tooth_(0)
+  { }
+
+@ The destructor.
+
+@(comb.cc@>=
+  COMB::~COMB()
+  {
+    if (expanded_) compress();
+  }
+
+@ The function |pack()| packs the comb in a message. It redefines
+  the virtual function of the base class |ABA_CONSTRAINT|, which has to be
+  called first.
+  \BeginArg
+  \docarg{|msg|}{The message in which the comb is packed.}
+  \EndArg
+
+@(comb.cc@>=
+  void COMB::pack(ABA_MESSAGE &msg) const
+  {
+    ABA_CONSTRAINT::pack(msg);
+    setStart_.pack(msg);
+    nodes_.pack(msg);
+  }
+
+@ The function |classId()|.
+  \BeginReturn
+    The identification of the class |COMB|.
+  \EndReturn
+
+@(comb.cc@>=
+  int COMB::classId() const
+  {
+    return COMB_CLASSID;
+  }
+
+@ The function |coeff()| computes the coefficient of the edge $(t,h)$.
+  It redefines the pure virtual function of the base class |ABA_CONSTRAINT|.
+  The coefficient is the number of sets of the comb containing both
+  |t| and |h|. Since the teeth are disjoint, it is at most 2.
+
+  \BeginReturn
+  The coefficient of variable |*v|.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|v|}{A pointer to a variable that must be of type |EDGE*|.}
+  \EndArg
+
+@(comb.cc@>=
+  double COMB::coeff(ABA_VARIABLE *v)
+  {
+    int t = ((EDGE *) v)->tail();
+    int h = ((EDGE *) v)->head();
+
+    if (expanded_) {
+      @<compute coefficient for comb in expanded format@>;
+    }
+    else {
+      @<compute coefficient for comb in compressed format@>;
+    }
+  }
+
+@ @<compute coefficient for comb in expanded format@>=
+  double c = 0.0;
+
+  if (inHandle_[t] && inHandle_[h]) c += 1.0;
+  if (tooth_[t] != -1 && tooth_[t] == tooth_[h]) c += 1.0;
+
+  return c;
+
+@ In the compressed format we scan each set and count the sets
+  containing both nodes.
+
+@<compute coefficient for comb in compressed format@>=
+  double c = 0.0;
+
+  for (int s = 0; s < nSets(); s++) {
+    bool tFound = false;
+    bool hFound = false;
+
+    for (int i = setStart_[s]; i < setStart_[s + 1]; i++)
+      if (nodes_[i] == t) tFound = true;
+      else if (nodes_[i] == h) hFound = true;
+
+    if (tFound && hFound) c += 1.0;
+  }
+
+  return c;
+
+@ The function |hashKey()| redefines a virtual function of the base class
+  |ABA_CONVAR|. It is required for storing combs in a pool of the class
+  |ABA_NONDUPLPOOL|. Since the sets are stored in a unique order,
+  equal combs have the same key.
+
+  \BeginReturn
+  The hash key of the comb.
+  \EndReturn
+
+@(comb.cc@>=
+  unsigned COMB::hashKey()
+  {
+    unsigned key = 0;
+
+    for (int s = 0; s < setStart_.size(); s++)
+      key = 31*key + setStart_[s];
+    for (int i = 0; i < nodes_.size(); i++)
+      key = 31*key + nodes_[i];
+
+    return key;
+  }
+
+@ The function |name()| redefines a virtual function of the base class
+  |ABA_CONVAR|.
+
+  \BeginReturn
+  The name of the class.
+  \EndReturn
+
+@(comb.cc@>=
+  const char *COMB::name()
+  {
+    return "COMB";
+  }
+
+@ The function |equal()| redefines a virtual function of the base class
+  |ABA_CONVAR|.
+
+  \BeginReturn
+  |true| if |cv| is a comb with the same handle and teeth, |false| otherwise.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|cv|}{The constraint compared with this comb.}
+  \EndArg
+
+@(comb.cc@>=
+  bool COMB::equal(ABA_CONVAR *cv)
+  {
+    COMB *comb = dynamic_cast<COMB*>(cv);
+
+    if (comb == 0 || comb->setStart_.size() != setStart_.size() ||
+        comb->nodes_.size() != nodes_.size())
+      return false;
+
+    for (int s = 0; s < setStart_.size(); s++)
+      if (comb->setStart_[s] != setStart_[s]) return false;
+    for (int i = 0; i < nodes_.size(); i++)
+      if (comb->nodes_[i] != nodes_[i]) return false;
+
+    return true;
+  }
+
+@ The function |expand()| redefines a virtual function
+  of the base class |ABA_CONVAR| in order to compute the expanded format.
+  Like for the class |SUBTOUR|, \ABACUS\ makes sure that it is not called
+  if the constraint is already expanded.
+
+@(comb.cc@>=
+  void COMB::expand()
+  {
+    int n = ((TSPMASTER *) master_)->nNodes();
+
+    inHandle_ = new bool[n];
+    tooth_    = new int[n];
+
+    for (int v = 0; v < n; v++) {
+      inHandle_[v] = false;
+      tooth_[v]    = -1;
+    }
+
+    for (int i = setStart_[0]; i < setStart_[1]; i++)
+      inHandle_[nodes_[i]] = true;
+
+    for (int s = 1; s < nSets(); s++)
+      for (int j = setStart_[s]; j < setStart_[s + 1]; j++)
+        tooth_[nodes_[j]] = s;
+  }
+
+@ The function |compress()| deletes the arrays storing the expanded format.
+
+@(comb.cc@>=
+  void COMB::compress()
+  {
+    delete [] inHandle_;
+    delete [] tooth_;
+    inHandle_ = 0;
+    tooth_    = 0;
+  }
+
+@ The function |sortNodes()| sorts the nodes of a set by insertion.
+
+  \BeginArg
+  \docarg{|first|}{The position of the first node of the set in |nodes_|.}
+  \docarg{|last|}{The position behind the last node of the set.}
+  \EndArg
+
+@(comb.cc@>=
+  void COMB::sortNodes(int first, int last)
+  {
+    for (int i = first + 1; i < last; i++) {
+      const int v = nodes_[i];
+      int       j = i;
+
+      while (j > first && nodes_[j - 1] > v) {
+        nodes_[j] = nodes_[j - 1];
+        --j;
+      }
+      nodes_[j] = v;
+    }
+  }
+
+@ The function |nSets()|.
+  \BeginReturn
+    The number of sets of the comb, i.e., the number of teeth plus 1.
+  \EndReturn
+
+@(comb.cc@>=
+  int COMB::nSets() const
+  {
+    return setStart_.size() - 1;
+  }
+
+@ The function |nNodes()|.
+  \BeginReturn
+    The number of nodes of a set.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|s|}{The set, where 0 is the handle and $1, \dots, k$ are
+               the teeth.}
+  \EndArg
+
+@(comb.cc@>=
+  int COMB::nNodes(int s) const
+  {
+    return setStart_[s + 1] - setStart_[s];
+  }
+
+@ The function |node()|.
+  \BeginReturn
+    The |i|-th node of a set.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|s|}{The set.}
+  \docarg{|i|}{The number of the node, $0 \le i < |nNodes(s)|$.}
+  \EndArg
+
+@(comb.cc@>=
+  int COMB::node(int s, int i) const
+  {
+    return nodes_[setStart_[s] + i];
+  }
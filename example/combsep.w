@@ -0,0 +1,518 @@
+@q 2026 by the ABACUS developers @>
+
+@ All member functions are defined in the file {\tt combsep.cc}.
+
+@(combsep.cc@>=
+#include "combsep.h"
+#include "tspmaster.h"
+#include "edge.h"
+#include "comb.h"
+
+@ The constructor allocates the arrays depending on the number of nodes.
+  The arrays of the support graph are enlarged in the function
+  |setUpSupportGraph()| if required.
+  \BeginArg
+  \docarg{|master|}{A pointer to the corresponding master of the optimization.}
+  \EndArg
+
+@(combsep.cc@>=
+  COMBSEPARATOR::COMBSEPARATOR(TSPMASTER *master) : @/
+    master_(master), @/
+    nNodes_(master->nNodes()), @/
+    nSupEdges_(0), @/
+    supTail_(master, 1), @/
+    supHead_(master, 1), @/
+    supX_(master, 1), @/
+    adjStart_(master, nNodes_ + 1, 0), @/
+    adjNode_(master, 1), @/
+    adjX_(master, 1), @/
+    nOne_(master, nNodes_, 0), @/
+    oneAdj_(master, 2*nNodes_), @/
+    fractional_(master, nNodes_, false), @/
+    fracComp_(master, nNodes_), @/
+    nComp_(0), @/
+    compOfRep_(master, nNodes_), @/
+    compStart_(master, nNodes_ + 1), @/
+    compNodes_(master, nNodes_), @/
+    compNext_(master, nNodes_), @/
+    handle_(master, nNodes_), @/
+    toothStart_(master, nNodes_ + 1), @/
+    teeth_(master, nNodes_), @/
+    inHandle_(master, nNodes_, false), @/
+    tooth_(master, nNodes_, -1) @/
+  { }
+
+@ The destructor.
+
+@(combsep.cc@>=
+  COMBSEPARATOR::~COMBSEPARATOR()
+  { }
+
+@ The function |setUpSupportGraph()| stores the support graph of the
+  LP-solution of a subproblem and computes its fractional components.
+  It has to be called before the functions |blossoms()| and |combs()|.
+
+  \BeginArg
+  \docarg{|sub|}{The subproblem.}
+  \EndArg
+
+@(combsep.cc@>=
+  void COMBSEPARATOR::setUpSupportGraph(ABA_SUB *sub)
+  {
+    @<store the support graph for the comb separation@>;
+    @<build the adjacency lists for the comb separation@>;
+    computeFractionalComponents();
+  }
+
+@ Edges with value 1 are stored in the lists |oneAdj_|. Because of the
+  degree constraints, each node has at most two of them. In order to
+  keep the lists symmetric also for inaccurate LP-solutions, an edge is
+  only stored if both end nodes have less than two edges with value 1.
+  The edges with fractional values are merged into the fractional
+  components.
+
+@<store the support graph for the comb separation@>=
+  const int nVar = sub->nVar();
+
+  if (supTail_.size() < nVar) {
+    supTail_.realloc(nVar);
+    supHead_.realloc(nVar);
+    supX_.realloc(nVar);
+  }
+
+  for (int v = 0; v < nNodes_; v++) {
+    nOne_[v]       = 0;
+    fractional_[v] = false;
+    fracComp_.makeSet(v);
+  }
+
+  nSupEdges_ = 0;
+
+  for (int i = 0; i < nVar; i++) {
+    const double x = sub->xVal(i);
+
+    if (x > master_->machineEps()) {
+      EDGE *e = (EDGE*) sub->variable(i);
+      const int t = e->tail();
+      const int h = e->head();
+
+      supTail_[nSupEdges_] = t;
+      supHead_[nSupEdges_] = h;
+      supX_[nSupEdges_]    = x;
+      ++nSupEdges_;
+
+      if (x >= 1.0 - master_->eps()) {
+        if (nOne_[t] < 2 && nOne_[h] < 2) {
+          oneAdj_[2*t + nOne_[t]++] = h;
+          oneAdj_[2*h + nOne_[h]++] = t;
+        }
+      }
+      else {
+        fractional_[t] = true;
+        fractional_[h] = true;
+        fracComp_.unionSets(t, h);
+      }
+    }
+  }
+
+@ The neighbors of node |v| are |adjNode_[adjStart_[v]]|, \dots,
+  |adjNode_[adjStart_[v+1]-1]|, and |adjX_| holds the value of the
+  corresponding edge. Like in the class |SUBTOURSEPARATOR|, |adjStart_[v]|
+  is first the end of the list of node |v|.
+
+@<build the adjacency lists for the comb separation@>=
+  if (adjNode_.size() < 2*nSupEdges_) {
+    adjNode_.realloc(2*nSupEdges_);
+    adjX_.realloc(2*nSupEdges_);
+  }
+
+  for (int u = 0; u <= nNodes_; u++)
+    adjStart_[u] = 0;
+  for (int f = 0; f < nSupEdges_; f++) {
+    ++adjStart_[supTail_[f]];
+    ++adjStart_[supHead_[f]];
+  }
+  for (int w = 1; w < nNodes_; w++)
+    adjStart_[w] += adjStart_[w - 1];
+  adjStart_[nNodes_] = 2*nSupEdges_;
+
+  for (int g = nSupEdges_ - 1; g >= 0; g--) {
+    int a = --adjStart_[supTail_[g]];
+    adjNode_[a] = supHead_[g];
+    adjX_[a]    = supX_[g];
+
+    a = --adjStart_[supHead_[g]];
+    adjNode_[a] = supTail_[g];
+    adjX_[a]    = supX_[g];
+  }
+
+@ The function |computeFractionalComponents()| numbers the fractional
+  components and stores the nodes of component |g| in
+  |compNodes_[compStart_[g]]|, \dots, |compNodes_[compStart_[g+1]-1]|.
+  Nodes without fractional edges belong to no component.
+
+@(combsep.cc@>=
+  void COMBSEPARATOR::computeFractionalComponents()
+  {
+    for (int u = 0; u < nNodes_; u++) {
+      compOfRep_[u]     = -1;
+      compStart_[u + 1] = 0;
+    }
+
+    compStart_[0] = 0;
+    nComp_        = 0;
+
+    for (int w = 0; w < nNodes_; w++)
+      if (fractional_[w]) {
+        int rep = fracComp_.findSet(w);
+        if (compOfRep_[rep] == -1) compOfRep_[rep] = nComp_++;
+        ++compStart_[compOfRep_[rep] + 1];
+      }
+
+    for (int c = 0; c < nComp_; c++)
+      compStart_[c + 1] += compStart_[c];
+
+    for (int d = 0; d < nComp_; d++)
+      compNext_[d] = compStart_[d];
+    for (int z = 0; z < nNodes_; z++)
+      if (fractional_[z])
+        compNodes_[compNext_[compOfRep_[fracComp_.findSet(z)]]++] = z;
+  }
+
+@ The function |blossoms()| generates violated blossom inequalities
+  with the heuristic of Padberg and Hong [PH80]. Each fractional
+  component with at least 3 nodes is tried as handle.
+
+  \BeginReturn
+  The number of generated blossom inequalities.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|max|}{The maximal number of generated inequalities.}
+  \docarg{|constraints|}{The generated constraints are added to this buffer.}
+  \docarg{|rank|}{The violation of each generated constraint is added to
+                  this buffer.}
+  \EndArg
+
+@(combsep.cc@>=
+  int COMBSEPARATOR::blossoms(int max,
+                              ABA_BUFFER<ABA_CONSTRAINT*> &constraints,
+                              ABA_BUFFER<double> &rank)
+  {
+    int nGen = 0;
+
+    for (int g = 0; g < nComp_ && nGen < max; g++)
+      if (compStart_[g + 1] - compStart_[g] >= 3 &&
+          blossom(g, constraints, rank)) ++nGen;
+
+    return nGen;
+  }
+
+@ The function |combs()| generates violated comb inequalities whose
+  teeth are paths of edges having value 1. Each fractional component
+  with at least 3 nodes is tried as handle.
+
+  \BeginReturn
+  The number of generated comb inequalities.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|max|}{The maximal number of generated inequalities.}
+  \docarg{|constraints|}{The generated constraints are added to this buffer.}
+  \docarg{|rank|}{The violation of each generated constraint is added to
+                  this buffer.}
+  \EndArg
+
+@(combsep.cc@>=
+  int COMBSEPARATOR::combs(int max,
+                           ABA_BUFFER<ABA_CONSTRAINT*> &constraints,
+                           ABA_BUFFER<double> &rank)
+  {
+    int nGen = 0;
+
+    for (int g = 0; g < nComp_ && nGen < max; g++)
+      if (compStart_[g + 1] - compStart_[g] >= 3 &&
+          comb(g, constraints, rank)) ++nGen;
+
+    return nGen;
+  }
+
+@ The function |blossom()| uses a fractional component $H$ as handle.
+  Each edge with value 1 leaving $H$ becomes a tooth. Because of the
+  degree constraints, we have $x(E(H)) = \vert H \vert - k/2$ for $k$ such
+  teeth. Hence, the blossom inequality is violated by $1/2$ if $k$ is odd.
+  If two teeth share their node outside of $H$, they are not disjoint.
+  Following Gr\"otschel and Holland [GH91], we add this node to the
+  handle and remove both teeth, which does not change the violation.
+
+  \BeginReturn
+  |true| if a violated blossom inequality has been generated, |false|
+  otherwise.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|g|}{The fractional component used as handle.}
+  \docarg{|constraints|}{The generated constraint is added to this buffer.}
+  \docarg{|rank|}{The violation of the generated constraint is added to
+                  this buffer.}
+  \EndArg
+
+@(combsep.cc@>=
+  bool COMBSEPARATOR::blossom(int g, ABA_BUFFER<ABA_CONSTRAINT*> &constraints,
+                              ABA_BUFFER<double> &rank)
+  {
+    const int size = compStart_[g + 1] - compStart_[g];
+    int *H = &compNodes_[compStart_[g]];  // the nodes of the component
+    int nHandle = 0;
+
+    for (int i = 0; i < size; i++) {
+      handle_[nHandle++] = H[i];
+      inHandle_[H[i]]    = true;
+    }
+
+    @<collect the edges with value 1 leaving the handle@>;
+    @<remove the teeth sharing a node@>;
+
+    for (int l = 0; l < nHandle; l++)
+      inHandle_[handle_[l]] = false;
+
+    return generateComb(nHandle, nTeeth, constraints, rank);
+  }
+
+@ The tooth |j| consists of the nodes |teeth_[2*j]| in the handle and
+  |teeth_[2*j+1]| outside of the handle, and |tooth_| stores |j| for the
+  latter one. Because of the degree constraints, a node of the handle has
+  at most one edge with value 1. If the LP-solution is inaccurate, we
+  consider only the first one, such that the teeth are disjoint. If a node outside of the handle is reached a second time,
+  the node in the handle of its first tooth is set to $-1$.
+
+@<collect the edges with value 1 leaving the handle@>=
+  int nEdges = 0;  // the number of edges with value 1 leaving the handle
+
+  for (int j = 0; j < size; j++) {
+    const int u = H[j];
+
+    for (int a = 0; a < nOne_[u]; a++) {
+      const int w = oneAdj_[2*u + a];
+
+      if (inHandle_[w]) continue;
+
+      if (tooth_[w] == -1) {
+        tooth_[w]             = nEdges;
+        teeth_[2*nEdges]      = u;
+        teeth_[2*nEdges + 1]  = w;
+        ++nEdges;
+      }
+      else {
+        teeth_[2*tooth_[w]] = -1;
+        handle_[nHandle++]  = w;
+        inHandle_[w]        = true;
+      }
+      break;
+    }
+  }
+
+@ @<remove the teeth sharing a node@>=
+  int nTeeth = 0;
+
+  for (int k = 0; k < nEdges; k++) {
+    const int w = teeth_[2*k + 1];
+
+    tooth_[w] = -1;
+    if (teeth_[2*k] != -1) {
+      teeth_[2*nTeeth]     = teeth_[2*k];
+      teeth_[2*nTeeth + 1] = w;
+      ++nTeeth;
+    }
+  }
+
+  for (int s = 0; s <= nTeeth; s++)
+    toothStart_[s] = 2*s;
+
+@ The function |comb()| uses a fractional component $H$ as handle, too.
+  From each edge with value 1 leaving $H$, we follow the path of edges
+  with value 1 until it reaches a node having a fractional edge or
+  returns to the handle. In the first case, the node in the handle and
+  the nodes of the path form a tooth, which has as many edges with value 1
+  as nodes minus 1. In the second case, the nodes of the path are added to
+  the handle. The result is equivalent to shrinking each path into a single
+  edge, applying the function |blossom()|, and expanding the shrunk
+  paths again.
+
+  A comb whose teeth have all two nodes and whose handle has been extended
+  only by single nodes is also found by the function |blossom()|. Therefore,
+  it is not generated again.
+
+  \BeginReturn
+  |true| if a violated comb inequality has been generated, |false|
+  otherwise.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|g|}{The fractional component used as handle.}
+  \docarg{|constraints|}{The generated constraint is added to this buffer.}
+  \docarg{|rank|}{The violation of the generated constraint is added to
+                  this buffer.}
+  \EndArg
+
+@(combsep.cc@>=
+  bool COMBSEPARATOR::comb(int g, ABA_BUFFER<ABA_CONSTRAINT*> &constraints,
+                           ABA_BUFFER<double> &rank)
+  {
+    const int size = compStart_[g + 1] - compStart_[g];
+    int *H = &compNodes_[compStart_[g]];  // the nodes of the component
+    int nHandle = 0;
+
+    for (int i = 0; i < size; i++) {
+      handle_[nHandle++] = H[i];
+      inHandle_[H[i]]    = true;
+    }
+
+    int nTeeth      = 0;
+    int nTeethNodes = 0;  // the number of nodes of the teeth
+    bool isBlossom  = true;  // |true| if the comb is a blossom
+
+    toothStart_[0] = 0;
+
+    for (int j = 0; j < size; j++) {
+      const int u = H[j];
+
+      for (int a = 0; a < nOne_[u]; a++) {
+        if (inHandle_[oneAdj_[2*u + a]]) continue;
+        @<follow the path of edges with value 1 leaving the handle@>;
+        break;
+      }
+    }
+
+    for (int l = 0; l < nHandle; l++)
+      inHandle_[handle_[l]] = false;
+
+    if (isBlossom) return false;
+
+    return generateComb(nHandle, nTeeth, constraints, rank);
+  }
+
+@ Like in the function |blossom()|, only the first edge with value 1
+  leaving the handle is considered for each node of the handle.
+  Since the lists |oneAdj_| are symmetric and each node has at most two
+  edges with value 1, the path ends either at a node with less than two
+  of these edges or at a node of the handle.
+
+@<follow the path of edges with value 1 leaving the handle@>=
+  int prev       = u;
+  int cur        = oneAdj_[2*u + a];
+  bool returns   = false;  // |true| if the path returns to the handle
+
+  teeth_[nTeethNodes++] = u;
+
+  for (;;) {
+    teeth_[nTeethNodes++] = cur;
+    if (nOne_[cur] < 2) break;
+
+    const int succ = (oneAdj_[2*cur] == prev) ? oneAdj_[2*cur + 1]
+                                              : oneAdj_[2*cur];
+    if (inHandle_[succ]) {
+      returns = true;
+      break;
+    }
+    prev = cur;
+    cur  = succ;
+  }
+
+  const int first = toothStart_[nTeeth];
+
+  if (nTeethNodes - first > 2) isBlossom = false;
+
+  if (returns) {
+    for (int p = first + 1; p < nTeethNodes; p++) {
+      handle_[nHandle++]    = teeth_[p];
+      inHandle_[teeth_[p]]  = true;
+    }
+    nTeethNodes = first;
+  }
+  else
+    toothStart_[++nTeeth] = nTeethNodes;
+
+@ The function |generateComb()| generates the comb inequality of the
+  handle stored in |handle_| and the teeth stored in |toothStart_| and
+  |teeth_| if it is violated.
+
+  \BeginReturn
+  |true| if the comb inequality has been generated, |false| otherwise.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|nHandle|}{The number of nodes of the handle.}
+  \docarg{|nTeeth|}{The number of teeth.}
+  \docarg{|constraints|}{The generated constraint is added to this buffer.}
+  \docarg{|rank|}{The violation of the generated constraint is added to
+                  this buffer.}
+  \EndArg
+
+@(combsep.cc@>=
+  bool COMBSEPARATOR::generateComb(int nHandle, int nTeeth,
+                                   ABA_BUFFER<ABA_CONSTRAINT*> &constraints,
+                                   ABA_BUFFER<double> &rank)
+  {
+    if (nTeeth < 3 || nTeeth % 2 == 0 || constraints.full()) return false;
+
+    const double v = violation(nHandle, nTeeth);
+
+    if (v <= master_->eps()) return false;
+
+    constraints.push(new COMB(master_, nHandle, &handle_[0],
+                              nTeeth, &toothStart_[0], &teeth_[0]));
+    rank.push(v);
+
+    return true;
+  }
+
+@ The function |violation()| evaluates the comb inequality of the handle
+  stored in |handle_| and the teeth stored in |toothStart_| and |teeth_|
+  for the LP-solution. Only the adjacency lists of the nodes of the comb
+  are scanned, where each edge is found from both of its end nodes.
+
+  \BeginReturn
+  The value of the left hand side minus the right hand side.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|nHandle|}{The number of nodes of the handle.}
+  \docarg{|nTeeth|}{The number of teeth.}
+  \EndArg
+
+@(combsep.cc@>=
+  double COMBSEPARATOR::violation(int nHandle, int nTeeth)
+  {
+    for (int i = 0; i < nHandle; i++)
+      inHandle_[handle_[i]] = true;
+    for (int j = 0; j < nTeeth; j++)
+      for (int k = toothStart_[j]; k < toothStart_[j + 1]; k++)
+        tooth_[teeth_[k]] = j;
+
+    double lhs = 0.0;  // twice the left hand side
+
+    for (int l = 0; l < nHandle; l++) {
+      const int u = handle_[l];
+
+      for (int a = adjStart_[u]; a < adjStart_[u + 1]; a++)
+        if (inHandle_[adjNode_[a]]) lhs += adjX_[a];
+    }
+
+    for (int s = 0; s < nTeeth; s++)
+      for (int p = toothStart_[s]; p < toothStart_[s + 1]; p++) {
+        const int v = teeth_[p];
+
+        for (int b = adjStart_[v]; b < adjStart_[v + 1]; b++)
+          if (tooth_[adjNode_[b]] == s) lhs += adjX_[b];
+      }
+
+    for (int m = 0; m < nHandle; m++)
+      inHandle_[handle_[m]] = false;
+    for (int q = 0; q < toothStart_[nTeeth]; q++)
+      tooth_[teeth_[q]] = -1;
+
+    const int rhs = nHandle + toothStart_[nTeeth] - nTeeth - (nTeeth + 1)/2;
+
+    return lhs/2.0 - rhs;
+  }
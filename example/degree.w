@@ -5,6 +5,7 @@
 @(degree.cc@>=
 #include "degree.h"
 #include "edge.h"
+#include "abacus/message.h"
 
 @ The constructor.
     \BeginArg
@@ -22,11 +23,49 @@
     node_(v)
   { }
 
+@ The message constructor restores a degree constraint packed by the
+  function |pack()|.
+    \BeginArg
+    \docarg{|master|}{A pointer to the corresponding master of the optimization.}
+    \docarg{|msg|}{The message from which the constraint is unpacked.}
+    \EndArg
+
+@(degree.cc@>=
+  DEGREE::DEGREE(ABA_MASTER *master, ABA_MESSAGE &msg) : @/
+    ABA_CONSTRAINT(master, msg), @/
+    node_(msg.unpackInt())
+  { }
+
 @ The destructor.
 
 @(degree.cc@>=
   DEGREE::~DEGREE()
   { }
+
+@ The function |pack()| packs the constraint in a message. It redefines
+  the virtual function of the base class |ABA_CONSTRAINT|, which has to be
+  called first.
+    \BeginArg
+    \docarg{|msg|}{The message in which the constraint is packed.}
+    \EndArg
+
+@(degree.cc@>=
+  void DEGREE::pack(ABA_MESSAGE &msg) const
+  {
+    ABA_CONSTRAINT::pack(msg);
+    msg.pack(node_);
+  }
+
+@ The function |classId()|.
+  \BeginReturn
+    The identification of the class |DEGREE|.
+  \EndReturn
+
+@(degree.cc@>=
+  int DEGREE::classId() const
+  {
+    return DEGREE_CLASSID;
+  }
   
 @ The function |coeff()|  defines the pure virtual function of the base 
   class |ABA_CONVAR| for the computation of a coefficient of a variable
@@ -52,3 +91,14 @@
     else                                                return 0.0;
   }
   
+@ The function |node()|.
+  \BeginReturn
+    The node associated with the degree constraint.
+  \EndReturn
+
+@(degree.cc@>=
+  int DEGREE::node() const
+  {
+    return node_;
+  }
+
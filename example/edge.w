@@ -7,6 +7,7 @@
 @(edge.cc@>=
 #include "edge.h"
 #include "abacus/master.h"
+#include "abacus/message.h"
 
 @ The constructor.
     \BeginArg
@@ -27,12 +28,52 @@
     head_(head)
   { }
 
+@ The message constructor restores an edge packed by the function
+  |pack()|.
+    \BeginArg
+    \docarg{|master|}{A pointer to the corresponding master of the optimization.}
+    \docarg{|msg|}{The message from which the edge is unpacked.}
+    \EndArg
+
+@(edge.cc@>=
+  EDGE::EDGE(ABA_MASTER *master, ABA_MESSAGE &msg) : @/
+    ABA_VARIABLE(master, msg), @/
+    tail_(msg.unpackInt()), @/
+    head_(msg.unpackInt())
+  { }
+
 @ The destructor.
 
 @(edge.cc@>=
   EDGE::~EDGE()
   { }
 
+@ The function |pack()| packs the edge in a message, e.g., for a
+  checkpoint. It redefines the virtual function of the base class
+  |ABA_VARIABLE|, which has to be called first.
+    \BeginArg
+    \docarg{|msg|}{The message in which the edge is packed.}
+    \EndArg
+
+@(edge.cc@>=
+  void EDGE::pack(ABA_MESSAGE &msg) const
+  {
+    ABA_VARIABLE::pack(msg);
+    msg.pack(tail_);
+    msg.pack(head_);
+  }
+
+@ The function |classId()|.
+  \BeginReturn
+    The identification of the class |EDGE|.
+  \EndReturn
+
+@(edge.cc@>=
+  int EDGE::classId() const
+  {
+    return EDGE_CLASSID;
+  }
+
 @ The function |tail()|.
   \BeginReturn
     The tail node of the edge.
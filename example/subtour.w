@@ -7,6 +7,7 @@
 #include "tspmaster.h"
 #include "subtour.h"
 #include "edge.h"
+#include "abacus/message.h"
 
 @ The constructor.
   \BeginArg
@@ -27,6 +28,21 @@
     for (int i = 0; i < nNodes; i++) nodes_[i] = nodes[i];
   }
 
+@ The message constructor restores a subtour elimination constraint
+  packed by the function |pack()|. The constraint is unpacked in the
+  compressed format.
+  \BeginArg
+  \docarg{|master|}{A pointer to the corresponding master of the optimization.}
+  \docarg{|msg|}{The message from which the constraint is unpacked.}
+  \EndArg
+
+@(subtour.cc@>=
+  SUBTOUR::SUBTOUR(ABA_MASTER *master, ABA_MESSAGE &msg) : @/
+    ABA_CONSTRAINT(master, msg), @/
+    nodes_(master, msg), @/
+    marked_(0)
+  { }
+
 @ The destructor.
 
 @(subtour.cc@>=
@@ -35,6 +51,32 @@
     if (expanded_) delete [] marked_;
   }
 
+@ The function |pack()| packs the constraint in a message. It redefines
+  the virtual function of the base class |ABA_CONSTRAINT|, which has to be
+  called first. Only the nodes of the set $W$ are packed, since the
+  expanded format can be computed again.
+  \BeginArg
+  \docarg{|msg|}{The message in which the constraint is packed.}
+  \EndArg
+
+@(subtour.cc@>=
+  void SUBTOUR::pack(ABA_MESSAGE &msg) const
+  {
+    ABA_CONSTRAINT::pack(msg);
+    nodes_.pack(msg);
+  }
+
+@ The function |classId()|.
+  \BeginReturn
+    The identification of the class |SUBTOUR|.
+  \EndReturn
+
+@(subtour.cc@>=
+  int SUBTOUR::classId() const
+  {
+    return SUBTOUR_CLASSID;
+  }
+
 @ The function |coeff()| computes the coefficient of the edge $(t,h)$.
   It redefines the pure virtual function of the base class |ABA_CONSTRAINT|.
   The coefficient of an edge |(t,h)| of a subtour elimination constraint
@@ -138,3 +180,29 @@
   {
     delete [] marked_;
   }
+
+@ The function |nNodes()|.
+  \BeginReturn
+    The number of nodes of the set $W$.
+  \EndReturn
+
+@(subtour.cc@>=
+  int SUBTOUR::nNodes() const
+  {
+    return nodes_.size();
+  }
+
+@ The function |node()|.
+  \BeginReturn
+    The |i|-th node of the set $W$.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|i|}{The number of the node, $0 \le i < |nNodes()|$.}
+  \EndArg
+
+@(subtour.cc@>=
+  int SUBTOUR::node(int i) const
+  {
+    return nodes_[i];
+  }
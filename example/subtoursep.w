@@ -0,0 +1,549 @@
+@q 2026 by the ABACUS developers @>
+
+@ All member functions are defined in the file {\tt subtoursep.cc}.
+
+@(subtoursep.cc@>=
+#include "subtoursep.h"
+#include "tspmaster.h"
+#include "edge.h"
+#include "subtour.h"
+
+extern "C" {
+#include "PadbergRinaldi.h"
+}
+
+@ The constructor allocates the arrays depending on the number of nodes.
+  The arrays of the support graph are enlarged in the function
+  |setUpSupportGraph()| if required.
+  \BeginArg
+  \docarg{|master|}{A pointer to the corresponding master of the optimization.}
+  \EndArg
+
+@(subtoursep.cc@>=
+  SUBTOURSEPARATOR::SUBTOURSEPARATOR(TSPMASTER *master) : @/
+    master_(master), @/
+    nNodes_(master->nNodes()), @/
+    nSupEdges_(0), @/
+    supTail_(master, 1), @/
+    supHead_(master, 1), @/
+    supX_(master, 1), @/
+    adjStart_(master, nNodes_ + 1, 0), @/
+    adjNode_(master, 1), @/
+    adjX_(master, 1), @/
+    oldAdjStart_(master, nNodes_ + 1, 0), @/
+    oldAdjNode_(master, 1), @/
+    oldAdjX_(master, 1), @/
+    clean_(master, nNodes_, false), @/
+    conComp_(master, nNodes_), @/
+    nComp_(0), @/
+    nUnchanged_(0), @/
+    compOfRep_(master, nNodes_), @/
+    component_(master, nNodes_), @/
+    compStart_(master, nNodes_ + 1), @/
+    compNodes_(master, nNodes_), @/
+    compNext_(master, nNodes_), @/
+    node_(master, nNodes_ + 1), @/
+    prCutNodes_(master, nNodes_ + 1), @/
+    cutNodes_(master, nNodes_), @/
+    marked_(master, nNodes_, false) @/
+  { }
+
+@ The destructor.
+
+@(subtoursep.cc@>=
+  SUBTOURSEPARATOR::~SUBTOURSEPARATOR()
+  { }
+
+@ The function |separate()| generates violated subtour elimination
+  constraints for the LP-solution of a subproblem.
+  First, we compute the connected components of the support graph.
+  If there are several ones, each component induces already a violated
+  subtour elimination constraint. Then, we solve the minimum cut problem
+  in the subgraph induced by each component and split its shores again
+  recursively (see the function |splitSubtours()|), unless the component
+  has not changed since the previous round and was not split in that
+  round.
+
+  \BeginArg
+  \docarg{|sub|}{The subproblem whose LP-solution is separated.}
+  \docarg{|constraints|}{The generated constraints are added to this buffer.}
+  \docarg{|rank|}{The violation of each generated constraint is added to
+                  this buffer.}
+  \EndArg
+
+@(subtoursep.cc@>=
+  void SUBTOURSEPARATOR::separate(ABA_SUB *sub,
+                                  ABA_BUFFER<ABA_CONSTRAINT*> &constraints,
+                                  ABA_BUFFER<double> &rank)
+  {
+    setUpSupportGraph(sub);
+    computeComponents();
+    @<generate a subtour elimination constraint for each component@>;
+    @<split the changed components by minimum cuts@>;
+    @<keep the support graph for the next round@>;
+  }
+
+@ No edge of the support graph leaves a component. Hence, the subtour
+  elimination constraint of each component has cut value 0. If there
+  are exactly two components, both constraints are equivalent because of
+  the degree constraints, and we only generate the one of the smaller
+  component.
+
+@<generate a subtour elimination constraint for each component@>=
+  if (nComp_ > 1) {
+    for (int g = 0; g < nComp_; g++) {
+      const int size = compStart_[g + 1] - compStart_[g];
+
+      if (nComp_ == 2 && (size > nNodes_ - size || (size == nNodes_ - size && g == 1)))
+        continue;
+      generateSubtour(size, &compNodes_[compStart_[g]], 0.0, constraints, rank);
+    }
+  }
+
+@ A subtour elimination constraint of a node set with at most 2 nodes
+  is never violated. Therefore, only components with at least 4 nodes
+  have to be split. The flags |clean_| of the nodes of a component record
+  if no subset of the component defines a violated constraint.
+
+@<split the changed components by minimum cuts@>=
+  nUnchanged_ = 0;
+
+  for (int h = 0; h < nComp_; h++) {
+    const int size = compStart_[h + 1] - compStart_[h];
+    int *W = &compNodes_[compStart_[h]];  // the nodes of the component
+    bool clean;
+
+    if (size < 4)
+      clean = true;
+    else if (unchanged(size, W)) {
+      clean = true;
+      ++nUnchanged_;
+    }
+    else
+      clean = splitSubtours(size, W, constraints, rank);
+
+    for (int k = 0; k < size; k++)
+      clean_[W[k]] = clean;
+  }
+
+@ @<keep the support graph for the next round@>=
+  oldAdjStart_.copy(adjStart_);
+  oldAdjNode_.copy(adjNode_, 0, 2*nSupEdges_ - 1);
+  oldAdjX_.copy(adjX_, 0, 2*nSupEdges_ - 1);
+
+@ The function |setUpSupportGraph()| stores the edges having non-zero
+  value in the LP-solution of a subproblem.
+  The function we will use for solving the minimum cut problems requires
+  that the nodes are numbered beginning with 1 and the first used
+  component of an array has the number 1.
+
+  \BeginArg
+  \docarg{|sub|}{The subproblem.}
+  \EndArg
+
+@(subtoursep.cc@>=
+  void SUBTOURSEPARATOR::setUpSupportGraph(ABA_SUB *sub)
+  {
+    @<store the edges of the support graph@>;
+    @<build the adjacency lists of the support graph@>;
+  }
+
+@ @<store the edges of the support graph@>=
+  const int nVar = sub->nVar();
+
+  if (supTail_.size() < nVar + 1) {
+    supTail_.realloc(nVar + 1);
+    supHead_.realloc(nVar + 1);
+    supX_.realloc(nVar + 1);
+  }
+
+  nSupEdges_ = 0;
+
+  for (int i = 0; i < nVar; i++)
+    if (sub->xVal(i) > master_->machineEps()) {
+      EDGE *e = (EDGE*) sub->variable(i);
+
+      ++nSupEdges_;
+      supTail_[nSupEdges_] = e->tail() + 1;
+      supHead_[nSupEdges_] = e->head() + 1;
+      supX_[nSupEdges_]    = sub->xVal(i);
+    }
+
+@ The neighbors of node |v| are |adjNode_[adjStart_[v]]|, \dots,
+  |adjNode_[adjStart_[v+1]-1]|, and |adjX_| holds the value of the
+  corresponding edge. First, |adjStart_[v]| is the end of the list of
+  node |v|, such that it becomes its beginning while the edges are
+  inserted. The neighbors are sorted by their numbers, such that the
+  adjacency lists can be compared with those of the previous round
+  (see the function |unchanged()|).
+
+@<build the adjacency lists of the support graph@>=
+  if (adjNode_.size() < 2*nSupEdges_) {
+    adjNode_.realloc(2*nSupEdges_);
+    adjX_.realloc(2*nSupEdges_);
+  }
+
+  for (int u = 0; u <= nNodes_; u++)
+    adjStart_[u] = 0;
+  for (int f = 1; f <= nSupEdges_; f++) {
+    ++adjStart_[supTail_[f] - 1];
+    ++adjStart_[supHead_[f] - 1];
+  }
+  for (int v = 1; v < nNodes_; v++)
+    adjStart_[v] += adjStart_[v - 1];
+  adjStart_[nNodes_] = 2*nSupEdges_;
+
+  for (int g = nSupEdges_; g >= 1; g--) {
+    int a = --adjStart_[supTail_[g] - 1];
+    adjNode_[a] = supHead_[g] - 1;
+    adjX_[a]    = supX_[g];
+
+    a = --adjStart_[supHead_[g] - 1];
+    adjNode_[a] = supTail_[g] - 1;
+    adjX_[a]    = supX_[g];
+  }
+
+  @<sort the adjacency lists@>;
+
+@ Since the support graph is sparse, the adjacency lists are short
+  and are sorted by insertion.
+
+@<sort the adjacency lists@>=
+  for (int w = 0; w < nNodes_; w++)
+    for (int b = adjStart_[w] + 1; b < adjStart_[w + 1]; b++) {
+      const int    neighbor = adjNode_[b];
+      const double x        = adjX_[b];
+      int          c        = b;
+
+      while (c > adjStart_[w] && adjNode_[c - 1] > neighbor) {
+        adjNode_[c] = adjNode_[c - 1];
+        adjX_[c]    = adjX_[c - 1];
+        --c;
+      }
+      adjNode_[c] = neighbor;
+      adjX_[c]    = x;
+    }
+
+@ The function |computeComponents()| computes the connected components
+  of the support graph with a disjoint set data structure
+  like in the function |TSPSUB::feasible()|. Afterwards, the nodes are
+  sorted by their components, such that the nodes of component |c| are
+  |compNodes_[compStart_[c]]|, \dots, |compNodes_[compStart_[c+1]-1]|.
+
+@(subtoursep.cc@>=
+  void SUBTOURSEPARATOR::computeComponents()
+  {
+    for (int u = 0; u < nNodes_; u++) {
+      conComp_.makeSet(u);
+      compOfRep_[u] = -1;
+      compStart_[u + 1] = 0;
+    }
+    for (int e = 1; e <= nSupEdges_; e++)
+      conComp_.unionSets(supTail_[e] - 1, supHead_[e] - 1);
+
+    compStart_[0] = 0;
+    nComp_        = 0;
+
+    for (int w = 0; w < nNodes_; w++) {
+      int rep = conComp_.findSet(w);
+      if (compOfRep_[rep] == -1) compOfRep_[rep] = nComp_++;
+      component_[w] = compOfRep_[rep];
+      ++compStart_[component_[w] + 1];
+    }
+
+    for (int c = 0; c < nComp_; c++)
+      compStart_[c + 1] += compStart_[c];
+
+    for (int d = 0; d < nComp_; d++)
+      compNext_[d] = compStart_[d];
+    for (int z = 0; z < nNodes_; z++)
+      compNodes_[compNext_[component_[z]]++] = z;
+  }
+
+@ The function |unchanged()| checks if a component can be skipped.
+  The minimum cut of the subgraph induced by the component depends only
+  on the edges of this subgraph. If each node of the component has the
+  same neighbors with the same values as in the previous round, then
+  the component is also a component of the support graph of the previous
+  round. If its minimum cut had at least the value 2 in that round, no
+  subset of the component defines a violated subtour elimination
+  constraint. Note that the support graph of the previous round might
+  belong to another subproblem, which does not matter.
+
+  \BeginReturn
+  |true| if the component is known to define no violated constraint,
+  |false| otherwise.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|nW|}{The number of nodes of the component.}
+  \docarg{|W|}{The nodes of the component.}
+  \EndArg
+
+@(subtoursep.cc@>=
+  bool SUBTOURSEPARATOR::unchanged(int nW, int *W)
+  {
+    for (int i = 0; i < nW; i++) {
+      const int u      = W[i];
+      const int first  = adjStart_[u];
+      const int degree = adjStart_[u + 1] - first;
+      const int old    = oldAdjStart_[u];
+
+      if (!clean_[u] || oldAdjStart_[u + 1] - old != degree) return false;
+
+      for (int j = 0; j < degree; j++)
+        if (adjNode_[first + j] != oldAdjNode_[old + j] ||
+            adjX_[first + j]    != oldAdjX_[old + j])
+          return false;
+    }
+
+    return true;
+  }
+
+@ The function |splitSubtours()| generates the subtour elimination
+  constraints of the shores of the minimum cut in the subgraph induced
+  by a set of nodes |W|, and splits both shores recursively.
+
+  The value of a cut in the support graph is at least its value in a
+  subgraph induced by a node set containing its shore. Therefore, if the
+  minimum cut of the subgraph induced by |W| has value at least 2, no
+  subset of |W| defines a violated constraint, and the recursion stops.
+  Otherwise, the shores of the minimum cut have small cut values in the
+  support graph, too, although not necessarily the minimal one. Since the
+  shores of the recursion form a laminar family, no constraint is
+  generated twice, except for the two shores of a minimum cut of the
+  whole graph. In this case, we only generate the smaller shore.
+
+  The nodes of |W| are reordered such that the shores are stored
+  consecutively. Hence, no memory has to be allocated for the shores.
+
+  \BeginReturn
+  |true| if no subset of |W| defines a violated constraint,
+  |false| otherwise or if this is not known.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|nW|}{The number of nodes of |W|.}
+  \docarg{|W|}{The nodes inducing the subgraph.}
+  \docarg{|constraints|}{The generated constraints are added to this buffer.}
+  \docarg{|rank|}{The violation of each generated constraint is added to
+                  this buffer.}
+  \EndArg
+
+@(subtoursep.cc@>=
+  bool SUBTOURSEPARATOR::splitSubtours(int nW, int *W,
+                                       ABA_BUFFER<ABA_CONSTRAINT*> &constraints,
+                                       ABA_BUFFER<double> &rank)
+  {
+    @<compute the minimum cut of the subgraph induced by |W|@>;
+    @<move the shore of the minimum cut to the front of |W|@>;
+    @<generate the subtour elimination constraints of both shores@>;
+    @<split both shores recursively@>;
+    return false;
+  }
+
+@ The shores of a minimum cut of a connected graph are connected, hence
+  every subgraph induced by |W| is connected, too.
+
+@<compute the minimum cut of the subgraph induced by |W|@>=
+  if (nW < 4) return true;
+  if (constraints.full()) return false;
+
+  int nS;  // the number of nodes of the shore |S| of the cut
+
+  double inducedValue = minCut(nW, W, nS, &cutNodes_[0]);
+
+  if (inducedValue >= 2.0 - master_->eps()) return true;
+  if (nS == 0 || nS == nW) return false;
+
+@ @<move the shore of the minimum cut to the front of |W|@>=
+  for (int i = 0; i < nS; i++)
+    marked_[cutNodes_[i]] = true;
+
+  int front = 0;       // the nodes in front of |front| belong to |S|
+  int back  = nW - 1;  // the nodes behind |back| belong to the other shore
+
+  while (front < back) {
+    if (marked_[W[front]]) ++front;
+    else if (!marked_[W[back]]) --back;
+    else {
+      int help = W[front];
+      W[front] = W[back];
+      W[back]  = help;
+    }
+  }
+
+  for (int j = 0; j < nS; j++)
+    marked_[cutNodes_[j]] = false;
+
+  int *S = W;  // the shore of the cut
+  int nT = nW - nS;  // the number of nodes of the other shore |T|
+  int *T = W + nS;  // the other shore of the cut
+
+@ @<generate the subtour elimination constraints of both shores@>=
+  if (nW == nNodes_) {
+    if (nS <= nT) generateSubtour(nS, S, inducedValue, constraints, rank);
+    else          generateSubtour(nT, T, inducedValue, constraints, rank);
+  }
+  else {
+    generateSubtour(nS, S, cutValue(nS, S), constraints, rank);
+    generateSubtour(nT, T, cutValue(nT, T), constraints, rank);
+  }
+
+@ @<split both shores recursively@>=
+  splitSubtours(nS, S, constraints, rank);
+  splitSubtours(nT, T, constraints, rank);
+
+@ The function |generateSubtour()| generates the subtour elimination
+  constraint of a node set if it is violated.
+
+  \BeginArg
+  \docarg{|nCutNodes|}{The number of nodes of the set.}
+  \docarg{|cutNodes|}{The nodes of the set.}
+  \docarg{|value|}{The value of the cut defined by the set in the support
+                   graph.}
+  \docarg{|constraints|}{The generated constraint is added to this buffer.}
+  \docarg{|rank|}{The violation of the generated constraint is added to
+                  this buffer.}
+  \EndArg
+
+@(subtoursep.cc@>=
+  void SUBTOURSEPARATOR::generateSubtour(int nCutNodes, int *cutNodes,
+                                         double value,
+                                         ABA_BUFFER<ABA_CONSTRAINT*> &constraints,
+                                         ABA_BUFFER<double> &rank)
+  {
+    if (value >= 2.0 - master_->eps() || constraints.full()) return;
+    if (nCutNodes < 3 || nCutNodes > nNodes_ - 3) return;
+
+    constraints.push(new SUBTOUR(master_, nCutNodes, cutNodes));
+    rank.push(2.0 - value);
+  }
+
+@ The function |cutValue()| computes the value of the cut defined by
+  a node set in the support graph. Only the adjacency lists of the
+  nodes of the set are scanned.
+
+  \BeginReturn
+  The sum of the values of the edges with exactly one end node in the set.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|nCutNodes|}{The number of nodes of the set.}
+  \docarg{|cutNodes|}{The nodes of the set.}
+  \EndArg
+
+@(subtoursep.cc@>=
+  double SUBTOURSEPARATOR::cutValue(int nCutNodes, int *cutNodes)
+  {
+    for (int i = 0; i < nCutNodes; i++)
+      marked_[cutNodes[i]] = true;
+
+    double value = 0.0;
+
+    for (int j = 0; j < nCutNodes; j++) {
+      const int u = cutNodes[j];
+
+      for (int a = adjStart_[u]; a < adjStart_[u + 1]; a++)
+        if (!marked_[adjNode_[a]]) value += adjX_[a];
+    }
+
+    for (int k = 0; k < nCutNodes; k++)
+      marked_[cutNodes[k]] = false;
+
+    return value;
+  }
+
+@ The function |minCut()| computes the minimum cut in the subgraph of
+  the support graph induced by a node set.
+
+  \BeginReturn
+  The value of the minimum cut.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|nNodes|}{The number of nodes inducing the subgraph.}
+  \docarg{|nodes|}{The nodes inducing the subgraph.}
+  \docarg{|nCutNodes|}{Holds the number of nodes stored in the array
+                       |cutNodes| after the function call.}
+  \docarg{|cutNodes|}{Stores one shore of the minimum cut. This array
+                      must have the length at least |nNodes| minus 1.}
+  \EndArg
+
+@(subtoursep.cc@>=
+  double SUBTOURSEPARATOR::minCut(int nNodes, int *nodes, int &nCutNodes,
+                                  int *cutNodes)
+  {
+    @<initialize the node induced subgraph@>;
+    @<call the Padberg-Rinaldi algorithm@>;
+  }
+
+@ The function |PadbergRinaldi()|
+  can compute the minimum cut of a subgraph induced by a set of nodes.
+  Therefore, we store the nodes in the array |node_| in the numbering
+  beginning with 1. Edges with an end node outside of this set
+  are ignored by |PadbergRinaldi()|. If the subgraph is the whole graph,
+  we tell this to |PadbergRinaldi()|, such that it avoids the mapping of
+  the nodes. There are further techniques to accelerate the solution of
+  this separation problem (see [PR90]).
+
+@<initialize the node induced subgraph@>=
+  int oneToN = (nNodes == nNodes_);  // |true| for the whole graph
+
+  for (int i = 0; i < nNodes; i++)
+    node_[i + 1] = nodes[i] + 1;
+
+@ For the solution of the minimum cut problem, we use the Padberg-Rinaldi
+  algorithm that is part of a package for the solution of minimum
+  cut problems [JRT97b] and turned out to be very fast for solving the
+  separation problem for the subtour elimination constraints [JRT97a].
+
+  The function |PadbergRinaldi()| stores the nodes defining a shore of
+  minimum the cut
+  in the components \hbox{1,\dots, |nCutNodes|} of an array and numbers the nodes
+  beginning at 1.  Therefore, we require an extra array for calling
+  this function and have to transform the node set. The function
+  |PadbergRinaldi()| sorts the edges of the support graph, which is no
+  problem for the further minimum cut problems of this round.
+  The package provides no interface for reusing the flows of a previous
+  call.
+
+@<call the Padberg-Rinaldi algorithm@>=
+  double cutValue;
+
+  PadbergRinaldi(nNodes_, nSupEdges_, nNodes, oneToN,
+                 &node_[0], &supTail_[0], &supHead_[0], &supX_[0],
+                 &nCutNodes, &prCutNodes_[0], &cutValue);
+
+#ifdef ABACUS_NO_FOR_SCOPE
+  for (i = 0; i < nCutNodes; i++)
+#else
+  for (int i = 0; i < nCutNodes; i++)
+#endif
+    cutNodes[i] = prCutNodes_[i+1] - 1;
+
+  return cutValue;
+
+@ The function |nComponents()|.
+  \BeginReturn
+  The number of connected components of the support graph of the last
+  round.
+  \EndReturn
+
+@(subtoursep.cc@>=
+  int SUBTOURSEPARATOR::nComponents() const
+  {
+    return nComp_;
+  }
+
+@ The function |nUnchanged()|.
+  \BeginReturn
+  The number of components of the last round, which have been skipped
+  because they have not changed since the previous round.
+  \EndReturn
+
+@(subtoursep.cc@>=
+  int SUBTOURSEPARATOR::nUnchanged() const
+  {
+    return nUnchanged_;
+  }
@@ -0,0 +1,640 @@
+@q 2026 by the ABACUS developers @>
+
+@ All member functions are defined in the file {\tt tourheur.cc}.
+
+@(tourheur.cc@>=
+#include "tourheur.h"
+#include "tspmaster.h"
+#include "edge.h"
+#include "abacus/sub.h"
+#include "abacus/buffer.h"
+#include "abacus/sorter.h"
+
+#include <limits.h>
+
+@ The constructor computes the neighbor lists. If there are less than
+  |nNeighbors| other nodes, each neighbor list contains all other nodes.
+  \BeginArg
+  \docarg{|master|}{A pointer to the corresponding master of the optimization.}
+  \docarg{|nNeighbors|}{The number of nearest neighbors of each node
+                        considered by the local search. If it is 0,
+                        no local search is performed.}
+  \EndArg
+
+@(tourheur.cc@>=
+  TOURHEURISTIC::TOURHEURISTIC(TSPMASTER *master, int nNeighbors) : @/
+    master_(master), @/
+    nNodes_(master->nNodes()), @/
+    nNeighbors_(nNeighbors < nNodes_ - 1 ? nNeighbors : nNodes_ - 1), @/
+    neighbors_(master, nNodes_*nNeighbors_ + 1), @/
+    tour_(master, nNodes_), @/
+    pos_(master, nNodes_), @/
+    queue_(master, nNodes_), @/
+    inQueue_(master, nNodes_, false), @/
+    first_(0), @/
+    nQueue_(0), @/
+    degree_(master, nNodes_), @/
+    adj_(master, 2*nNodes_), @/
+    fragments_(master, nNodes_) @/
+  {
+    ABA_ARRAY<int> distRow(master_, nNodes_);  // the distances from a node
+
+    for (int v = 0; v < nNodes_; v++)
+      master_->closestNodes(v, nNeighbors_, &neighbors_[v*nNeighbors_], distRow);
+  }
+
+@ The copy constructor copies only the neighbor lists. The other members
+  are work space of the functions |lpTour()| and |improve()|, hence
+  a copy can be used concurrently with the original object.
+  \BeginArg
+  \docarg{|rhs|}{The object being copied.}
+  \EndArg
+
+@(tourheur.cc@>=
+  TOURHEURISTIC::TOURHEURISTIC(const TOURHEURISTIC &rhs) : @/
+    master_(rhs.master_), @/
+    nNodes_(rhs.nNodes_), @/
+    nNeighbors_(rhs.nNeighbors_), @/
+    neighbors_(rhs.neighbors_), @/
+    tour_(rhs.master_, nNodes_), @/
+    pos_(rhs.master_, nNodes_), @/
+    queue_(rhs.master_, nNodes_), @/
+    inQueue_(rhs.master_, nNodes_, false), @/
+    first_(0), @/
+    nQueue_(0), @/
+    degree_(rhs.master_, nNodes_), @/
+    adj_(rhs.master_, 2*nNodes_), @/
+    fragments_(rhs.master_, nNodes_) @/
+  { }
+
+@ The destructor.
+
+@(tourheur.cc@>=
+  TOURHEURISTIC::~TOURHEURISTIC()
+  { }
+
+@ The function |lpTour()| constructs a tour guided by the LP-solution of
+  a subproblem. The edges of the support graph are selected greedily in
+  the order of their values, as long as they form paths. These paths
+  are joined to a tour, which is finally improved by the local search.
+
+  \BeginReturn
+  The length of the tour.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|sub|}{The subproblem.}
+  \docarg{|succ|}{Stores the successor of each node in the tour after
+                  the execution of the function. Its size must be at
+                  least the number of nodes.}
+  \EndArg
+
+@(tourheur.cc@>=
+  int TOURHEURISTIC::lpTour(ABA_SUB *sub, ABA_ARRAY<int> &succ)
+  {
+    const int nVar = sub->nVar();
+    ABA_ARRAY<double> xVal(master_, nVar + 1);  // the LP-solution
+
+    for (int i = 0; i < nVar; i++)
+      xVal[i] = sub->xVal(i);
+
+    return lpTour(nVar, &xVal[0], sub->actVar(), succ);
+  }
+
+@ The second version of the function |lpTour()| constructs the tour
+  from an LP-solution given by the values of the active variables, e.g.,
+  from a copy of the LP-solution passed to |TSPMASTER::asyncImprove()|.
+
+  \BeginReturn
+  The length of the tour.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|nVar|}{The number of active variables.}
+  \docarg{|xVal|}{The value of each active variable.}
+  \docarg{|actVar|}{The active variables.}
+  \docarg{|succ|}{Stores the successor of each node in the tour after
+                  the execution of the function. Its size must be at
+                  least the number of nodes.}
+  \EndArg
+
+@(tourheur.cc@>=
+  int TOURHEURISTIC::lpTour(int nVar, const double *xVal,
+                            ABA_ACTIVE<ABA_VARIABLE, ABA_CONSTRAINT> *actVar,
+                            ABA_ARRAY<int> &succ)
+  {
+    selectEdges(nVar, xVal, actVar);
+    joinFragments(succ);
+    return improve(succ);
+  }
+
+@ The function |selectEdges()| selects the edges of the support graph
+  in the order of decreasing values, and edges having the same value
+  in the order of increasing lengths. An edge is selected if both
+  end nodes have less than two selected edges and the edge does not
+  close a cycle. The paths of the selected edges are maintained with
+  a disjoint set data structure like in the function |TSPSUB::feasible()|.
+
+  \BeginArg
+  \docarg{|nVar|}{The number of active variables.}
+  \docarg{|xVal|}{The value of each active variable.}
+  \docarg{|actVar|}{The active variables.}
+  \EndArg
+
+@(tourheur.cc@>=
+  void TOURHEURISTIC::selectEdges(int nVar, const double *xVal,
+                                  ABA_ACTIVE<ABA_VARIABLE, ABA_CONSTRAINT> *actVar)
+  {
+    @<sort the edges of the support graph by their values@>;
+    @<sort the edges having the same value by their lengths@>;
+    @<select the edges greedily@>;
+  }
+
+@ @<sort the edges of the support graph by their values@>=
+  ABA_ARRAY<int> edges(master_, nVar + 1);  // the edges of the support graph
+  ABA_ARRAY<double> keys(master_, nVar + 1);  // the sorting keys of the edges
+  int nEdges = 0;  // the number of edges of the support graph
+
+  for (int i = 0; i < nVar; i++)
+    if (xVal[i] > master_->machineEps()) {
+      edges[nEdges] = i;
+      keys[nEdges]  = -xVal[i];
+      ++nEdges;
+    }
+
+  ABA_SORTER<int, double> sorter(master_);
+
+  sorter.quickSort(nEdges, edges, keys);
+
+@ @<sort the edges having the same value by their lengths@>=
+  int start = 0;  // the first edge having the value of |keys[start]|
+
+  while (start < nEdges) {
+    int end = start + 1;  // the first edge having another value
+
+    while (end < nEdges && master_->equal(keys[end], keys[start]))
+      ++end;
+
+    if (end - start > 1) {
+      for (int j = start; j < end; j++)
+        keys[j] = (*actVar)[edges[j]]->obj();
+      sorter.quickSort(edges, keys, start, end - 1);
+    }
+    start = end;
+  }
+
+@ @<select the edges greedily@>=
+  for (int v = 0; v < nNodes_; v++) {
+    degree_[v] = 0;
+    fragments_.makeSet(v);
+  }
+
+  for (int r = 0; r < nEdges; r++) {
+    EDGE *e = (EDGE *) (*actVar)[edges[r]];
+    const int t = e->tail();
+    const int h = e->head();
+
+    if (degree_[t] < 2 && degree_[h] < 2 &&
+        fragments_.findSet(t) != fragments_.findSet(h)) {
+      fragments_.unionSets(t, h);
+      adj_[2*t + degree_[t]++] = h;
+      adj_[2*h + degree_[h]++] = t;
+    }
+  }
+
+@ The function |joinFragments()| joins the paths formed by the selected
+  edges to a tour. A node without selected edges forms a path on its own.
+  Starting from an end node of a path, we follow the path and continue
+  with the closest end node of a path not visited so far, like in the
+  function |TSPMASTER::nearestNeighbor()|.
+
+  \BeginArg
+  \docarg{|succ|}{Stores the successor of each node in the tour after
+                  the execution of the function.}
+  \EndArg
+
+@(tourheur.cc@>=
+  void TOURHEURISTIC::joinFragments(ABA_ARRAY<int> &succ)
+  {
+    @<collect the end nodes of the paths@>;
+    @<follow the paths@>;
+  }
+
+@ Since the selected edges form no cycle, there is at least one
+  end node.
+
+@<collect the end nodes of the paths@>=
+  ABA_BUFFER<int> ends(master_, nNodes_);  // the end nodes of the paths
+  ABA_ARRAY<bool> visited(master_, nNodes_, false);  // the nodes already in the tour
+
+  for (int v = 0; v < nNodes_; v++)
+    if (degree_[v] < 2) ends.push(v);
+
+@ @<follow the paths@>=
+  int last = -1;        // the last node added to the tour
+  int front = ends[0];  // the first node of the next path
+
+  while (front != -1) {
+    @<add the path starting at |front| to the tour@>;
+    @<find the closest end node |front| of a path not visited@>;
+  }
+
+  succ[last] = ends[0];
+
+@ @<add the path starting at |front| to the tour@>=
+  int from = -1;  // the predecessor of |u| on the path
+  int u = front;  // the current node of the path
+
+  while (u != -1) {
+    visited[u] = true;
+    if (last != -1) succ[last] = u;
+    last = u;
+
+    int w = -1;  // the successor of |u| on the path
+    for (int k = 0; k < degree_[u]; k++)
+      if (adj_[2*u + k] != from) w = adj_[2*u + k];
+
+    from = u;
+    u    = w;
+  }
+
+@ @<find the closest end node |front| of a path not visited@>=
+  int minDist = INT_MAX;  // the distance from |last| to |front|
+
+  front = -1;
+  for (int i = 0; i < ends.number(); i++)
+    if (!visited[ends[i]] && master_->dist(last, ends[i]) < minDist) {
+      front   = ends[i];
+      minDist = master_->dist(last, front);
+    }
+
+@ The function |improve()| applies improving 2-opt and Or-opt moves to
+  a tour until no node of the queue admits such a move. Initially, all
+  nodes are in the queue. If no local search is performed, only the
+  length of the tour is computed.
+
+  \BeginReturn
+  The length of the improved tour.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|succ|}{The successor of each node in the tour, which is
+                  replaced by the successor in the improved tour.}
+  \EndArg
+
+@(tourheur.cc@>=
+  int TOURHEURISTIC::improve(ABA_ARRAY<int> &succ)
+  {
+    if (nNeighbors_ > 0 && nNodes_ >= 8) {
+      @<store the tour in |tour_| and put all nodes into the queue@>;
+      @<apply improving moves until the queue is empty@>;
+      @<store the successors of the improved tour@>;
+    }
+    @<compute the length of the tour and return it@>;
+  }
+
+@ @<store the tour in |tour_| and put all nodes into the queue@>=
+  int v = 0;
+
+  for (int i = 0; i < nNodes_; i++) {
+    tour_[i] = v;
+    pos_[v]  = i;
+    v = succ[v];
+  }
+
+  first_  = 0;
+  nQueue_ = 0;
+  for (int j = 0; j < nNodes_; j++)
+    push(tour_[j]);
+
+@ The node |a| is examined again if a move has been found, because
+  there might be further improving moves adding an edge incident to it.
+
+@<apply improving moves until the queue is empty@>=
+  while (nQueue_ > 0) {
+    const int a = pop();
+
+    if (twoOpt(a) || orOpt(a)) push(a);
+  }
+
+@ @<store the successors of the improved tour@>=
+  for (int k = 0; k < nNodes_ - 1; k++)
+    succ[tour_[k]] = tour_[k + 1];
+  succ[tour_[nNodes_ - 1]] = tour_[0];
+
+@ @<compute the length of the tour and return it@>=
+  int length = 0;
+
+  for (int u = 0; u < nNodes_; u++)
+    length += master_->dist(u, succ[u]);
+
+  return length;
+
+@ The function |twoOpt()| searches a 2-opt move replacing an edge
+  $(a,b)$ of the tour, where $b$ is the successor or the predecessor of
+  |a|. The edge $(a,c)$ must be shorter than $(a,b)$ if the move is
+  improving, such that the scan of the neighbor list of |a| can be
+  stopped at the first node not closer to |a| than |b|. If $b$ is the
+  successor of |a|, then $d$ is the successor of |c|, and the edges
+  $(a,b)$ and $(c,d)$ are replaced by $(a,c)$ and $(b,d)$ by reversing
+  the path from |b| to |c|. Otherwise, both are the predecessors, and
+  the path from |a| to |d| is reversed.
+
+  \BeginReturn
+  |true| if an improving move has been performed, |false| otherwise.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|a|}{The node.}
+  \EndArg
+
+@(tourheur.cc@>=
+  bool TOURHEURISTIC::twoOpt(int a)
+  {
+    for (int dir = 0; dir < 2; dir++) {
+      const int b   = dir == 0 ? next(a) : prev(a);
+      const int dAB = master_->dist(a, b);
+
+      for (int k = 0; k < nNeighbors_; k++) {
+        const int c   = neighbors_[a*nNeighbors_ + k];
+        const int dAC = master_->dist(a, c);
+
+        if (dAC >= dAB) break;
+
+        const int d = dir == 0 ? next(c) : prev(c);
+
+        if (d == a) continue;
+
+        if (dAB + master_->dist(c, d) - dAC - master_->dist(b, d) > 0) {
+          if (dir == 0) reverse(b, c);
+          else          reverse(a, d);
+          push(a);
+          push(b);
+          push(c);
+          push(d);
+          return true;
+        }
+      }
+    }
+
+    return false;
+  }
+
+@ The function |orOpt()| searches an Or-opt move, which moves a segment
+  of at most 3 consecutive nodes of the tour starting or ending at |a|
+  to another position of the tour.
+
+  \BeginReturn
+  |true| if an improving move has been performed, |false| otherwise.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|a|}{The node.}
+  \EndArg
+
+@(tourheur.cc@>=
+  bool TOURHEURISTIC::orOpt(int a)
+  {
+    for (int length = 1; length <= 3; length++) {
+      int s2 = a;  // the last node of the segment starting at |a|
+
+      for (int i = 1; i < length; i++)
+        s2 = next(s2);
+      if (moveSegment(a, s2, length)) return true;
+
+      if (length > 1) {
+        int s1 = a;  // the first node of the segment ending at |a|
+
+        for (int j = 1; j < length; j++)
+          s1 = prev(s1);
+        if (moveSegment(s1, a, length)) return true;
+      }
+    }
+
+    return false;
+  }
+
+@ The function |moveSegment()| tries to move the segment from |s1| to
+  |s2| between the nodes |c| and |e| adjacent in the tour, such that
+  one end node |s| of the segment becomes adjacent to |c| and the other
+  one |o| to |e|. The segment is removed from the tour by replacing its
+  incident edges with the edge $(p,q)$ between its predecessor and its
+  successor. The edge $(s,c)$ must be shorter than the gain of the
+  removal if the move is improving, such that the scan of the neighbor
+  list of |s| can be stopped like in the function |twoOpt()|.
+
+  \BeginReturn
+  |true| if an improving move has been performed, |false| otherwise.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|s1|}{The first node of the segment.}
+  \docarg{|s2|}{The last node of the segment.}
+  \docarg{|length|}{The number of nodes of the segment.}
+  \EndArg
+
+@(tourheur.cc@>=
+  bool TOURHEURISTIC::moveSegment(int s1, int s2, int length)
+  {
+    const int p = prev(s1);
+    const int q = next(s2);
+    const int removeGain = master_->dist(p, s1) + master_->dist(s2, q)
+                           - master_->dist(p, q);
+
+    if (removeGain <= 0) return false;
+
+    for (int end = 0; end < 2; end++) {
+      const int s = end == 0 ? s1 : s2;  // the end node adjacent to |c|
+      const int o = end == 0 ? s2 : s1;  // the end node adjacent to |e|
+
+      for (int k = 0; k < nNeighbors_; k++) {
+        const int c   = neighbors_[s*nNeighbors_ + k];
+        const int dSC = master_->dist(s, c);
+
+        if (dSC >= removeGain) break;
+        if (inSegment(c, s1, length)) continue;
+
+        for (int side = 0; side < 2; side++) {
+          const int e = side == 0 ? next(c) : prev(c);
+
+          if (inSegment(e, s1, length)) continue;
+
+          if (removeGain - dSC - master_->dist(o, e) + master_->dist(c, e) > 0) {
+            @<move the segment between |c| and |e|@>;
+            return true;
+          }
+        }
+      }
+    }
+
+    return false;
+  }
+
+@ Let |x| be the one of |c| and |e| preceding the other one, denoted
+  by |y|, in the tour. The tour $p,s_1,\dots,s_2,q,\dots,x,y,\dots$ is
+  transformed by reversing the path from |s1| to |x| into
+  $p,x,\dots,q,s_2,\dots,s_1,y,\dots$, and then by reversing the path
+  from |x| to |q| into $p,q,\dots,x,s_2,\dots,s_1,y,\dots$. Finally, the
+  segment is reversed if |s1| has to become adjacent to |x|. The function
+  |reverse()| might reverse the other part of the tour instead of the
+  given path, which changes the direction of the tour. Therefore, the
+  direction is checked before the second and the third reversal.
+
+@<move the segment between |c| and |e|@>=
+  const int x = side == 0 ? c : e;  // the first node of the edge $(c,e)$
+  const int y = side == 0 ? e : c;  // the second node of the edge $(c,e)$
+
+  reverse(s1, x);
+
+  if (next(p) == x) reverse(x, q);
+  else              reverse(q, x);
+
+  if ((side == 0 ? s : o) != s2) {
+    int v = s2;
+
+    for (int i = 1; i < length; i++)
+      v = next(v);
+
+    if (v == s1) reverse(s2, s1);
+    else         reverse(s1, s2);
+  }
+
+  push(p);
+  push(q);
+  push(s1);
+  push(s2);
+  push(x);
+  push(y);
+
+@ The function |inSegment()|.
+  \BeginReturn
+  |true| if |v| belongs to the segment of |length| nodes starting at |s1|,
+  |false| otherwise.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|v|}{The node.}
+  \docarg{|s1|}{The first node of the segment.}
+  \docarg{|length|}{The number of nodes of the segment.}
+  \EndArg
+
+@(tourheur.cc@>=
+  bool TOURHEURISTIC::inSegment(int v, int s1, int length)
+  {
+    int u = s1;
+
+    for (int i = 0; i < length; i++) {
+      if (u == v) return true;
+      u = next(u);
+    }
+
+    return false;
+  }
+
+@ The function |next()|.
+  \BeginReturn
+  The successor of |v| in the tour.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|v|}{The node.}
+  \EndArg
+
+@(tourheur.cc@>=
+  int TOURHEURISTIC::next(int v)
+  {
+    const int i = pos_[v] + 1;
+
+    return tour_[i == nNodes_ ? 0 : i];
+  }
+
+@ The function |prev()|.
+  \BeginReturn
+  The predecessor of |v| in the tour.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|v|}{The node.}
+  \EndArg
+
+@(tourheur.cc@>=
+  int TOURHEURISTIC::prev(int v)
+  {
+    const int i = pos_[v];
+
+    return tour_[i == 0 ? nNodes_ - 1 : i - 1];
+  }
+
+@ The function |reverse()| reverses the path of the tour from |from| to
+  |to|. If this path contains more than half of the nodes, the other
+  part of the tour is reversed, which gives the same tour in the opposite
+  direction.
+
+  \BeginArg
+  \docarg{|from|}{The first node of the path.}
+  \docarg{|to|}{The last node of the path.}
+  \EndArg
+
+@(tourheur.cc@>=
+  void TOURHEURISTIC::reverse(int from, int to)
+  {
+    int i = pos_[from];  // the position of the first node being swapped
+    int j = pos_[to];  // the position of the second node being swapped
+    int n = j - i + 1;  // the number of nodes of the path
+
+    if (n <= 0) n += nNodes_;
+
+    if (2*n > nNodes_) {
+      const int help = i;
+
+      i = j + 1 == nNodes_ ? 0 : j + 1;
+      j = help == 0 ? nNodes_ - 1 : help - 1;
+      n = nNodes_ - n;
+    }
+
+    for (int s = 0; s < n/2; s++) {
+      const int u = tour_[i];
+      const int w = tour_[j];
+
+      tour_[i] = w;
+      pos_[w]  = i;
+      tour_[j] = u;
+      pos_[u]  = j;
+
+      if (++i == nNodes_) i = 0;
+      if (--j < 0) j = nNodes_ - 1;
+    }
+  }
+
+@ The function |push()| adds a node to the queue if it is not already
+  contained in it.
+  \BeginArg
+  \docarg{|v|}{The node.}
+  \EndArg
+
+@(tourheur.cc@>=
+  void TOURHEURISTIC::push(int v)
+  {
+    if (inQueue_[v]) return;
+
+    queue_[(first_ + nQueue_) % nNodes_] = v;
+    ++nQueue_;
+    inQueue_[v] = true;
+  }
+
+@ The function |pop()| removes the first node from the queue.
+  \BeginReturn
+  The removed node.
+  \EndReturn
+
+@(tourheur.cc@>=
+  int TOURHEURISTIC::pop()
+  {
+    const int v = queue_[first_];
+
+    if (++first_ == nNodes_) first_ = 0;
+    --nQueue_;
+    inQueue_[v] = false;
+
+    return v;
+  }
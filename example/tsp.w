@@ -187,6 +187,13 @@ $x(\delta(v)) = 2$ for each node $v\in W$ of a subtour elimination constraint
 and dividing the inequality by $-2$ we obtain the equivalent format
 $x(E(W)) \le |W| - 1$. 
 
+The complete graph has $n(n-1)/2$ edges, but only few of them are
+required for the linear programming relaxations. Therefore, the
+variables of the edges between each node and its nearest neighbors
+are generated first, and the other edges are added only if their
+reduced costs are negative (pricing). Both the cutting plane and the
+column generation facilities of \ABACUS\ are applied in this way.
+
 @ The basic idea of \ABACUS\ for the development of a new application
 is the derivation of problem specific classes from a small amount of
 base classes. For every application a problem specific master and
@@ -199,9 +206,14 @@ Problem specific structure of constraints and variables can be exploited
 by deriving classes from the base classes |ABA_CONSTRAINT| and |ABA_VARIABLE|.
 A variable in our implementation is in one-to-one correspondence with
 the edge of a graph. Therefore, we represent this variable by the
-class |EDGE|. The degree constraints and the subtour elimination constraints
-are implemented in the classes |DEGREE| and |SUBTOUR|, respectively,
+class |EDGE|. The degree constraints, the subtour elimination constraints,
+and the comb inequalities
+are implemented in the classes |DEGREE|, |SUBTOUR|, and |COMB|, respectively,
 which are derived from the abstract base class |ABA_CONSTRAINT|.
+The separation problem of the subtour elimination constraints is solved
+by the class |SUBTOURSEPARATOR|, violated comb inequalities are generated
+heuristically by the class |COMBSEPARATOR|, and the primal heuristic is
+implemented in the class |TOURHEURISTIC|. These classes are not derived from classes of \ABACUS.
 The inheritance tree of these classes is presented in Figure~1. The
 problem specific classes are surrouned by a bold frame.
 
@@ -229,6 +241,18 @@ starting the optimization.
 @i subtour.wh  
 @i subtour.w
 
+@i comb.wh
+@i comb.w
+
+@i subtoursep.wh
+@i subtoursep.w
+
+@i combsep.wh
+@i combsep.w
+
+@i tourheur.wh
+@i tourheur.w
+
 @i tspmaster.wh
 @i tspmaster.w
 
@@ -242,6 +266,10 @@ starting the optimization.
 \def\reference#1{\par\hangindent46pt\noindent\ignorespaces
   \hbox to 46pt{[#1]\hfil}\ignorespaces}
 
+\reference{GH91} M.\ Gr\"otschel and O.\ Holland (1991),
+  Solution of large-scale symmetric travelling salesman problems,
+  {\sl Mathematical Programming\/} {\bf 51}, 141--202.
+
 \reference{JRT94} M.\ J\"unger, G.\ Reinelt, and S.\ Thienel (1994),
    Provably good solutions for the traveling salesman problem,
    {\sl Zeitschrift f\"ur Operations Research\/} {\bf 40}, 183--217.
@@ -259,6 +287,10 @@ starting the optimization.
                  technical report and software package,
                  {\tt ftp://labrea.stanford.edu:/pub/cweb}.
  
+\reference{PH80} M.W.\ Padberg and S.\ Hong (1980),
+  On the symmetric travelling salesman problem: a computational study,
+  {\sl Mathematical Programming Study\/} {\bf 12}, 78--107.
+
 \reference{PR90} M.W.\ Padberg and G.\ Rinaldi (1990),
           Facet identification for the symmetric traveling salesman polytope,
          {\sl Mathematical Programming\/}
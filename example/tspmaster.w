@@ -7,6 +7,14 @@
 #include "tspsub.h"
 #include "edge.h"
 #include "degree.h"
+#include "subtour.h"
+#include "comb.h"
+#include "subtoursep.h"
+#include "combsep.h"
+#include "tourheur.h"
+#include "abacus/hash.h"
+#include "abacus/lpsolution.h"
+#include "abacus/message.h"
 #include <VolVolume.hpp>
 #include <OsiVolSolverInterface.hpp>
 #ifdef ABACUS_CPLEX
@@ -23,6 +31,14 @@
 extern "C" {
 #include <stdio.h>
 #include <string.h>
+#include <ctype.h>
+#ifndef ABACUS_VISUAL_CPP
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 }
 
 #ifdef ABACUS_MATH_CPP
@@ -50,8 +66,12 @@ extern "C" {
   The constructor calls first the constructor of its base class
   |ABA_MASTER|. The second argument of the constructor of |ABA_MASTER| is |true|
   because we are using cutting plane generation for the solution of the
-  subproblems. Since no variables are generated dynamically the third
-  argument of the base class constructor is |false|. To indicate that
+  subproblems. Also the third
+  argument of the base class constructor is |true|, because the edges
+  which are not contained in the candidate graph are generated
+  dynamically in the pricing steps (see |TSPSUB::pricing()|). If the
+  complete graph is generated initially, the pricing is switched off again
+  in |initializeParameters()|. To indicate that
   the traveling salesman problem
   is a minimization problem we set the sense of the optimization
   to |ABA_OPTSENSE::Min|. If in another application the sense of the  
@@ -65,12 +85,15 @@ extern "C" {
 
 @(tspmaster.cc@>=
   TSPMASTER::TSPMASTER(const char *problemName) : @/
-    ABA_MASTER(problemName, true, false, ABA_OPTSENSE::Min), @/
+    ABA_MASTER(problemName, true, true, ABA_OPTSENSE::Min), @/
     nNodes_(0), @/
     xCoor_(0), @/
     yCoor_(0), @/
     nSubTours_(0), @/
+    nBlossoms_(0), @/
+    nCombs_(0), @/
     bestSucc_(0), @/
+    bestLength_(0.0), @/
     showBestTour_(false), @/
     clpPrimalColumnPivotAlgorithm_(this, ""), @/
     clpDualRowPivotAlgorithm_(this, ""), @/
@@ -97,7 +120,19 @@ extern "C" {
     vol_minimumRelAscent_(.0001), @/
     tailOffPercentExact_(.0001), @/
     tailOffPercentVol_(.0001), @/
-    tailOffNLpsVol_(-1) @/
+    tailOffNLpsVol_(-1), @/
+    cutPoolSize_(5), @/
+    candidateNeighbors_(0), @/
+    distanceCache_(2000), @/
+    dist_(0), @/
+    distStart_(0), @/
+    subtourSeparator_(0), @/
+    localSearchNeighbors_(10), @/
+    tourHeuristic_(0), @/
+    combSeparator_(0), @/
+    combPool_(0), @/
+    maxBlossoms_(20), @/
+    maxCombs_(20) @/
   {
     @<read the input data@>;
     @<allocate further memory for class |TSPMASTER|@>;
@@ -145,8 +180,20 @@ extern "C" {
     exit (Fatal);
   }
   
-@ @<allocate further memory for class |TSPMASTER|@>=
+@ The separators of the subtour elimination constraints and of the comb
+  inequalities are shared by all
+  subproblems, such that their memory is allocated only once.
+  They are registered by their names in the statistics of the separators,
+  which decide if a separator is skipped below the root if the parameter
+  {\tt AdaptiveCutting} is positive (see |TSPSUB::separate()|).
+
+@<allocate further memory for class |TSPMASTER|@>=
   bestSucc_ = new int[nNodes_];
+  pthread_mutex_init(&bestTourMutex_, 0);
+  subtourSeparator_ = new SUBTOURSEPARATOR(this);
+  combSeparator_ = new COMBSEPARATOR(this);
+  registerSeparator(SubtourSeparator, "Subtour");
+  registerSeparator(CombSeparator, "Comb");
 
 @ @<clean up |TSPMASTER::TSPMASTER()|@>=
   delete [] fileName;
@@ -159,6 +206,13 @@ extern "C" {
     delete [] xCoor_;
     delete [] yCoor_;
     delete [] bestSucc_;
+    delete [] dist_;
+    delete [] distStart_;
+    delete subtourSeparator_;
+    delete tourHeuristic_;
+    delete combSeparator_;
+    delete combPool_;
+    pthread_mutex_destroy(&bestTourMutex_);
   }
 
 @ The function |readTsplibFile()| reads a problem instance in TSPLIB-format
@@ -166,6 +220,11 @@ extern "C" {
   storing the coordinates of the nodes are allocated in the function.
   Also the number of nodes |nNodes_| is initialized.
 
+  The file is mapped into memory and parsed in a single pass, such
+  that the start of the optimization of large problem instances is not
+  dominated by reading the input file. The pointer |p| marks the current
+  position in the file, and |end| the end of the file.
+
   \BeginArg
   \docarg{|fileName|}{The name of the input file.}
   \EndArg
@@ -173,13 +232,17 @@ extern "C" {
 @(tspmaster.cc@>=
   void TSPMASTER::readTsplibFile(const char *fileName)
   {
-    @<open the input file@>;
+    @<map the input file into memory@>;
     @<read the problem@>;
-    @<close the TSPLIB file@>;
+    @<unmap the input file@>;
   }
 
-@ @<open the input file@>=
-  FILE *tspFile = fopen(fileName, "r");
+@ With the Visual \CPLUSPLUS/ compiler the function |mmap()| is not
+  available. Therefore, we read the complete file into a buffer instead.
+
+@<map the input file into memory@>=
+#ifdef ABACUS_VISUAL_CPP
+  FILE *tspFile = fopen(fileName, "rb");
 
   if (tspFile == NULL) {  // {\tt NULL} is written |NULL| in CWEB
     err() << "TSPMASTER::TSPMASTER(): ";
@@ -187,6 +250,47 @@ extern "C" {
     exit(Fatal);
   }
 
+  fseek(tspFile, 0, SEEK_END);
+  const long fileSize = ftell(tspFile);
+  fseek(tspFile, 0, SEEK_SET);
+
+  char *fileBuf = new char[fileSize + 1];
+
+  if (fread(fileBuf, 1, fileSize, tspFile) != (size_t) fileSize) {
+    err() << "TSPMASTER::TSPMASTER(): error in reading file " << fileName << "." << endl;
+    exit(Fatal);
+  }
+  fclose(tspFile);
+#else
+  int tspFile = open(fileName, O_RDONLY);
+
+  if (tspFile == -1) {
+    err() << "TSPMASTER::TSPMASTER(): ";
+    err() << "TSPLIB file " << fileName << " could not be opened." << endl;
+    exit(Fatal);
+  }
+
+  struct stat fileStat;
+
+  if (fstat(tspFile, &fileStat) || fileStat.st_size == 0) {
+    err() << "TSPMASTER::TSPMASTER(): TSPLIB file " << fileName;
+    err() << " is empty or cannot be accessed." << endl;
+    exit(Fatal);
+  }
+
+  const size_t fileSize = fileStat.st_size;
+  char *fileBuf = (char *) mmap(0, fileSize, PROT_READ, MAP_PRIVATE, tspFile, 0);
+
+  if (fileBuf == (char *) MAP_FAILED) {
+    err() << "TSPMASTER::TSPMASTER(): TSPLIB file " << fileName;
+    err() << " could not be mapped into memory." << endl;
+    exit(Fatal);
+  }
+#endif
+
+  const char *p   = fileBuf;
+  const char *end = fileBuf + fileSize;
+
 @ @<read the problem@>=
   @<check the problem type and read the dimension@>;
   @<have all required keywords been found in the file?@>;
@@ -195,45 +299,50 @@ extern "C" {
 @ The TSPLIB provides several input formats. For simplification in this
   example we only can read problems having edge weight type |"EUC_2D"|.
   In order to determine the number of nodes of the problem we look for
-  a line starting with the string |"DIMENSION :"|. The edge weight type
+  a line starting with the string |"DIMENSION"|, which is followed by a
+  colon and the number of nodes. The edge weight type
   of the problem instance is correct if we find a line of the
-  form |"EDGE_WEIGHT_TYPE : EUC_2D"| or |"EDGE_WEIGHT_TYPE: EUC_2D"|.
+  form |"EDGE_WEIGHT_TYPE : EUC_2D"|, where any number of blanks may
+  surround the colon.
 
   As soon as we reach a line starting with the string 
   |"NODE_COORD_SECTION"| we can continue with stop analyzing the
   specification part of the TSPLIB-file.
 
 @<check the problem type and read the dimension@>=
-  const int maxCharPerLine = 1024;
-  char lineBuf[maxCharPerLine + 1];
   bool dimensionFound    = false;
   bool typeFound         = false;
   bool coordSectionFound = false;
+  const char *eol;    // the end of the current line
+  const char *value;  // the value of the keyword of the current line
+  double dimension;
   
-  while (fgets(lineBuf, maxCharPerLine, tspFile)) {
-    if (strncmp(lineBuf, "DIMENSION", strlen("DIMENSION")) == 0) {
-      if (sscanf(lineBuf, "DIMENSION : %d", &nNodes_) != 1) {
+  while (p < end) {
+    eol = (const char *) memchr(p, '\n', end - p);
+    if (eol == 0) eol = end;
+
+    if (keyword(p, eol, "DIMENSION", value)) {
+      if (readNumber(value, eol, dimension) == 0 || dimension < 1) {
         err() << "Error when reading dimension of problem." << endl;
         exit(Fatal);
       }
+      nNodes_ = (int) dimension;
       dimensionFound = true;
     }
-    else if (strncmp(lineBuf, "EDGE_WEIGHT_TYPE", strlen("EDGE_WEIGHT_TYPE")) 
-             == 0) {
-      if (strncmp(lineBuf, "EDGE_WEIGHT_TYPE : EUC_2D", 
-                  strlen("EDGE_WEIGHT_TYPE : EUC_2D")) && @/
-          strncmp(lineBuf, "EDGE_WEIGHT_TYPE: EUC_2D", 
-                  strlen("EDGE_WEIGHT_TYPE: EUC_2D"))) {
+    else if (keyword(p, eol, "EDGE_WEIGHT_TYPE", value)) {
+      while (value < eol && isspace(*value)) ++value;
+      if (eol - value < 6 || strncmp(value, "EUC_2D", 6)) {
         err() << "Invalid EDGE_WEIGHT_TYPE, must be EUC_2D." << endl;
         exit(Fatal);
       }
       typeFound = true;
     }
-    else if (strncmp(lineBuf, "NODE_COORD_SECTION", strlen("NODE_COORD_SECTION"))
-             == 0) {
+    else if (end - p >= 18 && strncmp(p, "NODE_COORD_SECTION", 18) == 0) {
       coordSectionFound = true;
+      p = eol;
       break;
     }
+    p = eol + 1;
   }
 
 @ Before reading the coordinates of the nodes we check if all required
@@ -266,20 +375,97 @@ extern "C" {
   xCoor_ = new double[nNodes_];
   yCoor_ = new double[nNodes_];
   
-  int nodeNumber;
+  double nodeNumber = 0;
 
   for (int i = 0; i < nNodes_; i++)
-    if (fscanf(tspFile, "%d %lf %lf", &nodeNumber, xCoor_ + i, yCoor_ + i)
-        != 3) {
-      err() << "Error while reading coordinates of node " << nodeNumber << "." << endl;
+    if ((p = readNumber(p, end, nodeNumber)) == 0 ||
+        (p = readNumber(p, end, xCoor_[i])) == 0 ||
+        (p = readNumber(p, end, yCoor_[i])) == 0) {
+      err() << "Error while reading coordinates of node " << i + 1 << "." << endl;
       exit(Fatal);
     }
 
-@ @<close the TSPLIB file@>=
-  if (fclose(tspFile)) {
+@ @<unmap the input file@>=
+#ifdef ABACUS_VISUAL_CPP
+  delete [] fileBuf;
+#else
+  if (munmap(fileBuf, fileSize) || close(tspFile)) {
     err() << "TSPMASTER::TSPMASTER(): error in closing file " << fileName << "." << endl;
     exit(Fatal);
   }
+#endif
+
+@ The function |keyword()| checks if a line of the specification part of
+  a TSPLIB-file starts with a keyword followed by a colon. Blanks between
+  the keyword and the colon are skipped.
+
+  \BeginReturn
+  |true| If the line starts with the keyword, |false| otherwise.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|line|}{The start of the line.}
+  \docarg{|eol|}{The end of the line.}
+  \docarg{|key|}{The keyword.}
+  \docarg{|value|}{Points after the colon if the return value is |true|.}
+  \EndArg
+
+@(tspmaster.cc@>=
+  bool TSPMASTER::keyword(const char *line, const char *eol, const char *key,
+                          const char *&value)
+  {
+    const int length = strlen(key);
+
+    if (eol - line < length || strncmp(line, key, length)) return false;
+
+    value = line + length;
+    while (value < eol && (*value == ' ' || *value == '\t')) ++value;
+
+    if (value == eol || *value != ':') return false;
+
+    ++value;
+    return true;
+  }
+
+@ The function |readNumber()| reads a number from the file. We cannot
+  apply |strtod()| to the file directly, because it is not terminated
+  by a null character. Therefore, the number is first copied to the
+  buffer |number|.
+
+  \BeginReturn
+  The position after the number, or 0 if no number could be read.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|p|}{The position in the file where white space and the number
+               start.}
+  \docarg{|end|}{The end of the file.}
+  \docarg{|x|}{Holds the number if the return value is not 0.}
+  \EndArg
+
+@(tspmaster.cc@>=
+  const char *TSPMASTER::readNumber(const char *p, const char *end, double &x)
+  {
+    const int maxLength = 63;
+    char number[maxLength + 1];
+    int length = 0;
+
+    while (p < end && isspace(*p)) ++p;
+
+    while (p < end && length < maxLength &&
+           (isdigit(*p) || *p == '+' || *p == '-' || *p == '.' ||
+            *p == 'e' || *p == 'E'))
+      number[length++] = *p++;
+
+    if (length == 0) return 0;
+    number[length] = '\0';
+
+    char *last;
+    x = strtod(number, &last);
+
+    if (last != number + length) return 0;
+    return p;
+  }
 
 
 @ The function |firstSub()| redefines a pure virtual function of the
@@ -299,6 +485,90 @@ extern "C" {
     return new TSPSUB(this);
   }
 
+@ The function |unpackSub()| redefines a virtual function of the base
+  class |ABA_MASTER|. It is required if the optimization is restarted
+  from a checkpoint (parameter {\tt CheckpointRestart} of the file
+  {\tt .abacus}), if subproblems are spilled to a file
+  ({\tt SpillMemory}), or if subproblems are sent to other processes
+  ({\tt Workers}).
+  \BeginReturn
+  A pointer to the subproblem unpacked from |msg|.
+  \EndReturn
+  \BeginArg
+  \docarg{|msg|}{The message from which the subproblem is unpacked.}
+  \EndArg
+
+@(tspmaster.cc@>=
+  ABA_SUB *TSPMASTER::unpackSub(ABA_MESSAGE &msg)
+  {
+    return new TSPSUB(this, msg);
+  }
+
+@ The function |unpackConVar()| redefines a virtual function of the base
+  class |ABA_MASTER| in order to unpack the problem specific constraints
+  and variables. Objects of other classes are unpacked by the function
+  of the base class.
+  \BeginReturn
+  A pointer to the constraint or variable unpacked from |msg|.
+  \EndReturn
+  \BeginArg
+  \docarg{|msg|}{The message from which the constraint or variable is
+                 unpacked.}
+  \docarg{|classId|}{The identification of its class.}
+  \EndArg
+
+@(tspmaster.cc@>=
+  ABA_CONVAR *TSPMASTER::unpackConVar(ABA_MESSAGE &msg, int classId)
+  {
+    switch (classId) {
+      case EDGE_CLASSID:    return new EDGE(this, msg);
+      case DEGREE_CLASSID:  return new DEGREE(this, msg);
+      case SUBTOUR_CLASSID: return new SUBTOUR(this, msg);
+      case COMB_CLASSID:    return new COMB(this, msg);
+    }
+    return ABA_MASTER::unpackConVar(msg, classId);
+  }
+
+@ The function |packCheckpoint()| redefines a virtual function of the
+  base class |ABA_MASTER| in order to store the best tour and the
+  counters of the generated constraints in a checkpoint. The primal bound
+  itself is stored by \ABACUS.
+  \BeginArg
+  \docarg{|msg|}{The message in which the data is packed.}
+  \EndArg
+
+@(tspmaster.cc@>=
+  void TSPMASTER::packCheckpoint(ABA_MESSAGE &msg) const
+  {
+    pthread_mutex_lock((pthread_mutex_t*) &bestTourMutex_);
+    msg.pack(bestSucc_, nNodes_);
+    msg.pack(bestLength_);
+    pthread_mutex_unlock((pthread_mutex_t*) &bestTourMutex_);
+
+    msg.pack(nSubTours_);
+    msg.pack(nBlossoms_);
+    msg.pack(nCombs_);
+  }
+
+@ The function |unpackCheckpoint()| restores the data packed by the
+  function |packCheckpoint()|. It is called after the function
+  |initializeOptimization()|, such that the best tour replaces the
+  initial tour.
+  \BeginArg
+  \docarg{|msg|}{The message from which the data is unpacked.}
+  \EndArg
+
+@(tspmaster.cc@>=
+  void TSPMASTER::unpackCheckpoint(ABA_MESSAGE &msg)
+  {
+    msg.unpack(bestSucc_, nNodes_);
+    msg.unpack(bestLength_);
+
+    msg.unpack(nSubTours_);
+    msg.unpack(nBlossoms_);
+    msg.unpack(nCombs_);
+  }
+
 @ The function |initializeOptimization()| defines a virtual dummy function 
   of the class |ABA_MASTER|. Its main purpose is the initialization of the
   constraint and variable pools. The initialization of these pools must
@@ -312,10 +582,11 @@ extern "C" {
   void TSPMASTER::initializeOptimization()
   {
     @<output a banner@>;
+    @<store the distances@>;
+    @<compute a nearest neighbor tour@>;
     @<generate the variables@>;
     @<generate the degree constraints@>;
     @<initialize the pools@>;
-    @<compute a nearest neighbor tour@>;
   }
 
 @ @<output a banner@>=
@@ -327,21 +598,107 @@ extern "C" {
   out() << "traveling salesman problems." << endl << endl;
   
 
+@ The distances of all pairs of nodes are required for the nearest
+  neighbor tour, for the candidate graph, and in each pricing step.
+  Instead of computing them again and again, we store them in the array
+  |dist_| if the problem instance has at most |distanceCache_| nodes. 
+  This is the parameter {\tt DistanceCache} of the file {\tt .tsp}.
+  Since the distances are symmetric, only the distances of the
+  pairs $t < h$ are stored.
+
+@<store the distances@>=
+  if (nNodes_ <= distanceCache_) {
+    distStart_ = new int[nNodes_];
+    dist_      = new int[(nNodes_*(nNodes_ - 1))/2 + 1];
+
+    int nStored = 0;  // the number of stored distances
+
+    for (int t = 0; t < nNodes_; t++) {
+      distStart_[t] = nStored - t - 1;
+      computeDistances(t, t + 1, dist_ + nStored);
+      nStored += nNodes_ - t - 1;
+    }
+  }
+
 @ Each variable in this traveling salesman problem solver is associated 
   with an edge of the
   undirected graph. We create these variables using the class |EDGE|
   that is derived from the class |ABA_VARIABLE|. The objective function
   coefficient of each variable is computed by the function |dist(t,h)|
-  giving the distance of node |t| and |h|.
+  giving the distance of node |t| and |h|. The tail of an edge is always
+  its end node with the smaller number.
+
+  For large problem instances the complete graph has far too many edges
+  for the linear programs. Therefore, we start with the candidate graph
+  containing the edges from each node to its |candidateNeighbors_|
+  nearest neighbors, and the edges of the nearest neighbor tour, such
+  that the first linear program is feasible. The other edges are
+  generated in the pricing steps if their reduced costs are negative
+  (see |TSPSUB::pricing()|). Only if the parameter {\tt CandidateNeighbors}
+  of the file {\tt .tsp} is 0, or if each node has at most
+  |candidateNeighbors_| neighbors anyway, all edges are generated here.
+  As the pricing steps exclude several features of the framework, e.g.,
+  the diving heuristics and the Workers, 0 is the default, and the pricing
+  is switched off for the complete graph (see |initializeParameters()|).
+  The size of the buffer |variables| is an upper bound on the number of
+  edges of the candidate graph.
 
 @<generate the variables@>=
-  int nEdges = (nNodes_*(nNodes_-1))/2;
+  const bool sparse = candidateNeighbors_ > 0 && candidateNeighbors_ < nNodes_ - 1;
+  int nEdges;
+
+  if (sparse) nEdges = nNodes_*(candidateNeighbors_ + 1);
+  else        nEdges = (nNodes_*(nNodes_-1))/2;
 
   ABA_BUFFER<ABA_VARIABLE *> variables(this, nEdges);
   
-  for (int t = 0; t < nNodes_ - 1; t++) 
-    for (int h = t + 1; h < nNodes_; h++) 
-      variables.push(new EDGE(this, t, h, dist(t,h)));
+  if (sparse) {
+    @<generate the edges of the candidate graph@>;
+  }
+  else {
+    for (int t = 0; t < nNodes_ - 1; t++) 
+      for (int h = t + 1; h < nNodes_; h++) 
+        variables.push(new EDGE(this, t, h, dist(t,h)));
+  }
+
+  out() << "Edges of the candidate graph: " << variables.number() << endl << endl;
+
+@ An edge might be both an edge to a nearest neighbor of each of its end
+  nodes and an edge of the tour. The hash table |candidates| stores the
+  head of each generated edge with its tail as key, such that it is
+  generated only once.
+
+@<generate the edges of the candidate graph@>=
+  ABA_HASH<int, int> candidates(this, nEdges);
+  ABA_ARRAY<int> nearest(this, candidateNeighbors_);  // the nearest neighbors of a node
+  ABA_ARRAY<int> distRow(this, nNodes_);  // the distances from a node
+  int u, w;  // the end nodes of an edge
+
+  for (int t = 0; t < nNodes_; t++) {
+    closestNodes(t, candidateNeighbors_, &nearest[0], distRow);
+    for (int j = 0; j < candidateNeighbors_; j++) {
+      u = t;
+      w = nearest[j];
+      @<generate the edge |(u,w)| of the candidate graph@>;
+    }
+  }
+
+  for (int v = 0; v < nNodes_; v++) {
+    u = v;
+    w = bestSucc_[v];
+    @<generate the edge |(u,w)| of the candidate graph@>;
+  }
+
+@ @<generate the edge |(u,w)| of the candidate graph@>=
+  if (u > w) {
+    int help = u;
+    u = w;
+    w = help;
+  }
+  if (!candidates.find(u, w)) {
+    candidates.insert(u, w);
+    variables.push(new EDGE(this, u, w, dist(u, w)));
+  }
 
 
 @ In any solution for the traveling salesman problem
@@ -365,17 +722,19 @@ extern "C" {
   of constraints contained in the buffer |degreeConstraints|.
 
   We initialize the variable pool with the edges of the graph stored
-  in the buffer |variables|. Since no variables are generated
-  dynamically we set its size to |nEdges|. If in another application
-  variables are generated dynamically then the size of the variable
-  pool needs not be initialized with the maximal possible number of
+  in the buffer |variables|. Its size is set to |nEdges|. Since the
+  edges outside of the candidate graph are generated dynamically, the
+  size of the variable pool needs not be initialized with the maximal
+  possible number of
   variables because the variable pool is reallocated automatically if
   necessary. Therefore, only an initial guess of its size should
   be used in this initialization.
 
   Finally, we specify the size of the cut pool, storing all
   cutting planes generated during the optimization, to 
-  |5*nNodes_|. This value is only an estimation according to our
+  |cutPoolSize_*nNodes_|, where |cutPoolSize_| is the parameter
+  {\tt CutPoolSize} of the file {\tt .tsp}. Its default value 5 is only
+  an estimation according to our
   experience with the traveling salesman problem. 
   Suitably estimations have to be determined
   for every particular optimization problem. Here, we omit
@@ -384,30 +743,48 @@ extern "C" {
   if it is full, but non-active constraints are removed instead.
 
 @<initialize the pools@>=
-  initializePools(degreeConstraints, variables, nEdges, 5*nNodes_);
+  initializePools(degreeConstraints, variables, nEdges, cutPoolSize_*nNodes_);
+
+@ The comb inequalities are stored in an extra pool of the same size.
+  Different runs of the separation heuristics can generate the same comb.
+  Since the pool is an |ABA_NONDUPLPOOL|, such a comb is stored only once
+  (see |COMB::equal()|). The pool is registered at the master, such that
+  the combs are packed together with the subproblems referring to them,
+  e.g., in a checkpoint.
+
+@<initialize the pools@>=
+  combPool_ = new ABA_NONDUPLPOOL<ABA_CONSTRAINT, ABA_VARIABLE>(this,
+                                                   cutPoolSize_*nNodes_);
+  registerConPool(combPool_);
 
 
 @ In order to show how the primal bound can be initialized we 
-  compute a nearest-neighbor tour. The primal bound is 
+  compute a nearest-neighbor tour, which is improved by the local search
+  of the class |TOURHEURISTIC|. The primal bound is 
   set with the function |primalBound()|. The computation of an initial
   primal bound is not required for the correctness of the optimization.
+  The object of the class |TOURHEURISTIC| is also used by the primal
+  heuristic of the subproblems (see |TSPSUB::improve()|).
 
   After setting the primal bound, we initialize the best tour storing
-  in the array |bestSucc_|.
+  in the array |bestSucc_|. Its edges are also edges of the candidate
+  graph.
 
 @<compute a nearest neighbor tour@>=
   ABA_ARRAY<int> succ(this, nNodes_);
 
-  int length = nearestNeighbor(succ);
+  tourHeuristic_ = new TOURHEURISTIC(this, localSearchNeighbors_);
+
+  nearestNeighbor(succ);
+  int length = tourHeuristic_->improve(succ);
+
+  out() << "Length of the initial tour: " << length << endl;
 
   primalBound(length);
 
-#ifdef ABACUS_NO_FOR_SCOPE
-  for (i = 0; i < nNodes_; i++)
-#else
-  for (int i = 0; i < nNodes_; i++)
-#endif
-    bestSucc_[i] = succ[i];
+  for (int s = 0; s < nNodes_; s++)
+    bestSucc_[s] = succ[s];
+  bestLength_ = length;
 
 @ The function |nearestNeighbor()| is a rather simple implementation
   for the determination of a nearest neighbor tour. We start at
@@ -484,15 +861,117 @@ extern "C" {
   \docarg{|h|}{The second end node of an edge.}
   \EndArg
 
+  If the distances are stored, they are looked up in the array |dist_|.
+
 @(tspmaster.cc@>=
   int TSPMASTER::dist(int t, int h)
   {
+    if (dist_) {
+      if (t < h)      return dist_[distStart_[t] + h];
+      else if (t > h) return dist_[distStart_[h] + t];
+      else            return 0;
+    }
+
     double xd = xCoor_[t] - xCoor_[h];
     double yd = yCoor_[t] - yCoor_[h];
 
     return (int) floor(sqrt(xd*xd + yd*yd) + 0.5);
   }
 
+@ The function |distances()| determines the distances from a node to
+  all nodes with larger numbers than a given one. It is used instead of
+  the function |dist()| if many distances from the same node are required.
+
+  \BeginArg
+  \docarg{|t|}{The node.}
+  \docarg{|first|}{The distances from |t| to the nodes |first|, \dots,
+                   |nNodes_ - 1| are determined.}
+  \docarg{|row|}{Holds the distance from |t| to the node |h| in
+                 |row[h]| for |h >= first| after the function call. Its
+                 size must be at least |nNodes_|.}
+  \EndArg
+
+@(tspmaster.cc@>=
+  void TSPMASTER::distances(int t, int first, ABA_ARRAY<int> &row)
+  {
+    if (dist_)
+      for (int h = first; h < nNodes_; h++)
+        row[h] = dist(t, h);
+    else if (first < nNodes_)
+      computeDistances(t, first, &row[first]);
+  }
+
+@ The function |closestNodes()| determines the nodes closest to a node.
+  They are stored in the array |nearest| in the
+  order of their distance from |t|. A node closer to |t| than the last
+  one of |nearest| is inserted at its position like in insertion sort.
+  The distances from |t| are computed at once in the array |distRow|.
+
+  \BeginArg
+  \docarg{|t|}{The node.}
+  \docarg{|k|}{The number of closest nodes, which must be less than
+               |nNodes_|.}
+  \docarg{|nearest|}{Holds the |k| closest nodes after the function call.}
+  \docarg{|distRow|}{An array of size at least |nNodes_| for the distances
+                     from |t|.}
+  \EndArg
+
+@(tspmaster.cc@>=
+  void TSPMASTER::closestNodes(int t, int k, int *nearest,
+                               ABA_ARRAY<int> &distRow)
+  {
+    int nNear = 0;  // the number of nodes in |nearest|
+
+    if (k == 0) return;
+
+    distances(t, 0, distRow);
+
+    for (int h = 0; h < nNodes_; h++) {
+      if (h == t) continue;
+      if (nNear == k) {
+        if (distRow[h] >= distRow[nearest[nNear - 1]]) continue;
+        --nNear;
+      }
+      int i = nNear++;
+      while (i > 0 && distRow[nearest[i - 1]] > distRow[h]) {
+        nearest[i] = nearest[i - 1];
+        --i;
+      }
+      nearest[i] = h;
+    }
+  }
+
+@ The function |computeDistances()| computes the distances from a node to
+  the nodes |first|, \dots, |nNodes_ - 1|. The loop has no dependencies
+  between its iterations and does not call other functions except
+  |sqrt()|, such that it can be vectorized by the compiler. Since the
+  distances are nonnegative, rounding by the conversion to |int| after
+  adding $0.5$ gives the same result as the function |floor()| in |dist()|.
+
+  \BeginArg
+  \docarg{|t|}{The node.}
+  \docarg{|first|}{The first node to which the distance is computed.}
+  \docarg{|row|}{Holds the distance from |t| to the node |h| in
+                 |row[h - first]| after the function call.}
+  \EndArg
+
+@(tspmaster.cc@>=
+  void TSPMASTER::computeDistances(int t, int first, int *row)
+  {
+    const double  xt = xCoor_[t];
+    const double  yt = yCoor_[t];
+    const double *x  = xCoor_ + first;
+    const double *y  = yCoor_ + first;
+    const int     n  = nNodes_ - first;
+
+    for (int i = 0; i < n; i++) {
+      double xd = xt - x[i];
+      double yd = yt - y[i];
+
+      row[i] = (int) (sqrt(xd*xd + yd*yd) + 0.5);
+    }
+  }
+
 @ The function |output()| redefines a virtual dummy function of the
   base class master to output statistics of the run and the best tour. 
   This function is called at the end of the optimization
@@ -509,6 +988,9 @@ extern "C" {
   out() << endl;
   out() << "Statistics on TSP-constraints" << endl << endl;
   out() << "  Subtour Elimination Constraints: " << nSubTours_ << endl;
+  out() << "  Blossom Inequalities           : " << nBlossoms_ << endl;
+  out() << "  Comb Inequalities              : " << nCombs_ << endl;
+  out() << "  Generated Edges                : " << varPool()->number() << endl;
 
   out() << endl;
 
@@ -540,21 +1022,55 @@ extern "C" {
     nSubTours_ += n;
   }
 
+@ The function |newCombs| increments the counters for the generated
+  blossom and comb inequalities.
+  \BeginArg
+  \docarg{|nBlossoms|}{The number of new generated blossom inequalities.}
+  \docarg{|nCombs|}{The number of new generated comb inequalities.}
+  \EndArg
+
+@(tspmaster.cc@>=
+  void TSPMASTER::newCombs(int nBlossoms, int nCombs)
+  {
+    nBlossoms_ += nBlossoms;
+    nCombs_    += nCombs;
+  }
+
 
 @ The function |updateBestTour()| replaces the tour stored in |bestSucc_|
-  by extracting it from an incidence vector.
+  by extracting it from its edges, if it is shorter than the stored tour.
+  The tour can be found by the heuristic threads (see |asyncImprove()|)
+  before the primal bound is updated, hence the length is compared with
+  |bestLength_| under the protection of |bestTourMutex_|.
+  \BeginReturn
+  |true| if the tour has been stored, |false| otherwise.
+  \EndReturn
   \BeginArg
-  \docarg{|xVal|}{An array storing an incidence vector of a tour.
-                  The length of this array must be the number of edges
-                  of the complete graph.}
+  \docarg{|tail|}{The tail of each edge of the tour.}
+  \docarg{|head|}{The head of each edge of the tour.}
+  \docarg{|length|}{The length of the tour.}
   \EndArg
+  Both arrays must have the length |nNodes_|. Since not all edges of the
+  complete graph are active, the tour cannot be passed as an incidence
+  vector of the active variables.
 
 @(tspmaster.cc@>=
-  void TSPMASTER::updateBestTour(double *xVal)
+  bool TSPMASTER::updateBestTour(ABA_ARRAY<int> &tail, ABA_ARRAY<int> &head,
+                                 double length)
   {
     @<local variables (|TSPMASTER::updateBestTour()|)@>;
     @<find the two neighbors of each node@>;
+
+    pthread_mutex_lock(&bestTourMutex_);
+    if (length >= bestLength_) {
+      pthread_mutex_unlock(&bestTourMutex_);
+      return false;
+    }
     @<assign the successor of each node@>;
+    bestLength_ = length;
+    pthread_mutex_unlock(&bestTourMutex_);
+
+    return true;
   }
       
 @ The arrays |neigh1| and |neigh2| store for each node the first and the
@@ -566,24 +1082,21 @@ extern "C" {
   ABA_ARRAY<int> neigh1(this, nNodes_, -1);
   ABA_ARRAY<int> neigh2(this, nNodes_, -1);
 
-  double oneMinusEps = 1.0 - machineEps();
-  int edge = 0;
+  int t, h;
 
 @ @<find the two neighbors of each node@>=
-  for (int t = 0; t < nNodes_ - 1; t++)
-    for (int h = t+1; h < nNodes_; h++) {
-      if (xVal[edge] > oneMinusEps) {
-        if (neigh1[t]  != -1) neigh2[t] = h;
-        else                  neigh1[t] = h;
-        if (neigh1[h] != -1)  neigh2[h] = t;
-        else                  neigh1[h] = t;
-      }
-      else if (xVal[edge] > machineEps()) {
-        err() << "TSPMASTER::update(): x is not incidence vector of a tour" << endl;
-        exit (Fatal);
-      }
-      edge++;
+  for (int e = 0; e < nNodes_; e++) {
+    t = tail[e];
+    h = head[e];
+    if (neigh2[t] != -1 || neigh2[h] != -1) {
+      err() << "TSPMASTER::updateBestTour(): edges do not form a tour" << endl;
+      exit (Fatal);
     }
+    if (neigh1[t]  != -1) neigh2[t] = h;
+    else                  neigh1[t] = h;
+    if (neigh1[h] != -1)  neigh2[h] = t;
+    else                  neigh1[h] = t;
+  }
 
 @ @<assign the successor of each node@>=
   int v, w;
@@ -760,6 +1273,115 @@ extern "C" {
     return nNodes_;
   }
 
+@ The function |asyncImprove()| redefines a virtual function of the base
+  class |ABA_MASTER|. It is called by the heuristic threads if the
+  parameter {\tt HeuristicThreads} is positive, and constructs a tour
+  from a copy of an LP-solution like |TSPSUB::improve()|. As the object
+  |tourHeuristic_| is used by the optimization at the same time, each call
+  works on its own copy of it, which shares only the neighbor lists. The
+  better tour is stored by |updateBestTour()|, the primal bound is
+  updated by \ABACUS. The cpu time of the heuristic threads is not
+  measured by the timers of the optimization.
+
+  \BeginReturn
+  1 if a better tour has been found, 0 otherwise.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|lpSolution|}{The LP-solution and the active variables.}
+  \docarg{|primalValue|}{Holds the length of the tour if a better tour
+                         has been found.}
+  \EndArg
+
+@(tspmaster.cc@>=
+  int TSPMASTER::asyncImprove(ABA_LPSOLUTION<ABA_VARIABLE, ABA_CONSTRAINT> *lpSolution,
+                              double &primalValue)
+  {
+    TOURHEURISTIC heuristic(*tourHeuristic_);
+    ABA_ARRAY<int> succ(this, nNodes_);  // the successor of each node in the tour
+
+    primalValue = heuristic.lpTour(lpSolution->nVarCon(), lpSolution->zVal(),
+                                   lpSolution->active(), succ);
+
+    ABA_ARRAY<int> tourTail(this, nNodes_);
+    ABA_ARRAY<int> tourHead(this, nNodes_);
+
+    for (int v = 0; v < nNodes_; v++) {
+      tourTail[v] = v;
+      tourHead[v] = succ[v];
+    }
+
+    return updateBestTour(tourTail, tourHead, primalValue) ? 1 : 0;
+  }
+
+@ The function |tourHeuristic()|.
+  \BeginReturn
+  A pointer to the primal heuristic.
+  \EndReturn
+
+@(tspmaster.cc@>=
+  TOURHEURISTIC *TSPMASTER::tourHeuristic()
+  {
+    return tourHeuristic_;
+  }
+
+@ The function |subtourSeparator()|.
+  \BeginReturn
+  A pointer to the separator of the subtour elimination constraints.
+  \EndReturn
+
+@(tspmaster.cc@>=
+  SUBTOURSEPARATOR *TSPMASTER::subtourSeparator()
+  {
+    return subtourSeparator_;
+  }
+
+@ The function |combSeparator()|.
+  \BeginReturn
+  A pointer to the separator of the comb inequalities.
+  \EndReturn
+
+@(tspmaster.cc@>=
+  COMBSEPARATOR *TSPMASTER::combSeparator()
+  {
+    return combSeparator_;
+  }
+
+@ The function |combPool()|.
+  \BeginReturn
+  A pointer to the pool of the comb inequalities.
+  \EndReturn
+
+@(tspmaster.cc@>=
+  ABA_NONDUPLPOOL<ABA_CONSTRAINT, ABA_VARIABLE> *TSPMASTER::combPool()
+  {
+    return combPool_;
+  }
+
+@ The function |maxBlossoms()|.
+  \BeginReturn
+  The maximal number of blossom inequalities generated in a round of the
+  separation.
+  \EndReturn
+
+@(tspmaster.cc@>=
+  int TSPMASTER::maxBlossoms() const
+  {
+    return maxBlossoms_;
+  }
+
+@ The function |maxCombs()|.
+  \BeginReturn
+  The maximal number of comb inequalities generated in a round of the
+  separation.
+  \EndReturn
+
+@(tspmaster.cc@>=
+  int TSPMASTER::maxCombs() const
+  {
+    return maxCombs_;
+  }
+
 @ The function |tailOffNLpVol()|.
   \BeginReturn
   The number of LPs considered when checking for tailoff,
@@ -818,6 +1440,12 @@ extern "C" {
   parameter table. From this table parameters can be read with the
   function |getParameter()| that is overloaded for most basic data types.
 
+  The parameter {\tt CandidateNeighbors} also decides if edges are
+  generated in the pricing steps, which is switched off with the function
+  |pricing()| if the complete graph is generated initially. This must be
+  done here, since the framework checks its parameters depending on the
+  pricing before |initializeOptimization()| is called.
+
 @(tspmaster.cc@>=    
   void TSPMASTER::initializeParameters()
   {
@@ -833,6 +1461,44 @@ extern "C" {
     getParameter("TailOffNLpsVol", tailOffNLpsVol_);
     getParameter("TailOffPercentVol", tailOffPercentVol_);
 
+    getParameter("CutPoolSize", cutPoolSize_);
+    if (cutPoolSize_ < 1) {
+      err() << "Parameter CutPoolSize in configuration file .tsp must be positive." << endl;
+      exit(Fatal);
+    }
+
+    getParameter("CandidateNeighbors", candidateNeighbors_);
+    if (candidateNeighbors_ < 0) {
+      err() << "Parameter CandidateNeighbors in configuration file .tsp must be nonnegative." << endl;
+      exit(Fatal);
+    }
+    pricing(candidateNeighbors_ > 0 && candidateNeighbors_ < nNodes_ - 1);
+
+    getParameter("LocalSearchNeighbors", localSearchNeighbors_);
+    if (localSearchNeighbors_ < 0) {
+      err() << "Parameter LocalSearchNeighbors in configuration file .tsp must be nonnegative." << endl;
+      exit(Fatal);
+    }
+
+    getParameter("MaxBlossoms", maxBlossoms_);
+    if (maxBlossoms_ < 0) {
+      err() << "Parameter MaxBlossoms in configuration file .tsp must be nonnegative." << endl;
+      exit(Fatal);
+    }
+
+    getParameter("MaxCombs", maxCombs_);
+    if (maxCombs_ < 0) {
+      err() << "Parameter MaxCombs in configuration file .tsp must be nonnegative." << endl;
+      exit(Fatal);
+    }
+
+    getParameter("DistanceCache", distanceCache_);
+    if (distanceCache_ < 0 || distanceCache_ > 46340) {
+      err() << "Parameter DistanceCache in configuration file .tsp must be ";
+      err() << "between 0 and 46340." << endl;
+      exit(Fatal);
+    }
+
     getParameter("SolverOutputLevel", solverOutputLevel_);
 
     getParameter("CplexPrimalPricing", cplexPrimalPricing_);
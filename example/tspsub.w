@@ -8,11 +8,15 @@
 #include "abacus/fastset.h"
 #include "edge.h"
 #include "subtour.h"
+#include "comb.h"
+#include "degree.h"
+#include "subtoursep.h"
+#include "combsep.h"
+#include "tourheur.h"
 #include "abacus/lpsub.h"
-
-extern "C" {
-#include "PadbergRinaldi.h"
-}
+#include "abacus/bheap.h"
+#include "abacus/infeascon.h"
+#include "abacus/standardpool.h"
 
 @ The constructor for the root node of the enumeration tree.
      \BeginArg
@@ -39,7 +43,24 @@ extern "C" {
                  ABA_SUB *father, 
                  ABA_BRANCHRULE *branchRule) : @/
     ABA_SUB(master, father, branchRule), @/
-    tailOffForVol_(false)@/
+    tailOffForVol_(false) @/
+  { }
+
+@ The message constructor restores an open subproblem, e.g., from a
+  checkpoint (see |TSPMASTER::unpackSub()|). A |TSPSUB| has no data
+  which has to be packed in addition to the data of |ABA_SUB|. The
+  tailing off control of a restored subproblem is initialized for the
+  exact solver like in the other constructors.
+  \BeginArg
+  \docarg{|master|}{A pointer to the corresponding master of the
+                    optimization.}
+  \docarg{|msg|}{The message from which the subproblem is unpacked.}
+  \EndArg
+
+@(tspsub.cc@>=
+  TSPSUB::TSPSUB(ABA_MASTER *master, ABA_MESSAGE &msg) : @/
+    ABA_SUB(master, msg), @/
+    tailOffForVol_(false) @/
   { }
 
 @ The destructor.
@@ -83,6 +104,8 @@ extern "C" {
 @ @<local variables (|TSPSUB::feasible()|)@>=
   ABA_FASTSET conComp(master_, tspMaster()->nNodes());  
                // each set represents a connected component
+  ABA_ARRAY<int> tourTail(master_, tspMaster()->nNodes());  // the edges with value 1
+  ABA_ARRAY<int> tourHead(master_, tspMaster()->nNodes());
   double x;    // the LP-value of a variable
   int    t;    // the tail node associated with this variable
   int    h;    // the head node associated with this variable
@@ -116,6 +139,8 @@ extern "C" {
     if (x > oneMinusEps) {
       t = edge(i)->tail();
       h = edge(i)->head();
+      tourTail[nEdges] = t;
+      tourHead[nEdges] = h;
 
       if (++nEdges == tspMaster()->nNodes()) {
         @<LP-solution is incidence vector of a tour@>;
@@ -136,7 +161,7 @@ extern "C" {
 
 @<LP-solution is incidence vector of a tour@>=
   if (master_->betterPrimal(lp_->value()))
-    tspMaster()->updateBestTour(xVal_);
+    tspMaster()->updateBestTour(tourTail, tourHead, lp_->value());
   return true;
 
 @ The function |generateSon()| redefines a pure virtual function of the
@@ -164,17 +189,37 @@ extern "C" {
   }
 
 @ The function |separate()| generates violated subtour elimination
-  constraint. Although the number of subtour elimination constraints
+  constraints. Although the number of subtour elimination constraints
   is exponential in the number of nodes of the graph, this separation 
   problem can be solved in polynomial time by determining the minimum
   cut in the support graph, i.e., the graph induced by the variables
   (edges) having non-zero value in the LP-solution. According to the
   definition of a subtour elimination constraint, a subtour elimination
   constraint is violated if and only if the value of the minimum cut in
-  the support graph is less or equal than 2. The corresponding subtour
+  the support graph is less than 2. The corresponding subtour
   elimination constraint is given by one of the node sets defining
   a shore of this minimum cut.
 
+  Instead of a single minimum cut we generate as many violated constraints
+  as possible in each round, such that fewer linear programs have to be
+  solved. The separation problem is solved by the object of the class
+  |SUBTOURSEPARATOR| held by the master, which keeps its memory and the
+  support graph of the previous round from one call to the next one.
+
+  The constraints are ranked by their violation. Therefore, the most
+  violated ones are added first if more constraints are generated
+  than can be buffered.
+
+  Only if no violated subtour elimination constraint is found, we
+  separate the comb inequalities.
+
+  Both separators are enclosed by |startSeparator()| and
+  |stopSeparator()|, which record their running time and their
+  cutting planes up to the call of |addCons()|. If the parameter
+  {\tt AdaptiveCutting} is positive, a separator improving the dual bound
+  in the root more slowly than the average is skipped in the other
+  subproblems (see |TSPMASTER::SEPARATOR|).
+
   \BeginReturn
   The number of generated inequalities. 
   \EndReturn
@@ -182,153 +227,572 @@ extern "C" {
 @(tspsub.cc@>=
   int TSPSUB::separate()
   {
-    @<compute the minimum cut in the support graph@>;
-    @<set up the induced subtour elimination constraint@>;
-    @<clean up and return number of constraints@>;
+    @<separate the subtour elimination constraints@>;
+    @<separate the comb inequalities@>;
   }
 
+@ @<separate the subtour elimination constraints@>=
+  const int nNodes = tspMaster()->nNodes();
+  SUBTOURSEPARATOR *separator = tspMaster()->subtourSeparator();
+
+  ABA_BUFFER<ABA_CONSTRAINT*> constraints(master_, 2*nNodes);  // the generated constraints
+  ABA_BUFFER<double> rank(master_, 2*nNodes);  // the violation of the generated constraints
 
-@ @<compute the minimum cut in the support graph@>=
-  int nCutNodes;  // the number of nodes of one shore of the cut
-  int *cutNodes = new int[tspMaster()->nNodes()];  // the nodes of a shore of the cut
-  double cutValue; // the value of the minimum cut
+  int nGen = 0;  // the number of generated constraints
 
-  cutValue = minCut(nCutNodes, cutNodes);
-  master_->out() << "mincut value = " << cutValue << " on " << nCutNodes << " nodes" << endl;
+  if (startSeparator(TSPMASTER::SubtourSeparator)) {
+    separator->separate(this, constraints, rank);
+    nGen = constraints.number();
 
-@ If the value of the minimum cut is less than 2, we generate the constraint.
-  A better implementation would check if the cardinality of the complement
-  of the nodes defining the minimum cut is smaller. In this case one would
-  prefer this equivalent cut induced by the complement.
+    master_->out() << nGen << " subtour elimination constraints in ";
+    master_->out() << separator->nComponents() << " components (";
+    master_->out() << separator->nUnchanged() << " unchanged)" << endl;
 
-  The function |addCons()| adds the generated constraint to the default
+    @<add the generated constraints@>;
+    stopSeparator(TSPMASTER::SubtourSeparator);
+  }
+
+  if (nGen) return nGen;
+
+@ The function |addCons()| adds the generated constraints to the default
   cutting plane pool and the buffer of new constraints.
-  This constraint is added
+  These constraints are added
   to the current relaxation at the beginning of the next iteration.
 
-@<set up the induced subtour elimination constraint@>=
-  int nGen;  // the number of generated constraints
+@<add the generated constraints@>=
+  if (nGen) {
+    addCons(constraints, 0, 0, &rank);
+    ((TSPMASTER*) master_)->newSubTours(nGen);
+  }
 
-  if (cutValue < 2.0 - master_->eps()) {
-    nGen = 1;
-    ABA_BUFFER<ABA_CONSTRAINT*> constraint(master_, 1);
-    SUBTOUR *subTour = new  SUBTOUR(master_, nCutNodes, cutNodes);
+@ The comb inequalities are stored in their own pool held by the master.
+  Like the edges in the function |pricing()|, we first check the inactive
+  combs of this pool with the function |constraintPoolSeparation()|.
+  This pool separation is recorded in the statistics of the separators
+  like the one of the default cutting plane pool.
+  Only if none of them is violated, the heuristics of the class
+  |COMBSEPARATOR| are applied. The parameters {\tt MaxBlossoms} and
+  {\tt MaxCombs} of the file {\tt .tsp} limit the numbers of blossom
+  and comb inequalities generated in a round.
 
-    constraint.push(subTour);
+@<separate the comb inequalities@>=
+  ABA_NONDUPLPOOL<ABA_CONSTRAINT, ABA_VARIABLE> *combPool = tspMaster()->combPool();
 
-    int nAdded = addCons(constraint);
+  const int nPool = constraintPoolSeparation(0, combPool);
 
-    if (nAdded != 1) {
-      master_->err() << "Addition of constraint failed." << endl;
-      exit(Fatal);
+  if (nPool) {
+    master_->out() << nPool << " combs from the pool" << endl;
+    return nPool;
+  }
+
+  const int maxBlossoms = tspMaster()->maxBlossoms();
+  const int maxCombs    = tspMaster()->maxCombs();
+
+  if (maxBlossoms + maxCombs == 0) return 0;
+
+  if (!startSeparator(TSPMASTER::CombSeparator)) return 0;
+
+  COMBSEPARATOR *combSeparator = tspMaster()->combSeparator();
+  ABA_BUFFER<ABA_CONSTRAINT*> combs(master_, maxBlossoms + maxCombs);
+  ABA_BUFFER<double> combRank(master_, maxBlossoms + maxCombs);
+
+  combSeparator->setUpSupportGraph(this);
+
+  const int nBlossoms = combSeparator->blossoms(maxBlossoms, combs, combRank);
+  const int nCombs    = combSeparator->combs(maxCombs, combs, combRank);
+
+  master_->out() << nBlossoms << " blossoms and " << nCombs << " combs" << endl;
+
+  if (nBlossoms + nCombs) {
+    addCons(combs, combPool, 0, &combRank);
+    tspMaster()->newCombs(nBlossoms, nCombs);
+  }
+
+  stopSeparator(TSPMASTER::CombSeparator);
+
+  return nBlossoms + nCombs;
+
+@ The function |improve()| redefines a virtual function of the base class
+  |ABA_SUB|. It implements the primal heuristic, which is called by
+  \ABACUS\ in each iteration of the cutting plane algorithm if the
+  LP-solution is not feasible. A tour is constructed from the LP-solution
+  and improved by a local search with the object of the class
+  |TOURHEURISTIC| held by the master. If it is better than the best known
+  tour, it replaces this tour. The primal bound is updated by \ABACUS.
+  Only the lengths of such better tours are output.
+
+  \BeginReturn
+  1 if a better tour has been found, 0 otherwise.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|primalValue|}{Holds the length of the tour if a better tour
+                         has been found.}
+  \EndArg
+
+@(tspsub.cc@>=
+  int TSPSUB::improve(double &primalValue)
+  {
+    const int nNodes = tspMaster()->nNodes();
+    ABA_ARRAY<int> succ(master_, nNodes);  // the successor of each node in the tour
+
+    primalValue = tspMaster()->tourHeuristic()->lpTour(this, succ);
+
+    if (!master_->betterPrimal(primalValue)) return 0;
+
+    master_->out(1) << "LP-guided tour of length " << primalValue << endl;
+
+    ABA_ARRAY<int> tourTail(master_, nNodes);
+    ABA_ARRAY<int> tourHead(master_, nNodes);
+
+    for (int v = 0; v < nNodes; v++) {
+      tourTail[v] = v;
+      tourHead[v] = succ[v];
     }
-    ((TSPMASTER*) master_)->newSubTours(1);
+    if (!tspMaster()->updateBestTour(tourTail, tourHead, primalValue))
+      return 0;
+
+    return 1;
+  }
+
+@ The function |pricing()| redefines a virtual function of the base class
+  |ABA_SUB|. It generates the edges whose reduced costs are negative.
+  It is called by \ABACUS\ if no violated constraints have been generated.
+  Only if no edge is generated, the value of the linear program is a
+  dual bound of the subproblem.
+
+  First, we check the inactive edges of the variable pool with the
+  function |variablePoolSeparation()|, like the cutting planes of the
+  cut pool in the function |separate()|. The
+  reduced costs of these edges are computed by \ABACUS\ with the functions
+  |coeff()| of the active constraints. Only if none of them has negative
+  reduced costs, the edges of the complete graph, which have not been
+  generated so far, are priced out by the function |priceEdges()|.
+
+  \BeginReturn
+  The number of generated edges.
+  \EndReturn
+
+@(tspsub.cc@>=
+  int TSPSUB::pricing()
+  {
+    int nNew = variablePoolSeparation(1);
+
+    if (nNew || allEdgesGenerated()) return nNew;
+
+    return priceEdges(-master_->eps());
   }
-  else nGen = 0;
-    
-@ @<clean up and return number of constraints@>=
-  delete [] cutNodes;
-  return nGen;
 
-@ The function |minCut()| computes the minimcum cut in the support graph.
+@ The function |priceEdges()| generates the edges with the smallest
+  reduced costs among the edges that are not yet contained in the
+  variable pool. Computing the reduced cost of each of these
+  edges with the functions |coeff()| would be far too slow, because there
+  are almost $n^2/2$ of them. Instead, we exploit the structure of the
+  constraints. The coefficient of the edge $(t,h)$ is 1 in the degree
+  constraints of |t| and |h|, and in the subtour elimination constraints
+  of the node sets containing both |t| and |h|. In a comb inequality it
+  is the number of its sets containing both |t| and |h|. Therefore, we scan the
+  edges by their tails |t| and sum up the dual variables of these
+  constraints for all heads |h| at once.
+
+  At most |addVarBufferSpace()| edges can be added to the buffer of new
+  variables. The edges with the smallest reduced costs are kept in a heap,
+  whose minimal key is the negative reduced cost of the worst of them.
 
   \BeginReturn
-  The value of the minimum cut.
+  The number of generated edges.
   \EndReturn
 
   \BeginArg
-  \docarg{|nCutNodes|}{Holds the number of nodes stored in the array
-                       |cutNodes| after the function call.}
-  \docarg{|cutNodes|}{Stores one shore of the minimum cut. This array
-                      must have the length at least the number of nodes
-                      of the graph minus 1.}
+  \docarg{|maxRedCost|}{Only edges having smaller reduced costs are generated.}
   \EndArg
-  
+
 @(tspsub.cc@>=
-  double TSPSUB::minCut(int &nCutNodes, int *cutNodes)
+  int TSPSUB::priceEdges(double maxRedCost)
   {
-    @<initialize the support graph@>;
-    @<initialize the node induced subgraph@>;
-    @<call the Padberg-Rinaldi algorithm@>;
-    @<clean up and return (|TSPSUB::mincut()|)@>;
+    @<local variables (|TSPSUB::priceEdges()|)@>;
+    @<collect the generated edges by their tails@>;
+    @<collect the dual variables of the active constraints@>;
+    @<select the edges with the smallest reduced costs@>;
+    @<add the selected edges@>;
+  }
+
+@ @<local variables (|TSPSUB::priceEdges()|)@>=
+  const int nNodes = tspMaster()->nNodes();
+  const int maxNew = addVarBufferSpace();
+
+  if (maxNew == 0) return 0;
+
+  ABA_STANDARDPOOL<ABA_VARIABLE, ABA_CONSTRAINT> *pool = master_->varPool();
+  EDGE *e;
+
+@ The heads of the edges with tail |t| in the variable pool are stored
+  in |genHead[genStart[t]]|, \dots, |genHead[genStart[t+1]-1]|. We scan the
+  variable pool instead of keeping track of the generated edges, because
+  the pool is the only place where \ABACUS\ stores them.
+
+@<collect the generated edges by their tails@>=
+  ABA_ARRAY<int> genStart(master_, nNodes + 1, 0);
+  ABA_ARRAY<int> genHead(master_, pool->number());
+
+  for (int i = 0; i < pool->size(); i++) {
+    e = (EDGE *) pool->slot(i)->conVar();
+    if (e) ++genStart[e->tail() + 1];
   }
 
-@ The function we will use for solving the minimum cut problems requires
-  that the nodes are numbered beginning with 1 and the first used
-  component of an array has the number 1.
+  for (int v = 0; v < nNodes; v++)
+    genStart[v + 1] += genStart[v];
 
-@<initialize the support graph@>=
-  int *tail = new int[nVar() + 1];  // the tail of the edges
-  int *head = new int[nVar() + 1];  // the head of the edges
-  double *x = new double[nVar() + 1];  // the weight of the edges
+  ABA_ARRAY<int> genNext(master_, nNodes);  // the next free position of each tail
 
-  int nEdges = 0;  // the number of edges of the graph
+  for (int w = 0; w < nNodes; w++)
+    genNext[w] = genStart[w];
 
-  for (int i = 0; i < nVar(); i++)
-    if (xVal_[i] > master_->machineEps()) {
-      ++nEdges;
-      tail[nEdges] = edge(i)->tail() + 1;
-      head[nEdges] = edge(i)->head() + 1;
-      x[nEdges]    = xVal_[i];
+  for (int j = 0; j < pool->size(); j++) {
+    e = (EDGE *) pool->slot(j)->conVar();
+    if (e) genHead[genNext[e->tail()]++] = e->head();
+  }
+
+@ The dual variable of the degree constraint of node |v| is stored in
+  |degreeDual[v]|. A subtour elimination constraint has the coefficient 1
+  for the edges of its node set. A comb inequality has the coefficient 1
+  for the edges of its handle and of each tooth, where the coefficients
+  of an edge in the handle and in a tooth are added. Hence, both
+  constraints can be handled in the same way by adding their dual
+  variables for each of their node sets. The node sets of the constraints
+  with nonzero dual variables are stored in |setNode[setStart[d]]|,
+  \dots, |setNode[setStart[d+1]-1]|, and the corresponding dual variable
+  in |setDual[d]|. The numbers of the sets containing node |v| are stored
+  in |setOfNode[setOfNodeStart[v]]|, \dots,
+  |setOfNode[setOfNodeStart[v+1]-1]|.
+  Other constraints are not generated in this
+  example. If this was done, they would have to be considered here, too.
+
+@<collect the dual variables of the active constraints@>=
+  ABA_ARRAY<double> degreeDual(master_, nNodes, 0.0);
+  DEGREE *degree;
+  SUBTOUR *subtour;
+  COMB *comb;
+  int nSets     = 0;  // the number of node sets
+  int nSetNodes = 0;  // the sum of the numbers of nodes of the sets
+
+  @<count the node sets with nonzero dual variables@>;
+  @<store the node sets with nonzero dual variables@>;
+  @<collect the node sets by their nodes@>;
+
+@ @<count the node sets with nonzero dual variables@>=
+  for (int c = 0; c < nCon(); c++) {
+    if ((degree = dynamic_cast<DEGREE*>(constraint(c))) != 0)
+      degreeDual[degree->node()] += yVal_[c];
+    else if ((subtour = dynamic_cast<SUBTOUR*>(constraint(c))) != 0) {
+      if (fabs(yVal_[c]) > master_->machineEps()) {
+        ++nSets;
+        nSetNodes += subtour->nNodes();
+      }
     }
+    else if ((comb = dynamic_cast<COMB*>(constraint(c))) != 0) {
+      if (fabs(yVal_[c]) > master_->machineEps()) {
+        nSets += comb->nSets();
+        for (int s = 0; s < comb->nSets(); s++)
+          nSetNodes += comb->nNodes(s);
+      }
+    }
+    else {
+      master_->err() << "TSPSUB::priceEdges(): unknown constraint " << c << endl;
+      exit(Fatal);
+    }
+  }
 
-@ The function |PadbergRinaldi()|
-  can compute the minimum cut of a subgraph induced by a set of nodes.
-  Therefore, we store all nodes of the graph in the array |node|. 
-  However, a better implementation for the solution of the separation problem
-  would first compute the connected components of the
-  support graph. Each connected component induces already a subtour elimination
-  constraint. Then in addition, one would solve the minimum cut problem
-  in each subgraph induced by the nodes of a connected component.
-  There are further techniques to accelerate the solution of
-  this separation problem (see [PR90]).
+@ @<store the node sets with nonzero dual variables@>=
+  ABA_ARRAY<int> setStart(master_, nSets + 1);
+  ABA_ARRAY<int> setNode(master_, nSetNodes + 1);
+  ABA_ARRAY<double> setDual(master_, nSets + 1);
+  int nStored = 0;  // the number of stored sets
 
-@<initialize the node induced subgraph@>=
-  int *node = new int[tspMaster()->nNodes() + 1];  // the nodes inducing the graph
+  setStart[0] = 0;
 
-#ifdef ABACUS_NO_FOR_SCOPE
-  for (i = 1; i <= tspMaster()->nNodes(); i++)
-#else
-  for (int i = 1; i <= tspMaster()->nNodes(); i++)
-#endif
-    node[i] = i;
+  for (int i = 0; i < nCon(); i++) {
+    if (fabs(yVal_[i]) <= master_->machineEps()) continue;
 
+    if ((subtour = dynamic_cast<SUBTOUR*>(constraint(i))) != 0) {
+      int next = setStart[nStored];
+      for (int k = 0; k < subtour->nNodes(); k++)
+        setNode[next++] = subtour->node(k);
+      setDual[nStored]    = yVal_[i];
+      setStart[++nStored] = next;
+    }
+    else if ((comb = dynamic_cast<COMB*>(constraint(i))) != 0) {
+      for (int s = 0; s < comb->nSets(); s++) {
+        int next = setStart[nStored];
+        for (int k = 0; k < comb->nNodes(s); k++)
+          setNode[next++] = comb->node(s, k);
+        setDual[nStored]    = yVal_[i];
+        setStart[++nStored] = next;
+      }
+    }
+  }
 
-@ For the solution of the minimum cut problem, we use the Padberg-Rinaldi
-  algorithm that is part of a package for the solution of minimum
-  cut problems [JRT97b] and turned out to be very fast for solving the
-  separation problem for the subtour elimination constraints [JRT97a].
+@ @<collect the node sets by their nodes@>=
+  ABA_ARRAY<int> setOfNodeStart(master_, nNodes + 1, 0);
+
+  for (int q = 0; q < nSetNodes; q++)
+    ++setOfNodeStart[setNode[q] + 1];
+
+  for (int r = 0; r < nNodes; r++)
+    setOfNodeStart[r + 1] += setOfNodeStart[r];
+
+  ABA_ARRAY<int> setOfNode(master_, nSetNodes + 1);
+  ABA_ARRAY<int> setNext(master_, nNodes);
+
+  for (int x = 0; x < nNodes; x++)
+    setNext[x] = setOfNodeStart[x];
+
+  for (int d = 0; d < nSets; d++)
+    for (int k = setStart[d]; k < setStart[d + 1]; k++)
+      setOfNode[setNext[setNode[k]]++] = d;
+
+@ For each tail |t| we compute in |product[h]| the sum of the dual
+  variables of the constraints containing the edge $(t,h)$ for all
+  heads $h > t$, and mark the heads of the generated edges.
+  The reduced cost of the edge is its length minus |product[h]|, where
+  the lengths of all edges with tail |t| are determined at once by the
+  function |TSPMASTER::distances()|.
+
+  The selected edges are stored in |newTail|, |newHead|, and |newRedCost|.
+  The heap |best| holds the positions of the selected edges in these
+  arrays with their negative reduced costs as keys. If it is full, an edge
+  replaces the selected edge with the largest reduced cost if its reduced
+  cost is smaller.
+
+@<select the edges with the smallest reduced costs@>=
+  ABA_ARRAY<double> product(master_, nNodes);
+  ABA_ARRAY<int> distRow(master_, nNodes);
+  ABA_ARRAY<bool> generated(master_, nNodes, false);
+  ABA_BHEAP<int, double> best(master_, maxNew);
+  ABA_ARRAY<int> newTail(master_, maxNew);
+  ABA_ARRAY<int> newHead(master_, maxNew);
+  ABA_ARRAY<double> newRedCost(master_, maxNew);
+  double redCost;
+  int pos;
+
+  for (int t = 0; t < nNodes - 1; t++) {
+    for (int h = t + 1; h < nNodes; h++)
+      product[h] = degreeDual[t] + degreeDual[h];
+
+    for (int k = setOfNodeStart[t]; k < setOfNodeStart[t + 1]; k++) {
+      const int d = setOfNode[k];
+      for (int l = setStart[d]; l < setStart[d + 1]; l++)
+        if (setNode[l] > t) product[setNode[l]] += setDual[d];
+    }
 
-  The function |PadbergRinaldi()| stores the nodes defining a shore of
-  minimum the cut
-  in the components \hbox{1,\dots, |nCutNodes|} of an array and numbers the nodes
-  beginning at 1.  Therefore, we require an extra array for calling
-  this function and have to transform the node set.
-  
-@<call the Padberg-Rinaldi algorithm@>=
-  double cutValue;
-  int *prCutNodes = new int[tspMaster()->nNodes()+1];
-  
-  PadbergRinaldi(tspMaster()->nNodes(), nEdges, tspMaster()->nNodes(), 1,
-                 node, tail, head, x,
-                 &nCutNodes, prCutNodes, &cutValue);
+    for (int g = genStart[t]; g < genStart[t + 1]; g++)
+      generated[genHead[g]] = true;
+
+    tspMaster()->distances(t, t + 1, distRow);
+
+    for (int u = t + 1; u < nNodes; u++) {
+      if (generated[u]) continue;
+      redCost = distRow[u] - product[u];
+      if (redCost >= maxRedCost) continue;
+      if (best.number() < maxNew) pos = best.number();
+      else if (-redCost > best.getMinKey()) pos = best.extractMin();
+      else continue;
+      newTail[pos]    = t;
+      newHead[pos]    = u;
+      newRedCost[pos] = redCost;
+      best.insert(pos, -redCost);
+    }
+
+    for (int f = genStart[t]; f < genStart[t + 1]; f++)
+      generated[genHead[f]] = false;
+  }
+
+@ The new edges are ranked by their reduced costs, such that the best
+  ones are added if more edges have been generated than can be added
+  to the linear program. The edges which are not added must be kept in
+  the pool, otherwise they would be generated again in the next pricing
+  step.
+
+@<add the selected edges@>=
+  const int nNew = best.number();
+
+  if (nNew == 0) return 0;
+
+  ABA_BUFFER<ABA_VARIABLE*> newVars(master_, nNew);
+  ABA_BUFFER<bool> keepInPool(master_, nNew);
+  ABA_BUFFER<double> rank(master_, nNew);
+
+  for (int n = 0; n < nNew; n++) {
+    newVars.push(new EDGE(master_, newTail[n], newHead[n],
+                          tspMaster()->dist(newTail[n], newHead[n])));
+    keepInPool.push(true);
+    rank.push(-newRedCost[n]);
+  }
+
+  master_->out() << nNew << " edges with negative reduced costs" << endl;
+
+  return addVars(newVars, 0, &keepInPool, &rank);
+
+@ The function |allEdgesGenerated()|.
+  The number of edges of the complete graph is computed in |double|,
+  since it exceeds the range of |int| for more than 46340 nodes.
+
+  \BeginReturn
+  |true| If all edges of the complete graph are contained in the
+  variable pool, |false| otherwise.
+  \EndReturn
+
+@(tspsub.cc@>=
+  bool TSPSUB::allEdgesGenerated()
+  {
+    const double nNodes = tspMaster()->nNodes();
+
+    return master_->varPool()->number() == 0.5*nNodes*(nNodes - 1.0);
+  }
+
+@ The function |_makeFeasible()| redefines a virtual function of the
+  base class |ABA_SUB|, which is called if the linear program is
+  infeasible. \ABACUS\ tries to restore the feasibility with the help
+  of a row of the basis inverse, but this row is not provided by all
+  LP-solvers. Instead, we first perform a pricing step like \ABACUS. If no
+  edge has negative reduced costs, we add the inactive edges of the
+  variable pool and the edges with the smallest reduced costs that have
+  not been generated so far. The linear program is infeasible for the
+  complete graph only if
+  all edges are active. This happens only rarely, because the
+  branching rarely sets all edges of the candidate graph incident to a
+  node to 0.
+
+  \BeginReturn
+  0 If edges have been added, such that the feasibility might be restored,
+  1 otherwise.
+  \EndReturn
+
+@(tspsub.cc@>=
+  int TSPSUB::_makeFeasible()
+  {
+    if (pricing()) return 0;
+
+    @<add the inactive edges of the variable pool@>;
+
+    if (nNew == 0 && !allEdgesGenerated())
+      nNew = priceEdges(master_->infinity());
+
+    if (nNew) return 0;
+    else      return 1;
+  }
+
+@ The function |insert()| of the buffer of new variables returns 1
+  if the buffer is full.
+
+@<add the inactive edges of the variable pool@>=
+  ABA_STANDARDPOOL<ABA_VARIABLE, ABA_CONSTRAINT> *pool = master_->varPool();
+  ABA_POOLSLOT<ABA_VARIABLE, ABA_CONSTRAINT> *slot;
+  int nNew = 0;
+
+  for (int i = 0; i < pool->size(); i++) {
+    slot = pool->slot(i);
+    if (slot->conVar() && !slot->conVar()->active()) {
+      if (addVarBuffer_->insert(slot, true)) break;
+      ++nNew;
+    }
+  }
+
+@ The function |initMakeFeas()| redefines a virtual function of the
+  base class |ABA_SUB|. It is called if the linear program of a
+  subproblem is already infeasible because of the variables fixed and set
+  to their bounds. This can only happen for a degree constraint whose
+  active edges are all set to 0, or if more than 2 edges incident to a node
+  or too many edges of a subtour elimination constraint or a comb
+  inequality are set to 1. In the first case we generate the shortest edge incident to the node, which
+  has not been generated so far. Otherwise, the subproblem is infeasible.
+  Edges of the variable pool, which are not active in the subproblem, are
+  not considered here, because \ABACUS\ can only add new variables in
+  this situation.
+
+  \BeginReturn
+  0 If for each infeasible constraint an edge has been generated,
+  1 otherwise.
+  \EndReturn
+
+  \BeginArg
+  \docarg{|infeasCon|}{The infeasible constraints.}
+  \docarg{|newVars|}{The generated edges are added to this buffer.}
+  \docarg{|pool|}{The pool for the generated edges. We do not change
+                  it, such that the default variable pool is used.}
+  \EndArg
+
+@(tspsub.cc@>=
+  int TSPSUB::initMakeFeas(ABA_BUFFER<ABA_INFEASCON*> &infeasCon,
+                           ABA_BUFFER<ABA_VARIABLE*> &newVars,
+                           ABA_POOL<ABA_VARIABLE, ABA_CONSTRAINT> **pool)
+  {
+    @<local variables (|TSPSUB::initMakeFeas()|)@>;
+    @<find the shortest new edge for each infeasible constraint@>;
+    @<generate the new edges@>;
+  }
+
+@ @<local variables (|TSPSUB::initMakeFeas()|)@>=
+  const int nNodes = tspMaster()->nNodes();
+  const int nInfeas = infeasCon.number();
+  ABA_STANDARDPOOL<ABA_VARIABLE, ABA_CONSTRAINT> *varPool = master_->varPool();
+  ABA_ARRAY<int> newTail(master_, nInfeas);
+  ABA_ARRAY<int> newHead(master_, nInfeas);
+  ABA_ARRAY<bool> adjacent(master_, nNodes);
+  DEGREE *degree;
+  EDGE *e;
+  int v, w, best;
+  bool covered;
+  int nSelected = 0;  // the number of selected edges
+
+@ If an edge selected for a previous infeasible constraint is incident
+  to |v|, it might restore the feasibility of the degree constraint of
+  |v|, too. Otherwise, the nodes adjacent to |v| by a generated edge are
+  marked in |adjacent|. If no edge incident to |v| is left, we stop before
+  any edge is allocated.
+
+@<find the shortest new edge for each infeasible constraint@>=
+  for (int c = 0; c < nInfeas; c++) {
+    degree = dynamic_cast<DEGREE*>(infeasCon[c]->constraint());
+    if (degree == 0 || infeasCon[c]->infeas() != ABA_INFEASCON::TooSmall)
+      return 1;
+
+    v = degree->node();
+    covered = false;
+    for (int j = 0; j < nSelected; j++)
+      if (newTail[j] == v || newHead[j] == v) covered = true;
+    if (covered) continue;
+
+    for (int u = 0; u < nNodes; u++)
+      adjacent[u] = (u == v);
+
+    for (int i = 0; i < varPool->size(); i++) {
+      e = (EDGE *) varPool->slot(i)->conVar();
+      if (e && e->tail() == v) adjacent[e->head()] = true;
+      else if (e && e->head() == v) adjacent[e->tail()] = true;
+    }
+
+    best = -1;
+    for (w = 0; w < nNodes; w++)
+      if (!adjacent[w] &&
+          (best == -1 || tspMaster()->dist(v, w) < tspMaster()->dist(v, best)))
+        best = w;
+
+    if (best == -1) return 1;
+    newTail[nSelected] = v < best ? v : best;
+    newHead[nSelected] = v < best ? best : v;
+    ++nSelected;
+  }
+
+@ @<generate the new edges@>=
+  for (int n = 0; n < nSelected; n++)
+    newVars.push(new EDGE(master_, newTail[n], newHead[n],
+                          tspMaster()->dist(newTail[n], newHead[n])));
+
+  master_->out() << nSelected << " edges generated for infeasible constraints" << endl;
+
+  return 0;
 
-#ifdef ABACUS_NO_FOR_SCOPE
-  for (i = 0; i < nCutNodes; i++)
-#else
-  for (int i = 0; i < nCutNodes; i++)
-#endif
-    cutNodes[i] = prCutNodes[i+1] - 1;
-
-@ @<clean up and return (|TSPSUB::mincut()|)@>=
-  delete [] prCutNodes;
-  delete [] tail;
-  delete [] head;
-  delete [] node;
-  delete [] x;
-  
-  return cutValue;
-  
 @ The function |tspMaster()|.
   \BeginReturn
   A pointer to the corresponding object of the class |TSPMASTER|.
@@ -43,10 +43,8 @@
 #include "array.eti"
 #endif
 
-
-#ifdef ABACUS_PARALLEL
-
-ABA_ARRAY<int>::ABA_ARRAY(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+template<>
+ABA_ARRAY<int>::ABA_ARRAY(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
     : glob_(glob)
   {
     msg.unpack(n_);
@@ -54,7 +52,8 @@ ABA_ARRAY<int>::ABA_ARRAY(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
     msg.unpack(a_, msg.unpackInt());
   }
 
-ABA_ARRAY<double>::ABA_ARRAY(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+template<>
+ABA_ARRAY<double>::ABA_ARRAY(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
     : glob_(glob)
   {
     msg.unpack(n_);
@@ -62,39 +61,96 @@ ABA_ARRAY<double>::ABA_ARRAY(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
     msg.unpack(a_, msg.unpackInt());
   }
 
-ABA_ARRAY<ABA_FSVARSTAT*>::ABA_ARRAY(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+#ifdef ABACUS_PARALLEL
+
+template<>
+ABA_ARRAY<ABA_FSVARSTAT*>::ABA_ARRAY(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
     : glob_(glob)
   {
     msg.unpack(n_);
-    a_ = new (ABA_FSVARSTAT*)[n_];
+    a_ = new ABA_FSVARSTAT*[n_];
     int nPacked;
     msg.unpack(nPacked);
     for (int i = 0; i < nPacked; i++)
       a_[i] = new ABA_FSVARSTAT(glob, msg);
   }
 
-ABA_ARRAY<ABA_LPVARSTAT*>::ABA_ARRAY(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+template<>
+ABA_ARRAY<ABA_LPVARSTAT*>::ABA_ARRAY(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
     : glob_(glob)
   {
     msg.unpack(n_);
-    a_ = new (ABA_LPVARSTAT*)[n_];
+    a_ = new ABA_LPVARSTAT*[n_];
     int nPacked;
     msg.unpack(nPacked);
     for (int i = 0; i < nPacked; i++)
       a_[i] = new ABA_LPVARSTAT(glob, msg);
   }
 
-ABA_ARRAY<ABA_SLACKSTAT*>::ABA_ARRAY(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+template<>
+ABA_ARRAY<ABA_SLACKSTAT*>::ABA_ARRAY(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
     : glob_(glob)
   {
     msg.unpack(n_);
-    a_ = new (ABA_SLACKSTAT*)[n_];
+    a_ = new ABA_SLACKSTAT*[n_];
     int nPacked;
     msg.unpack(nPacked);
     for (int i = 0; i < nPacked; i++)
       a_[i] = new ABA_SLACKSTAT(glob, msg);
   }
 
+#else  // ABACUS_PARALLEL
+
+// the status arrays in the sequential version
+/* The statuses of an array are packed as a single block of bytes
+ *   instead of packing each status object on its own. For ABA_FSVARSTAT
+ *   the values follow.
+ */
+template<>
+ABA_ARRAY<ABA_FSVARSTAT*>::ABA_ARRAY(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+    : glob_(glob)
+  {
+    msg.unpack(n_);
+    a_ = new ABA_FSVARSTAT*[n_];
+    int nPacked;
+    msg.unpack(nPacked);
+    const char *status = msg.unpackBytes(nPacked);
+    double value;
+    for (int i = 0; i < nPacked; i++) {
+      msg.unpack(value);
+      a_[i] = new ABA_FSVARSTAT(glob, (ABA_FSVARSTAT::STATUS) status[i], value);
+    }
+  }
+
+template<>
+ABA_ARRAY<ABA_LPVARSTAT*>::ABA_ARRAY(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+    : glob_(glob)
+  {
+    msg.unpack(n_);
+    a_ = new ABA_LPVARSTAT*[n_];
+    int nPacked;
+    msg.unpack(nPacked);
+    const char *status = msg.unpackBytes(nPacked);
+    for (int i = 0; i < nPacked; i++)
+      a_[i] = new ABA_LPVARSTAT(glob, (ABA_LPVARSTAT::STATUS) status[i]);
+  }
+
+template<>
+ABA_ARRAY<ABA_SLACKSTAT*>::ABA_ARRAY(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+    : glob_(glob)
+  {
+    msg.unpack(n_);
+    a_ = new ABA_SLACKSTAT*[n_];
+    int nPacked;
+    msg.unpack(nPacked);
+    const char *status = msg.unpackBytes(nPacked);
+    for (int i = 0; i < nPacked; i++)
+      a_[i] = new ABA_SLACKSTAT(glob, (ABA_SLACKSTAT::STATUS) status[i]);
+  }
+
+#endif  // ABACUS_PARALLEL
+
+template<>
 void ABA_ARRAY<int>::pack(ABA_MESSAGE &msg, int nPacked) const
   {
     msg.pack(n_);
@@ -102,6 +158,7 @@ void ABA_ARRAY<int>::pack(ABA_MESSAGE &msg, int nPacked) const
     msg.pack(a_, nPacked);
   }
 
+template<>
 void ABA_ARRAY<double>::pack(ABA_MESSAGE &msg, int nPacked) const
   {
     msg.pack(n_);
@@ -109,6 +166,9 @@ void ABA_ARRAY<double>::pack(ABA_MESSAGE &msg, int nPacked) const
     msg.pack(a_, nPacked);
   }
 
+#ifdef ABACUS_PARALLEL
+
+template<>
 void ABA_ARRAY<ABA_FSVARSTAT*>::pack(ABA_MESSAGE &msg, int nPacked) const
   {
     msg.pack(n_);
@@ -117,6 +177,7 @@ void ABA_ARRAY<ABA_FSVARSTAT*>::pack(ABA_MESSAGE &msg, int nPacked) const
       a_[i]->pack(msg);
   }
 
+template<>
 void ABA_ARRAY<ABA_LPVARSTAT*>::pack(ABA_MESSAGE &msg, int nPacked) const
   {
     msg.pack(n_);
@@ -125,6 +186,7 @@ void ABA_ARRAY<ABA_LPVARSTAT*>::pack(ABA_MESSAGE &msg, int nPacked) const
       a_[i]->pack(msg);
   }
 
+template<>
 void ABA_ARRAY<ABA_SLACKSTAT*>::pack(ABA_MESSAGE &msg, int nPacked) const
   {
     msg.pack(n_);
@@ -133,4 +195,38 @@ void ABA_ARRAY<ABA_SLACKSTAT*>::pack(ABA_MESSAGE &msg, int nPacked) const
       a_[i]->pack(msg);
   }
 
-#endif
+#else  // ABACUS_PARALLEL
+
+template<>
+void ABA_ARRAY<ABA_FSVARSTAT*>::pack(ABA_MESSAGE &msg, int nPacked) const
+  {
+    msg.pack(n_);
+    msg.pack(nPacked);
+    char *status = msg.packBytes(nPacked);
+    for (int i = 0; i < nPacked; i++)
+      status[i] = (char) a_[i]->status();
+    for (int i = 0; i < nPacked; i++)
+      msg.pack(a_[i]->value());
+  }
+
+template<>
+void ABA_ARRAY<ABA_LPVARSTAT*>::pack(ABA_MESSAGE &msg, int nPacked) const
+  {
+    msg.pack(n_);
+    msg.pack(nPacked);
+    char *status = msg.packBytes(nPacked);
+    for (int i = 0; i < nPacked; i++)
+      status[i] = (char) a_[i]->status();
+  }
+
+template<>
+void ABA_ARRAY<ABA_SLACKSTAT*>::pack(ABA_MESSAGE &msg, int nPacked) const
+  {
+    msg.pack(n_);
+    msg.pack(nPacked);
+    char *status = msg.packBytes(nPacked);
+    for (int i = 0; i < nPacked; i++)
+      status[i] = (char) a_[i]->status();
+  }
+
+#endif  // ABACUS_PARALLEL
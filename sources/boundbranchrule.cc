@@ -32,9 +32,7 @@
 #include "abacus/fsvarstat.h"
 #include "abacus/lpsub.h"
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
 
 ABA_BOUNDBRANCHRULE::ABA_BOUNDBRANCHRULE(ABA_MASTER *master, 
                                            int variable,
@@ -50,8 +48,7 @@ ABA_BOUNDBRANCHRULE::ABA_BOUNDBRANCHRULE(ABA_MASTER *master,
 ABA_BOUNDBRANCHRULE::~ABA_BOUNDBRANCHRULE()
   { }
 
-#ifdef ABACUS_PARALLEL
-ABA_BOUNDBRANCHRULE::ABA_BOUNDBRANCHRULE(const ABA_MASTER *master, ABA_MESSAGE &msg)
+ABA_BOUNDBRANCHRULE::ABA_BOUNDBRANCHRULE(ABA_MASTER *master, ABA_MESSAGE &msg)
     : 
     ABA_BRANCHRULE(master, msg)
   {
@@ -78,8 +75,6 @@ int ABA_BOUNDBRANCHRULE::classId() const
   }
 
 
-#endif
-
 ostream &operator<<(ostream &out, const ABA_BOUNDBRANCHRULE &rhs)
   {
     return out << rhs.lBound_ << " <= x" << rhs.variable_ << " <= " << rhs.uBound_;
@@ -29,9 +29,7 @@
 #include "abacus/branchrule.h"
 #include "abacus/master.h"
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
 
 ABA_BRANCHRULE::ABA_BRANCHRULE(ABA_MASTER *master) 
   : master_(master)
@@ -40,15 +38,21 @@ ABA_BRANCHRULE::ABA_BRANCHRULE(ABA_MASTER *master)
 ABA_BRANCHRULE::~ABA_BRANCHRULE()
   { }
 
-#ifdef ABACUS_PARALLEL
-
-ABA_BRANCHRULE::ABA_BRANCHRULE(const ABA_MASTER *master, ABA_MESSAGE &msg)
+ABA_BRANCHRULE::ABA_BRANCHRULE(ABA_MASTER *master, ABA_MESSAGE &msg)
     : master_(master)
   { }
 
 void ABA_BRANCHRULE::pack(ABA_MESSAGE &msg) const
   { }
 
+#ifndef ABACUS_PARALLEL
+int ABA_BRANCHRULE::classId() const
+  {
+    master_->err() << "ABA_BRANCHRULE::classId(): not redefined in the derived ";
+    master_->err() << "class, the branching rule cannot be packed." << endl;
+    exit(Fatal);
+    return 0;           //!< to suppress compiler warning
+  }
 #endif
 
 bool ABA_BRANCHRULE::branchOnSetVar()
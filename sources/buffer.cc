@@ -42,9 +42,8 @@
 #include "buffer.eti"
 #endif
 
-#ifdef ABACUS_PARALLEL
-
-ABA_BUFFER<int>::ABA_BUFFER(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+template<>
+ABA_BUFFER<int>::ABA_BUFFER(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
     : glob_(glob)
   {
     msg.unpack(size_);
@@ -55,11 +54,10 @@ ABA_BUFFER<int>::ABA_BUFFER(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
 
 
 
+template<>
 void ABA_BUFFER<int>::pack(ABA_MESSAGE &msg) const
   {
     msg.pack(size_);
     msg.pack(n_);
     msg.pack(buf_,n_);
   }
-
-#endif
@@ -0,0 +1,409 @@
+/*!\file
+ * \author The ABACUS developers
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#include "abacus/checkpoint.h"
+#include "abacus/master.h"
+#include "abacus/sub.h"
+#include "abacus/opensub.h"
+#include "abacus/message.h"
+#include "abacus/standardpool.h"
+#include "abacus/constraint.h"
+#include "abacus/variable.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+  ABA_CHECKPOINT::ABA_CHECKPOINT(ABA_MASTER *master, const char *fileName)
+  :
+    master_(master),
+    fileName_(master, fileName),
+    pending_(false),
+    done_(false),
+    running_(false),
+    failed_(false)
+  {
+    fill_  = new ABA_MESSAGE(master_);
+    write_ = new ABA_MESSAGE(master_);
+
+    pthread_mutex_init(&mutex_, 0);
+    pthread_cond_init(&cond_, 0);
+
+    startWriter();
+  }
+
+  ABA_CHECKPOINT::~ABA_CHECKPOINT()
+  {
+    stopWriter();
+
+    pthread_cond_destroy(&cond_);
+    pthread_mutex_destroy(&mutex_);
+
+    delete fill_;
+    delete write_;
+  }
+
+  bool ABA_CHECKPOINT::write()
+  {
+    reportFailure();
+
+    if (!packable()) {
+      master_->err() << "WARNING: ABA_CHECKPOINT::write(): a pool contains ";
+      master_->err() << "locally valid constraints or variables, ";
+      master_->err() << "checkpoint skipped." << endl;
+      return false;
+    }
+
+    fill_->clear();
+
+// pack the statistics, bounds, and timers of the master
+  master_->_packStatistics(*fill_);
+  fill_->pack(master_->totalCowTime_.centiSeconds());
+
+  fill_->pack(master_->primalBound_);
+  fill_->pack(master_->dualBound_);
+  fill_->pack(master_->rootDualBound_);
+
+// pack the default pools
+/* The pools have to be packed before the subproblems since the active
+ *   sets of the subproblems refer to the slots of these pools. A pool
+ *   which has not been allocated is marked by a 0. The pools registered
+ *   by the application follow the three pools of the master.
+ */
+  const int nPools = master_->nDefaultPools();
+
+  fill_->pack(nPools);
+  for (int p = 0; p < nPools; p++) {
+    if (master_->defaultPool(p) == 0)
+      fill_->pack(0);
+    else {
+      fill_->pack(1);
+      if (p == 2)
+        master_->varPool_->pack(*fill_);
+      else
+        ((ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE>*) master_->defaultPool(p))->pack(*fill_);
+    }
+  }
+
+// pack the open subproblems
+  ABA_DLISTITEM<ABA_SUB*> *item;
+  ABA_SUB                 *sub;
+
+  fill_->pack(master_->openSub_->number());
+  forAllDListElem(master_->openSub_->list_, item, sub)
+    sub->pack(*fill_);
+
+  // pack the problem specific data
+  master_->packCheckpoint(*fill_);
+
+  master_->out(1) << "checkpoint with " << master_->openSub_->number();
+  master_->out() << " open subproblems written to " << fileName_ << endl;
+
+// pass the message to the writer thread
+/* If the writer thread is still busy with the previous checkpoint,
+ *   we have to wait.
+ */
+  if (!running_) {
+    ABA_MESSAGE *h = write_;
+    write_ = fill_;
+    fill_  = h;
+    failed_ = writeFile();
+    reportFailure();
+    return true;
+  }
+
+  pthread_mutex_lock(&mutex_);
+  while (pending_) pthread_cond_wait(&cond_, &mutex_);
+
+  ABA_MESSAGE *h = write_;
+  write_   = fill_;
+  fill_    = h;
+  pending_ = true;
+
+  pthread_cond_broadcast(&cond_);
+  pthread_mutex_unlock(&mutex_);
+
+  return true;
+  }
+
+  bool ABA_CHECKPOINT::restart()
+  {
+    FILE *file = fopen(fileName_.string(), "rb");
+    if (file == 0) {
+      master_->err() << "WARNING: ABA_CHECKPOINT::restart(): cannot open ";
+      master_->err() << fileName_ << ", starting with the root node." << endl;
+      return false;
+    }
+
+// read the checkpoint file
+/* The file is checked completely before the optimization is modified.
+ */
+  const int magicLength = strlen(magic());
+  char      m[64];
+  int       one;
+  bool      failed;
+
+  failed = (int) fread(m, 1, magicLength, file) != magicLength
+           || strncmp(m, magic(), magicLength)
+           || fread(&one, sizeof(int), 1, file) != 1
+           || one != 1
+           || fill_->read(file);
+
+  fclose(file);
+
+  if (failed) {
+    master_->err() << "WARNING: ABA_CHECKPOINT::restart(): " << fileName_;
+    master_->err() << " is not a checkpoint of this machine, ";
+    master_->err() << "starting with the root node." << endl;
+    return false;
+  }
+
+// unpack the statistics, bounds, and timers of the master
+/* The timers have been started in the constructor of the master, hence
+ *   we add the time of the interrupted run.
+ */
+  ABA_MESSAGE &msg = *fill_;
+  long         centiSeconds;
+
+  master_->_unpackStatistics(msg, 0);
+  msg.unpack(centiSeconds);
+  master_->totalCowTime_.addCentiSeconds(centiSeconds);
+
+  msg.unpack(master_->primalBound_);
+  msg.unpack(master_->dualBound_);
+  msg.unpack(master_->rootDualBound_);
+
+// unpack the default pools
+/* The constraints and variables of the initial pools are replaced.
+ *   References of the root node to them become invalid, but the root
+ *   node is not optimized again.
+ */
+  const int nPools = msg.unpackInt();
+
+  for (int p = 0; p < nPools; p++) {
+    if (msg.unpackInt() == 0) continue;
+    if (master_->defaultPool(p) == 0) {
+      master_->err() << "ABA_CHECKPOINT::restart(): pool " << p;
+      master_->err() << " of the checkpoint does not exist." << endl;
+      exit(Fatal);
+    }
+    if (p == 2)
+      master_->varPool_->unpack(msg);
+    else
+      ((ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE>*) master_->defaultPool(p))->unpack(msg);
+  }
+
+// unpack the open subproblems
+/* The restored subproblems become the sons of the root node, which is
+ *   regarded as processed.
+ */
+  ABA_SUB  *root  = master_->root();
+  const int nOpen = msg.unpackInt();
+
+  root->status_ = ABA_SUB::Processed;
+  root->sons_   = new ABA_BUFFER<ABA_SUB*>(master_, nOpen > 0 ? nOpen : 1);
+
+  master_->treeInterfaceNewNode(root);
+
+  for (int i = 0; i < nOpen; i++) {
+    ABA_SUB *sub = master_->unpackSub(msg);
+
+    sub->father_ = root;
+    root->sons_->push(sub);
+    master_->openSub_->insert(sub);
+    master_->treeInterfaceNewNode(sub);
+  }
+
+  // unpack the problem specific data
+  master_->unpackCheckpoint(msg);
+
+  master_->out() << "restarted from checkpoint " << fileName_ << " with ";
+  master_->out() << nOpen << " open subproblems" << endl;
+
+  return true;
+  }
+
+  void ABA_CHECKPOINT::flush()
+  {
+    if (!running_) return;
+
+    pthread_mutex_lock(&mutex_);
+    while (pending_) pthread_cond_wait(&cond_, &mutex_);
+    pthread_mutex_unlock(&mutex_);
+
+    reportFailure();
+  }
+
+  void ABA_CHECKPOINT::startWriter()
+  {
+    if (running_) return;
+
+// start the writer thread
+/* If no thread can be started, the checkpoints are written
+ *   synchronously in \a write().
+ */
+    done_ = false;
+
+    if (pthread_create(&thread_, 0, writer, this) == 0)
+      running_ = true;
+    else {
+      master_->err() << "WARNING: ABA_CHECKPOINT::startWriter(): ";
+      master_->err() << "starting writer thread failed, ";
+      master_->err() << "writing synchronously." << endl;
+    }
+  }
+
+  void ABA_CHECKPOINT::stopWriter()
+  {
+    if (running_) {
+      pthread_mutex_lock(&mutex_);
+      done_ = true;
+      pthread_cond_broadcast(&cond_);
+      pthread_mutex_unlock(&mutex_);
+      pthread_join(thread_, 0);
+
+      running_ = false;
+    }
+
+    reportFailure();
+  }
+
+  void ABA_CHECKPOINT::reportFailure()
+  {
+// report a failure of the writer thread
+/* The writer thread must not use the output streams of the master,
+ *   hence it only records the failure.
+ */
+    bool failed;
+
+    if (running_) pthread_mutex_lock(&mutex_);
+    failed  = failed_;
+    failed_ = false;
+    if (running_) pthread_mutex_unlock(&mutex_);
+
+    if (failed) {
+      master_->err() << "WARNING: ABA_CHECKPOINT: writing the checkpoint ";
+      master_->err() << fileName_ << " failed." << endl;
+    }
+  }
+
+  bool ABA_CHECKPOINT::packable() const
+  {
+    ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE> *conPool;
+    ABA_CONVAR *cv;
+
+    const int nPools = master_->nDefaultPools();
+
+    for (int p = 0; p < nPools; p++) {
+      if (p == 2) continue;
+      conPool = (ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE>*) master_->defaultPool(p);
+      if (conPool == 0) continue;
+      const int s = conPool->size();
+      for (int i = 0; i < s; i++) {
+        cv = conPool->slot(i)->conVar();
+        if (cv && cv->local() && cv->sub()) return false;
+      }
+    }
+
+    ABA_STANDARDPOOL<ABA_VARIABLE, ABA_CONSTRAINT> *varPool = master_->varPool_;
+    if (varPool) {
+      const int s = varPool->size();
+      for (int i = 0; i < s; i++) {
+        cv = varPool->slot(i)->conVar();
+        if (cv && cv->local() && cv->sub()) return false;
+      }
+    }
+
+    return true;
+  }
+
+  bool ABA_CHECKPOINT::writeFile()
+  {
+// write the checkpoint to a temporary file
+/* The temporary file replaces the checkpoint file only after it has
+ *   been written completely. Hence, an interruption while writing leaves
+ *   the previous checkpoint intact.
+ */
+  char *tmpName = new char[strlen(fileName_.string())+5];
+  sprintf(tmpName, "%s.tmp", fileName_.string());
+
+  FILE *file = fopen(tmpName, "wb");
+  if (file == 0) {
+    delete [] tmpName;
+    return true;
+  }
+
+  int  one = 1;
+  bool failed;
+
+  failed = fwrite(magic(), 1, strlen(magic()), file) != strlen(magic())
+           || fwrite(&one, sizeof(int), 1, file) != 1
+           || write_->write(file)
+           || fflush(file)
+           || fsync(fileno(file));
+
+  if (fclose(file) || failed || rename(tmpName, fileName_.string())) {
+    remove(tmpName);
+    failed = true;
+  }
+
+  delete [] tmpName;
+  return failed;
+  }
+
+  void *ABA_CHECKPOINT::writer(void *checkpoint)
+  {
+    ABA_CHECKPOINT *cp = (ABA_CHECKPOINT*) checkpoint;
+
+// write the messages passed by \a write()
+/* The message \a write_ is not touched by \a write() as long
+ *   as \a pending_ is true. Therefore, we can write it without
+ *   holding the mutex.
+ */
+    pthread_mutex_lock(&cp->mutex_);
+    for (;;) {
+      while (!cp->pending_ && !cp->done_)
+        pthread_cond_wait(&cp->cond_, &cp->mutex_);
+
+      if (!cp->pending_) break;
+
+      pthread_mutex_unlock(&cp->mutex_);
+
+      bool failed = cp->writeFile();
+
+      pthread_mutex_lock(&cp->mutex_);
+      if (failed) cp->failed_ = true;
+      cp->pending_ = false;
+      pthread_cond_broadcast(&cp->cond_);
+    }
+    pthread_mutex_unlock(&cp->mutex_);
+
+    return 0;
+  }
@@ -29,9 +29,7 @@
 #include "abacus/column.h"
 #include "abacus/global.h"
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
 
 ABA_COLUMN::ABA_COLUMN(ABA_GLOBAL *glob, 
                          double obj, 
@@ -70,9 +68,7 @@ ABA_COLUMN::~ABA_COLUMN()
   { }
   
 
-#ifdef ABACUS_PARALLEL
-
-ABA_COLUMN::ABA_COLUMN(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+ABA_COLUMN::ABA_COLUMN(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
     :  
     ABA_SPARVEC(glob, msg)
   {
@@ -89,8 +85,6 @@ void ABA_COLUMN::pack(ABA_MESSAGE &msg) const
     msg.pack(uBound_);
   }
 
-#endif
-
 ostream &operator<<(ostream &out, const ABA_COLUMN &rhs)
   {
     out << "objective function coefficient: " << rhs.obj() << endl;
@@ -66,9 +66,7 @@ ABA_COLVAR::~ABA_COLVAR()
   { }
 
 
-#ifdef ABACUS_PARALLEL
-
-ABA_COLVAR::ABA_COLVAR(const ABA_MASTER *master, ABA_MESSAGE &msg)
+ABA_COLVAR::ABA_COLVAR(ABA_MASTER *master, ABA_MESSAGE &msg)
   :
     ABA_VARIABLE(master, msg),
     column_(master, msg)
@@ -85,8 +83,6 @@ int ABA_COLVAR::classId() const
     return COLVAR_CLASSID;
   }
 
-#endif
-
 ostream &operator<<(ostream &out, const ABA_COLVAR &rhs)
   {
     return out << rhs.column_;
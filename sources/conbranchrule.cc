@@ -33,9 +33,9 @@
 #include "abacus/sub.h"
 #include "abacus/lpsub.h"
 
+#include "abacus/message.h"
 #ifdef ABACUS_PARALLEL
 #include "abacus/parmaster.h"
-#include "abacus/message.h"
 #include "abacus/pool.h"
 #include "abacus/poolslot.h"
 #include "abacus/debug.h"
@@ -54,7 +54,7 @@ ABA_CONBRANCHRULE::~ABA_CONBRANCHRULE()
 
 #ifdef ABACUS_PARALLEL
 
-ABA_CONBRANCHRULE::ABA_CONBRANCHRULE(const ABA_MASTER *master, ABA_MESSAGE &msg)
+ABA_CONBRANCHRULE::ABA_CONBRANCHRULE(ABA_MASTER *master, ABA_MESSAGE &msg)
     :
     ABA_BRANCHRULE(master, msg),
     poolSlotRef_(master)
@@ -131,13 +131,82 @@ void ABA_CONBRANCHRULE::pack(ABA_MESSAGE &msg) const
     }
   }
 
+#else  // ABACUS_PARALLEL
+
+ABA_CONBRANCHRULE::ABA_CONBRANCHRULE(ABA_MASTER *master, ABA_MESSAGE &msg)
+    :
+    ABA_BRANCHRULE(master, msg),
+    poolSlotRef_(master)
+  {
+    int  pool  = msg.unpackInt();
+    bool byValue;
+    msg.unpack(byValue);
+
+    ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE> *p =
+      (ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE>*) master_->defaultPool(pool);
+
+// insert a branching constraint sent by value
+/* In a distributed optimization the constraints of the cut pool are sent
+ *   by value to another process, where they are inserted in the pool again.
+ */
+    if (byValue) {
+      int classId = msg.unpackInt();
+      ABA_CONSTRAINT *con = (ABA_CONSTRAINT*) master_->unpackConVar(msg, classId);
+      ABA_POOLSLOT<ABA_CONSTRAINT, ABA_VARIABLE> *slot = p ? p->insert(con) : 0;
+      if (slot == 0) {
+        master_->err() << "ABA_CONBRANCHRULE::ABA_CONBRANCHRULE(): inserting ";
+        master_->err() << "the branching constraint failed." << endl;
+        exit(Fatal);
+      }
+      poolSlotRef_.slot(slot);
+      return;
+    }
+
+    int  index = msg.unpackInt();
+    long version;
+    msg.unpack(version);
+
+    if (p == 0 || index < 0 || index >= p->size()
+        || p->slot(index)->version() != (unsigned long) version) {
+      master_->err() << "ABA_CONBRANCHRULE::ABA_CONBRANCHRULE(): branching ";
+      master_->err() << "constraint not available." << endl;
+      exit(Fatal);
+    }
+    poolSlotRef_.slot(p->slot(index));
+  }
+
+void ABA_CONBRANCHRULE::pack(ABA_MESSAGE &msg) const
+  {
+    ABA_BRANCHRULE::pack(msg);
+
+    ABA_POOLSLOT<ABA_CONSTRAINT, ABA_VARIABLE> *ps = poolSlotRef_.slot();
+    int pool = ps ? master_->defaultPoolIndex(ps->pool()) : -1;
+
+    if (pool < 0 || ps->index() < 0) {
+      master_->err() << "ABA_CONBRANCHRULE::pack(): branching constraint not";
+      master_->err() << " available in a default pool!" << endl;
+      exit(Fatal);
+    }
+    msg.pack(pool);
+    if (master_->packByValue(pool)) {
+      msg.pack(true);
+      msg.pack(ps->conVar()->classId());
+      ps->conVar()->pack(msg);
+    }
+    else {
+      msg.pack(false);
+      msg.pack(ps->index());
+      msg.pack((long) poolSlotRef_.version());
+    }
+  }
+
+#endif  // ABACUS_PARALLEL
+
 int ABA_CONBRANCHRULE::classId() const
   {
     return CONBRANCHRULE_CLASSID;
   }
 
-#endif
-
 ostream &operator<<(ostream &out, const ABA_CONBRANCHRULE &rhs)
   {
     return out << rhs.poolSlotRef_;
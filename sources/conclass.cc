@@ -29,9 +29,7 @@
 #include "abacus/conclass.h"
 #include "abacus/master.h"
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
 
 ABA_CONCLASS::ABA_CONCLASS(const ABA_MASTER *master, bool discrete,
                      bool allVarBinary, bool trivial,
@@ -45,9 +43,7 @@ ABA_CONCLASS::ABA_CONCLASS(const ABA_MASTER *master, bool discrete,
   { }
 
 
-#ifdef ABACUS_PARALLEL
-
-ABA_CONCLASS::ABA_CONCLASS(const ABA_MASTER *master, ABA_MESSAGE &msg)
+ABA_CONCLASS::ABA_CONCLASS(ABA_MASTER *master, ABA_MESSAGE &msg)
     :  
     master_(master)
   {
@@ -65,8 +61,6 @@ void ABA_CONCLASS::pack(ABA_MESSAGE &msg) const
               8*bound_ + 16*varBound_ );
   }
 
-#endif
-
 ostream &operator<<(ostream &out, const ABA_CONCLASS &rhs)
   {
     bool classified = false;
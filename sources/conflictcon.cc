@@ -0,0 +1,145 @@
+/*!\file
+ * \author The ABACUS developers
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#include "abacus/conflictcon.h"
+#include "abacus/master.h"
+#include "abacus/message.h"
+#include "abacus/variable.h"
+#include "abacus/standardpool.h"
+
+  ABA_CONFLICTCON::ABA_CONFLICTCON(ABA_MASTER *master,
+                                   int nnz,
+                                   const ABA_ARRAY<ABA_POOLSLOT<ABA_VARIABLE, ABA_CONSTRAINT>*> &slot,
+                                   const ABA_ARRAY<double> &value)
+  :
+    ABA_CONSTRAINT(master, 0, ABA_CSENSE::Greater, 1.0, true, false, false),
+    var_(master, nnz),
+    coeff_(master, nnz)
+  {
+// set the coefficients and the right hand side
+/* A variable with value 0 in the conflict has coefficient 1, a variable
+ *   with value 1 has coefficient -1, and moves the constant 1 of its term
+ *   \f$(1 - x_j)\f$ to the right hand side.
+ */
+    for (int i = 0; i < nnz; i++) {
+      var_[i] = new ABA_POOLSLOTREF<ABA_VARIABLE, ABA_CONSTRAINT>(slot[i]);
+      if (value[i] > 0.5) {
+        coeff_[i] = -1.0;
+        rhs_     -=  1.0;
+      }
+      else
+        coeff_[i] = 1.0;
+    }
+  }
+
+  ABA_CONFLICTCON::~ABA_CONFLICTCON()
+  {
+    const int nnz = var_.size();
+
+    for (int i = 0; i < nnz; i++)
+      delete var_[i];
+  }
+
+  ABA_CONFLICTCON::ABA_CONFLICTCON(ABA_MASTER *master, ABA_MESSAGE &msg)
+  :
+    ABA_CONSTRAINT(master, msg),
+    var_(master, msg.unpackInt()),
+    coeff_(master, var_.size())
+  {
+// unpack the references to the variables
+/* The variables are not generated dynamically if conflict constraints are
+ *   derived. Hence, the default pool of variables is the same in all
+ *   processes of a distributed optimization and the index of a slot
+ *   identifies the variable.
+ */
+    ABA_STANDARDPOOL<ABA_VARIABLE, ABA_CONSTRAINT> *pool = master_->varPool();
+    const int nnz = var_.size();
+
+    for (int i = 0; i < nnz; i++) {
+      int index = msg.unpackInt();
+      if (index >= pool->size()) {
+        master_->err() << "ABA_CONFLICTCON::ABA_CONFLICTCON(): slot " << index;
+        master_->err() << " of the variable pool not available." << endl;
+        exit(Fatal);
+      }
+      var_[i] = new ABA_POOLSLOTREF<ABA_VARIABLE, ABA_CONSTRAINT>(pool->slot(index));
+      msg.unpack(coeff_[i]);
+    }
+  }
+
+  void ABA_CONFLICTCON::pack(ABA_MESSAGE &msg) const
+  {
+    ABA_CONSTRAINT::pack(msg);
+
+    const int nnz = var_.size();
+
+    msg.pack(nnz);
+    for (int i = 0; i < nnz; i++) {
+      msg.pack(var_[i]->slot()->index());
+      msg.pack(coeff_[i]);
+    }
+  }
+
+  int ABA_CONFLICTCON::classId() const
+  {
+    return CONFLICTCON_CLASSID;
+  }
+
+  bool ABA_CONFLICTCON::explicitRow() const
+  {
+    return true;
+  }
+
+  double ABA_CONFLICTCON::coeff(ABA_VARIABLE *v)
+  {
+    const int nnz = var_.size();
+    ABA_POOLSLOT<ABA_VARIABLE, ABA_CONSTRAINT> *slot;
+
+    for (int i = 0; i < nnz; i++) {
+      slot = var_[i]->slot();
+      if (slot->conVar() == v && slot->version() == var_[i]->version())
+        return coeff_[i];
+    }
+
+    return 0.0;
+  }
+
+  void ABA_CONFLICTCON::print(ostream &out)
+  {
+    const int nnz = var_.size();
+
+    for (int i = 0; i < nnz; i++) {
+      if (coeff_[i] < 0.0)    out << "- ";
+      else if (i > 0)         out << "+ ";
+      out << 'x' << var_[i]->slot()->index() << ' ';
+    }
+
+    out << sense_ << ' ' << rhs_;
+  }
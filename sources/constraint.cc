@@ -80,9 +80,7 @@ ABA_CONSTRAINT::~ABA_CONSTRAINT()
   }
 
 
-#ifdef ABACUS_PARALLEL
-
-ABA_CONSTRAINT::ABA_CONSTRAINT(const ABA_MASTER *master, ABA_MESSAGE &msg)
+ABA_CONSTRAINT::ABA_CONSTRAINT(ABA_MASTER *master, ABA_MESSAGE &msg)
   :  
     ABA_CONVAR(master, msg),  
     sense_(master, msg),  
@@ -106,13 +104,16 @@ void ABA_CONSTRAINT::pack(ABA_MESSAGE &msg) const
       conClass_->pack(msg);
   }
 
-#endif
-
 double ABA_CONSTRAINT::rhs()
   {
     return rhs_;
   }
 
+bool ABA_CONSTRAINT::explicitRow() const
+  {
+    return false;
+  }
+
 bool ABA_CONSTRAINT::valid(ABA_SUB *sub)
   {
 #ifdef ABACUSSAFE
@@ -236,14 +237,9 @@ double ABA_CONSTRAINT::distance(double *x,
 
     ABA_ROW a(master_, actVar->number());
 
-    int nnz = genRow(actVar, a);
-
-    double ax = 0.0;
-
-    for (int i = 0; i < nnz; i++)
-      ax += a.coeff(i) * x[a.support(i)];
+    genRow(actVar, a);
 
-    return fabs((rhs() - ax)/a.norm());
+    return fabs((rhs() - a.dot(x))/a.norm());
 
   }
 
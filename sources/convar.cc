@@ -31,8 +31,8 @@
 #include "abacus/convar.h"
 #include "abacus/active.h"
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
+#ifdef ABACUS_PARALLEL
 #include "abacus/idmap.h"
 #endif
 
@@ -75,9 +75,7 @@ ABA_CONVAR::~ABA_CONVAR()
   }
 
 
-#ifdef ABACUS_PARALLEL
-
-  ABA_CONVAR::ABA_CONVAR(const ABA_MASTER *master, ABA_MESSAGE &msg)
+  ABA_CONVAR::ABA_CONVAR(ABA_MASTER *master, ABA_MESSAGE &msg)
     :  
     master_(master),  
     sub_(0),  
@@ -88,7 +86,11 @@ ABA_CONVAR::~ABA_CONVAR()
   {
     int bits = msg.unpackInt();
 
-    assert((bits&1)==0);             //!< \a sub_ must be 0
+    if (bits&1) {                    //!< \a sub_ must be 0
+      master_->err() << "ABA_CONVAR::ABA_CONVAR(): constraint/variable must "
+                        "be globally valid." << endl;
+      exit(Fatal);
+    }
     dynamic_  = ((bits&2)?true:false);
     local_    = ((bits&4)?true:false);
   }
@@ -104,6 +106,14 @@ ABA_CONVAR::~ABA_CONVAR()
     }
   }
 
+#ifndef ABACUS_PARALLEL
+  int ABA_CONVAR::classId() const
+  {
+    master_->err() << "ABA_CONVAR::classId(): not redefined in the derived ";
+    master_->err() << "class, the constraint/variable cannot be packed." << endl;
+    exit(Fatal);
+    return 0;           //!< to suppress compiler warning
+  }
 #endif
 
 void ABA_CONVAR::deactivate()
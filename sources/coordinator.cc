@@ -0,0 +1,364 @@
+/*!\file
+ * \author The ABACUS developers
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#include "abacus/coordinator.h"
+#include "abacus/message.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+  ABA_COORDINATOR::ABA_COORDINATOR(ABA_MASTER *master,
+                                   const ABA_ARRAY<int> &fd,
+                                   const ABA_ARRAY<int> &pid,
+                                   const ABA_MESSAGE &base)
+  :
+    master_(master),
+    nWorkers_(fd.size()),
+    fd_(master, fd.size()),
+    pid_(master, fd.size()),
+    nOpen_(master, fd.size(), 0),
+    dualBound_(master, fd.size(), master->dualBound()),
+    idle_(master, fd.size(), false),
+    asked_(master, fd.size(), false),
+    donor_(master, fd.size(), -1),
+    done_(master, fd.size(), false),
+    queue_(master, fd.size()),
+    sent_(master, fd.size(), 0),
+    bestWorker_(-1),
+    stopping_(false),
+    status_(ABA_MASTER::Processing)
+  {
+    base_ = new ABA_MESSAGE(master_);
+    base_->pack(base);
+    in_   = new ABA_MESSAGE(master_);
+
+    for (int w = 0; w < nWorkers_; w++) {
+      fd_[w]    = fd[w];
+      pid_[w]   = pid[w];
+      queue_[w] = new ABA_MESSAGE(master_);
+    }
+  }
+
+  ABA_COORDINATOR::~ABA_COORDINATOR()
+  {
+    for (int w = 0; w < nWorkers_; w++) {
+      close(fd_[w]);
+      delete queue_[w];
+    }
+    delete base_;
+    delete in_;
+  }
+
+  ABA_MASTER::STATUS ABA_COORDINATOR::run()
+  {
+    struct pollfd *pfd    = new struct pollfd[nWorkers_];
+    int           *worker = new int[nWorkers_];
+
+// process the messages of the workers
+/* We poll for incoming messages of all workers which have not terminated
+ *   yet, and for the sockets to which queued messages can be written.
+ *   A message is always received completely, since a worker sends it
+ *   at once.
+ */
+    for (;;) {
+      int n = 0;
+
+      for (int w = 0; w < nWorkers_; w++) {
+        if (done_[w]) continue;
+        pfd[n].fd      = fd_[w];
+        pfd[n].events  = POLLIN;
+        if (sent_[w] < queue_[w]->length()) pfd[n].events |= POLLOUT;
+        pfd[n].revents = 0;
+        worker[n]      = w;
+        ++n;
+      }
+
+      if (n == 0) break;
+
+      if (poll(pfd, n, -1) < 0) {
+        if (errno == EINTR) continue;
+        master_->err() << "ABA_COORDINATOR::run(): poll() failed." << endl;
+        exit(Fatal);
+      }
+
+      for (int i = 0; i < n; i++) {
+        const int w = worker[i];
+
+        if (pfd[i].revents & POLLOUT) flush(w);
+        if (pfd[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+          if (in_->receive(fd_[w])) abort(w);
+          handle(w);
+        }
+      }
+
+      balance();
+      checkTermination();
+    }
+
+    delete [] pfd;
+    delete [] worker;
+
+    for (int w = 0; w < nWorkers_; w++)
+      waitpid((pid_t) pid_[w], 0, 0);
+
+    master_->out() << "distributed optimization with " << nWorkers_;
+    master_->out() << " workers terminated" << endl;
+
+    return status_;
+  }
+
+  void ABA_COORDINATOR::handle(int w)
+  {
+    switch (in_->unpackInt()) {
+      case StatusTag:
+        in_->unpack(nOpen_[w]);
+        in_->unpack(dualBound_[w]);
+        break;
+
+      case IncumbentTag: {
+        double x;
+        in_->unpack(x);
+        if (!master_->betterPrimal(x)) break;
+
+        master_->primalBound(x);
+        bestWorker_ = w;
+        master_->out(1) << "worker " << w << " found primal bound " << x << endl;
+
+        for (int v = 0; v < nWorkers_; v++)
+          if (v != w && !done_[v]) post(v, *in_);
+        break;
+      }
+
+      case CutsTag:
+        for (int v = 0; v < nWorkers_; v++)
+          if (v != w && !done_[v]) post(v, *in_);
+        break;
+
+      case IdleTag:
+        idle_[w]  = true;
+        nOpen_[w] = 0;
+        break;
+
+// pass donated subproblems to the idle worker
+/* If the workers are stopped in the meantime, the subproblems are
+ *   discarded.
+ */
+      case SubsTag: {
+        int    nSubs = in_->unpackInt();
+        double bound;
+        in_->unpack(bound);
+
+        asked_[w] = false;
+
+        int r;
+        for (r = 0; r < nWorkers_; r++)
+          if (donor_[r] == w) break;
+        if (r == nWorkers_) break;
+
+        donor_[r] = -1;
+        if (nSubs == 0 || stopping_ || done_[r]) break;
+
+        post(r, *in_);
+        idle_[r]      = false;
+        nOpen_[r]     = nSubs;
+        dualBound_[r] = bound;
+        break;
+      }
+
+// process the termination of a worker
+/* The statistics of the worker are added to the statistics of the
+ *   coordinator, and the problem specific data is taken from the worker
+ *   which has found the best primal bound. If a worker terminates
+ *   before it has been stopped, e.g., since a resource limit is exceeded,
+ *   all other workers are stopped as well.
+ */
+      case DoneTag: {
+        ABA_MASTER::STATUS status = (ABA_MASTER::STATUS) in_->unpackInt();
+        ABA_MESSAGE        base(master_);
+        bool               hasData;
+
+        base.attach(base_->data(), base_->length());
+        master_->_unpackStatistics(*in_, &base);
+
+        in_->unpack(hasData);
+        if (hasData && w == bestWorker_) master_->unpackCheckpoint(*in_);
+
+        done_[w] = true;
+        idle_[w] = true;
+
+        if (status != ABA_MASTER::Processing) {
+          if (!stopping_) stopAll(status);
+          else if (status == ABA_MASTER::Error) status_ = status;
+        }
+        break;
+      }
+
+      default:
+        master_->err() << "ABA_COORDINATOR::handle(): unknown message ";
+        master_->err() << "from worker " << w << "." << endl;
+        abort(w);
+    }
+  }
+
+  void ABA_COORDINATOR::balance()
+  {
+    if (stopping_) return;
+
+// ask the workers with the best dual bounds to donate
+/* Each idle worker is assigned to a different donor, which is asked
+ *   for half of its open subproblems. The donor is the worker with the
+ *   best dual bound, since its subproblems determine the global dual
+ *   bound, and among workers with equal dual bounds the one with the most
+ *   open subproblems. A worker with less than two open subproblems does
+ *   not donate, since it would become idle itself.
+ */
+    const bool max = master_->optSense()->max();
+
+    for (int r = 0; r < nWorkers_; r++) {
+      if (done_[r] || !idle_[r] || donor_[r] != -1) continue;
+
+      int d = -1;
+      for (int v = 0; v < nWorkers_; v++) {
+        if (done_[v] || idle_[v] || asked_[v] || nOpen_[v] < 2) continue;
+        if (d == -1
+            || (max ? dualBound_[v] > dualBound_[d] : dualBound_[v] < dualBound_[d])
+            || (dualBound_[v] == dualBound_[d] && nOpen_[v] > nOpen_[d]))
+          d = v;
+      }
+
+      if (d == -1) return;
+
+      ABA_MESSAGE msg(master_);
+      msg.pack((int) DonateTag);
+      msg.pack(nOpen_[d]/2);
+      post(d, msg);
+
+      asked_[d]  = true;
+      donor_[r]  = d;
+      nOpen_[d] -= nOpen_[d]/2;
+    }
+  }
+
+  void ABA_COORDINATOR::checkTermination()
+  {
+    if (stopping_) return;
+
+// update the global dual bound
+/* The global dual bound is the minimum (maximum) of the primal bound
+ *   and the dual bounds of the busy workers for a minimization
+ *   (maximization) problem. Subproblems which are sent from one worker
+ *   to another are still contained in the dual bound of the donor.
+ */
+    const bool max     = master_->optSense()->max();
+    double     dual    = master_->primalBound();
+    bool       allIdle = true;
+
+    for (int w = 0; w < nWorkers_; w++) {
+      if (done_[w] || asked_[w]) allIdle = false;
+      if (done_[w] || idle_[w]) continue;
+      allIdle = false;
+      if (max ? dualBound_[w] > dual : dualBound_[w] < dual)
+        dual = dualBound_[w];
+    }
+
+    if (master_->betterDual(dual)) master_->dualBound(dual);
+
+    if (allIdle) {
+      stopAll(ABA_MASTER::Processing);
+      return;
+    }
+
+    if (master_->guaranteed()) {
+      master_->out() << endl;
+      master_->out() << "Guarantee " << master_->requiredGuarantee();
+      master_->out() << " % reached." << endl;
+      master_->out() << "Terminate optimization." << endl;
+      stopAll(ABA_MASTER::Guaranteed);
+    }
+  }
+
+  void ABA_COORDINATOR::stopAll(ABA_MASTER::STATUS status)
+  {
+    stopping_ = true;
+    status_   = status;
+
+    ABA_MESSAGE msg(master_);
+    msg.pack((int) StopTag);
+
+    for (int w = 0; w < nWorkers_; w++)
+      if (!done_[w]) post(w, msg);
+  }
+
+  void ABA_COORDINATOR::post(int w, const ABA_MESSAGE &msg)
+  {
+    queue_[w]->pack(msg.length());
+    queue_[w]->pack(msg);
+    flush(w);
+  }
+
+  void ABA_COORDINATOR::flush(int w)
+  {
+    ABA_MESSAGE *queue = queue_[w];
+
+// write the queue without blocking
+/* If the worker has terminated in the meantime, the queue is discarded.
+ *   Its termination message is still received, or the failure is
+ *   detected when receiving from the closed socket.
+ */
+    while (sent_[w] < queue->length()) {
+      ssize_t n = ::send(fd_[w], queue->data() + sent_[w],
+                         queue->length() - sent_[w], MSG_DONTWAIT | MSG_NOSIGNAL);
+      if (n < 0) {
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) return;
+        break;
+      }
+      sent_[w] += n;
+    }
+
+    queue->clear();
+    sent_[w] = 0;
+  }
+
+  void ABA_COORDINATOR::abort(int w)
+  {
+    master_->err() << "ABA_COORDINATOR: worker " << w << " (process ";
+    master_->err() << pid_[w] << ") terminated unexpectedly." << endl;
+
+    for (int v = 0; v < nWorkers_; v++)
+      if (v != w) kill((pid_t) pid_[v], SIGTERM);
+
+    exit(Fatal);
+  }
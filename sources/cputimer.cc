@@ -61,6 +61,14 @@ long ABA_CPUTIMER::clk_tck_ = sysconf(_SC_CLK_TCK);
   
   long ABA_CPUTIMER::theTime() const
   {
+#if defined(_POSIX_THREAD_CPUTIME) && _POSIX_THREAD_CPUTIME >= 0
+  // compute the time of the calling thread
+  struct timespec cpu;
+
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu) == 0)
+    return (long) cpu.tv_sec*100 + (long) cpu.tv_nsec/10000000;
+#endif
+
   // compute the time for Unix systems
   struct tms now;
  
@@ -29,9 +29,7 @@
 #include "abacus/csense.h"
 #include "abacus/global.h"
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
 
   ABA_CSENSE::ABA_CSENSE(ABA_GLOBAL *glob) 
   :  
@@ -65,8 +63,6 @@
   }
 
 
-#ifdef ABACUS_PARALLEL
-
   ABA_CSENSE::ABA_CSENSE(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
   :  
     glob_(glob)
@@ -79,8 +75,6 @@
     msg.pack((int)sense_);
   }
 
-#endif
-
   ostream &operator<<(ostream &out, const ABA_CSENSE &rhs)
   {
     switch (rhs.sense_) {
@@ -0,0 +1,131 @@
+/*!\file
+ * \author The ABACUS developers
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#include "abacus/diveinfo.h"
+#include "abacus/master.h"
+
+  ABA_DIVEINFO::ABA_DIVEINFO(ABA_MASTER *master)
+  :
+    master_(master),
+    downSum_(master, 1, 0.0),
+    upSum_(master, 1, 0.0),
+    downNum_(master, 1, 0),
+    upNum_(master, 1, 0),
+    incumbent_(master, 1, 0.0),
+    known_(master, 1, false),
+    hasIncumbent_(false)
+  {
+    totalSum_[0] = totalSum_[1] = 0.0;
+    totalNum_[0] = totalNum_[1] = 0;
+  }
+
+  ABA_DIVEINFO::~ABA_DIVEINFO()
+  { }
+
+  void ABA_DIVEINFO::pseudoCost(int index, bool up, double gain)
+  {
+    realloc(index);
+
+    if (up) {
+      upSum_[index] += gain;
+      ++upNum_[index];
+    }
+    else {
+      downSum_[index] += gain;
+      ++downNum_[index];
+    }
+
+    totalSum_[up] += gain;
+    ++totalNum_[up];
+  }
+
+  double ABA_DIVEINFO::pseudoCost(int index, bool up) const
+  {
+    if (index < upNum_.size()) {
+      if (up && upNum_[index])       return upSum_[index]/upNum_[index];
+      if (!up && downNum_[index])    return downSum_[index]/downNum_[index];
+    }
+
+    if (totalNum_[up]) return totalSum_[up]/totalNum_[up];
+    else               return 1.0;
+  }
+
+  void ABA_DIVEINFO::clearIncumbent()
+  {
+    known_.set(false);
+    hasIncumbent_ = false;
+  }
+
+  void ABA_DIVEINFO::incumbent(int index, double x)
+  {
+    realloc(index);
+
+    incumbent_[index] = x;
+    known_[index]     = true;
+    hasIncumbent_     = true;
+  }
+
+  bool ABA_DIVEINFO::incumbent(int index, double &x) const
+  {
+    if (index >= known_.size() || !known_[index]) return false;
+
+    x = incumbent_[index];
+    return true;
+  }
+
+  void ABA_DIVEINFO::realloc(int index)
+  {
+    if (index < upNum_.size()) return;
+
+// enlarge the arrays
+/* The arrays are at least doubled, such that the number of reallocations
+ *   stays logarithmic in the size of the pool of variables.
+ */
+    int newSize = 2*upNum_.size();
+    if (newSize <= index) newSize = index + 1;
+
+    const int oldSize = upNum_.size();
+
+    downSum_.realloc(newSize);
+    upSum_.realloc(newSize);
+    downNum_.realloc(newSize);
+    upNum_.realloc(newSize);
+    incumbent_.realloc(newSize);
+    known_.realloc(newSize);
+
+    for (int i = oldSize; i < newSize; i++) {
+      downSum_[i]   = 0.0;
+      upSum_[i]     = 0.0;
+      downNum_[i]   = 0;
+      upNum_[i]     = 0;
+      incumbent_[i] = 0.0;
+      known_[i]     = false;
+    }
+  }
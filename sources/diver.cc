@@ -0,0 +1,335 @@
+/*!\file
+ * \author The ABACUS developers
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#include "abacus/diver.h"
+#include "abacus/diveinfo.h"
+#include "abacus/sub.h"
+#include "abacus/lpsub.h"
+#include "abacus/variable.h"
+#include "abacus/active.h"
+#include "abacus/poolslot.h"
+#include "abacus/row.h"
+#include "abacus/lpvarstat.h"
+#include "abacus/slackstat.h"
+
+#include <math.h>
+
+  ABA_DIVER::ABA_DIVER(ABA_MASTER *master, ABA_SUB *sub)
+  :
+    master_(master),
+    sub_(sub),
+    lBound_(master, sub->nVar()),
+    uBound_(master, sub->nVar()),
+    x_(master, sub->nVar()),
+    value_(0.0),
+    changed_(master, sub->nVar()),
+    isChanged_(master, sub->nVar(), false),
+    downLock_(master, sub->nVar(), 0),
+    upLock_(master, sub->nVar(), 0)
+  { }
+
+  ABA_DIVER::~ABA_DIVER()
+  { }
+
+  int ABA_DIVER::dive(ABA_MASTER::DIVINGSTRAT strat, double &primalValue)
+  {
+    const int nVariables = sub_->nVar();
+
+    for (int i = 0; i < nVariables; i++) {
+      lBound_[i] = sub_->lBound(i);
+      uBound_[i] = sub_->uBound(i);
+      x_[i]      = sub_->xVal_[i];
+    }
+    value_ = sub_->lp_->value();
+
+    if (strat == ABA_MASTER::CoefficientDiving) locks();
+    if (strat == ABA_MASTER::GuidedDiving && !master_->diveInfo()->hasIncumbent())
+      strat = ABA_MASTER::FractionalDiving;
+
+// dive
+/* If the linear program becomes infeasible or its value exceeds the
+ *   primal bound, the last rounding is reversed, but only once per dive.
+ *   After each successful rounding the pseudocost of the rounded variable
+ *   is updated by the change of the value of the linear program.
+ */
+  int  j;
+  bool up;
+  bool backtracked = false;
+  bool integral    = false;
+  int  found       = 0;
+  int  nRounded    = 0;
+
+  for (;;) {
+    if (select(strat, j, up)) {
+      integral = true;
+      break;
+    }
+
+    const double x        = x_[j];
+    const double lb       = lBound_[j];
+    const double ub       = uBound_[j];
+    const double oldValue = value_;
+
+    round(j, up);
+    ++nRounded;
+
+    if (solve()) {
+      if (backtracked) break;
+      backtracked = true;
+      lBound_[j]  = lb;
+      uBound_[j]  = ub;
+      up          = !up;
+      round(j, up);
+      if (solve()) break;
+    }
+
+    const double dist = up ? ceil(x) - x : x - floor(x);
+    master_->diveInfo()->pseudoCost(index(j), up, fabs(value_ - oldValue)/dist);
+  }
+
+  if (integral && nRounded) found = check();
+
+  if (found) primalValue = value_;
+
+  master_->out() << ABA_MASTER::DIVINGSTRAT_[strat] << " diving: ";
+  master_->out() << nRounded << " variables rounded";
+  if (found) master_->out() << ", feasible solution " << value_;
+  master_->out() << endl;
+
+  restore();
+
+  return found;
+  }
+
+  int ABA_DIVER::select(ABA_MASTER::DIVINGSTRAT strat, int &j, bool &up)
+  {
+    const int          nVariables = sub_->nVar();
+    const double       eps        = master_->machineEps();
+    const ABA_DIVEINFO *info      = master_->diveInfo();
+    int                best       = -1;
+    double             bestScore  = 0.0;
+    bool               bestUp     = false;
+    double             score;
+    bool               u;
+
+// select the variable
+/* The variable with the largest score is selected. For fractional diving
+ *   it is the variable closest to an integer, for coefficient diving the
+ *   one with the fewest rows which might be violated by the rounding, for
+ *   pseudocost diving the one with the largest ratio of the estimated
+ *   changes of the value of the linear program for the two directions,
+ *   and for guided diving the one closest to its value in the best
+ *   feasible solution.
+ */
+    for (int i = 0; i < nVariables; i++) {
+      if (lBound_[i] == uBound_[i] || !sub_->variable(i)->discrete()) continue;
+
+      const double x = x_[i];
+      const double f = x - floor(x);
+
+      if (f < eps || f > 1.0 - eps) continue;
+
+      double inc;
+
+      switch (strat) {
+        case ABA_MASTER::CoefficientDiving:
+          u     = upLock_[i] < downLock_[i]
+                  || (upLock_[i] == downLock_[i] && f > 0.5);
+          score = u ? -(upLock_[i] + 1.0 - f) : -(downLock_[i] + f);
+          break;
+
+        case ABA_MASTER::PseudoCostDiving: {
+          const double down = info->pseudoCost(index(i), false)*f;
+          const double upC  = info->pseudoCost(index(i), true)*(1.0 - f);
+          if      (f < 0.3) u = false;
+          else if (f > 0.7) u = true;
+          else              u = upC < down;
+          score = u ? (down + eps)/(upC + eps) : (upC + eps)/(down + eps);
+          break;
+        }
+
+        case ABA_MASTER::GuidedDiving:
+          if (info->incumbent(index(i), inc)) {
+            u     = inc > x;
+            score = -fabs(inc - x);
+            break;
+          }
+          // no value in the best solution, round to the nearest integer
+
+        default:
+          u     = f > 0.5;
+          score = u ? -(1.0 - f) : -f;
+      }
+
+      if (best == -1 || score > bestScore) {
+        best      = i;
+        bestScore = score;
+        bestUp    = u;
+      }
+    }
+
+    if (best == -1) return 1;
+
+    j  = best;
+    up = bestUp;
+    return 0;
+  }
+
+  void ABA_DIVER::locks()
+  {
+    ABA_LPSUB *lp  = sub_->lp_;
+    const int nRow = lp->nRow();
+    ABA_ROW   row(master_, lp->nCol() > 0 ? lp->nCol() : 1);
+
+// count the locks
+/* Rounding a variable up might violate a \f$\le\f$-constraint with a positive
+ *   and a \f$\ge\f$-constraint with a negative coefficient of the variable,
+ *   and analogously for rounding down. Equations are violated in both
+ *   directions.
+ */
+    for (int r = 0; r < nRow; r++) {
+      lp->row(r, row);
+
+      ABA_CSENSE::SENSE sense  = row.sense()->sense();
+      const int         rowNnz = row.nnz();
+
+      for (int k = 0; k < rowNnz; k++) {
+        const int    i = lp->lp2orig_[row.support(k)];
+        const double a = row.coeff(k);
+
+        if (a > 0.0) {
+          if (sense != ABA_CSENSE::Greater) ++upLock_[i];
+          if (sense != ABA_CSENSE::Less)    ++downLock_[i];
+        }
+        else {
+          if (sense != ABA_CSENSE::Less)    ++upLock_[i];
+          if (sense != ABA_CSENSE::Greater) ++downLock_[i];
+        }
+      }
+    }
+  }
+
+  void ABA_DIVER::round(int j, bool up)
+  {
+    if (up) lBound_[j] = ceil(x_[j]);
+    else    uBound_[j] = floor(x_[j]);
+
+    sub_->lp_->changeLBound(j, lBound_[j]);
+    sub_->lp_->changeUBound(j, uBound_[j]);
+
+    if (!isChanged_[j]) {
+      isChanged_[j] = true;
+      changed_.push(j);
+    }
+  }
+
+  int ABA_DIVER::solve()
+  {
+    ABA_LPSUB *lp = sub_->lp_;
+
+    master_->countLp();
+    lp->setObjectiveLimit(sub_->objectiveLimit());
+
+    if (lp->optimize(ABA_LP::Dual) != ABA_LP::Optimal) return 1;
+
+    const int nVariables = sub_->nVar();
+
+    for (int i = 0; i < nVariables; i++)
+      x_[i] = lp->xVal(i);
+    value_ = lp->value();
+
+    return 0;
+  }
+
+  int ABA_DIVER::check()
+  {
+    const int nVariables = sub_->nVar();
+
+// test the solution with the function \a feasible()
+/* The function \a feasible() tests the solution stored in \a xVal_,
+ *   hence the solution of the subproblem is replaced temporarily by the
+ *   solution of the dive. If the solution is a new best one, its values
+ *   are stored for guided diving.
+ */
+    ABA_ARRAY<double> xVal(master_, nVariables);
+
+    for (int i = 0; i < nVariables; i++) {
+      xVal[i]          = sub_->xVal_[i];
+      sub_->xVal_[i]   = x_[i];
+    }
+
+    int found = sub_->feasible() ? 1 : 0;
+
+    if (found) sub_->storeIncumbent(value_);
+
+    for (int i = 0; i < nVariables; i++)
+      sub_->xVal_[i] = xVal[i];
+
+    return found;
+  }
+
+  void ABA_DIVER::restore()
+  {
+    ABA_LPSUB *lp = sub_->lp_;
+
+// restore the linear program of the subproblem
+/* The bounds and the final basis of the subproblem are restored. The linear
+ *   program is solved again without objective limit, such that the solution
+ *   of the linear program is available as before the dive.
+ */
+    sub_->updateBoundInLp(changed_);
+
+    const int nVariables   = sub_->nVar();
+    const int nConstraints = sub_->nCon();
+
+    ABA_ARRAY<ABA_LPVARSTAT::STATUS> vStat(master_, nVariables);
+    ABA_ARRAY<ABA_SLACKSTAT::STATUS> sStat(master_, nConstraints > 0 ? nConstraints : 1);
+
+    for (int i = 0; i < nVariables; i++)
+      vStat[i] = sub_->lpVarStat(i)->status();
+    for (int c = 0; c < nConstraints; c++)
+      sStat[c] = sub_->slackStat(c)->status();
+
+    lp->loadBasis(vStat, sStat);
+
+    if (master_->optSense()->max()) lp->setObjectiveLimit(-master_->infinity());
+    else                            lp->setObjectiveLimit(master_->infinity());
+
+    if (lp->optimize(ABA_LP::Dual) != ABA_LP::Optimal) {
+      master_->err() << "ABA_DIVER::restore(): the linear program of the ";
+      master_->err() << "subproblem cannot be solved again." << endl;
+      exit(Fatal);
+    }
+  }
+
+  int ABA_DIVER::index(int j) const
+  {
+    return sub_->actVar_->poolSlotRef(j)->slot()->index();
+  }
@@ -42,7 +42,10 @@
     master_(master),  
     candidates_(0),  
     fsVarStat_(0),  
-    lhs_(0)
+    lhs_(0),  
+    reco_(0),  
+    bound_(0),  
+    value_(0.0)
   { }
 
   ABA_FIXCAND::~ABA_FIXCAND()
@@ -76,6 +79,8 @@
  */
   ABA_LPSUB *lp = sub->lp();  
 
+  value_ = lp->value();
+
 #ifdef ABACUS_NO_FOR_SCOPE
   for (i = 0; i < nVar; i++)
 #else
@@ -86,13 +91,17 @@
            new ABA_POOLSLOTREF<ABA_VARIABLE, 
                               ABA_CONSTRAINT>(*(sub->actVar()->poolSlotRef(i))));
       
+      reco_->push(fabs(lp->reco(i)));
+
       if (sub->lpVarStat(i)->status() == ABA_LPVARSTAT::AtLowerBound) {
         lhs_->push(lp->value() + lp->reco(i));
+        bound_->push(sub->lBound(i));
         fsVarStat_->push(new ABA_FSVARSTAT(master_, 
                                                ABA_FSVARSTAT::FixedToLowerBound));
       }
       else {
         lhs_->push(lp->value() - lp->reco(i));
+        bound_->push(sub->uBound(i));
         fsVarStat_->push(new ABA_FSVARSTAT(master_, 
                                                ABA_FSVARSTAT::FixedToUpperBound));
       }
@@ -111,6 +120,7 @@
 
     ABA_BUFFER<int> fixed(master_, nCandidates);  // fixed variables
     ABA_VARIABLE    *v;                                // variable being fixed
+    int              nTightened = 0;                   // tightened bounds
 
     for (int i = 0; i < nCandidates; i++)
       if ((master_->optSense()->max() && 
@@ -153,6 +163,7 @@
           fixed.push(i);
   }
   }
+      else if (master_->feasibleFound() && tighten(i)) ++nTightened;
 // remove fixed candidates
 /* We delete allocated memory of \a fsVarStat_ for the fixed variables
  *  und remove the fixed variables from the three buffers.
@@ -171,8 +182,50 @@
   candidates_->leftShift(fixed);
   fsVarStat_->leftShift(fixed);
   lhs_->leftShift(fixed);
+  reco_->leftShift(fixed);
+  bound_->leftShift(fixed);
+
+    master_->out(1) << fixed.number() << " variables fixed, ";
+    master_->out()  << nTightened << " bounds tightened" << endl;
+  }
+
+  bool ABA_FIXCAND::tighten(int i)
+  {
+    ABA_VARIABLE *v = (ABA_VARIABLE *) (*candidates_)[i]->conVar();
+
+    if (v == 0 || v->binary() || v->fsVarStat()->fixed()) return false;
+    if ((*reco_)[i] < master_->machineEps()) return false;
+
+// compute the number of units the candidate can leave its bound
+/* The value of the linear program deteriorates by the reduced cost for
+ *  each unit. As for the fixing a deterioration up to \a master_->eps()
+ *  beyond the primal bound is allowed.
+ */
+  double gap;
 
-    master_->out(1) << fixed.number() << " variables fixed" << endl;
+  if (master_->optSense()->max())
+    gap = value_ - master_->primalBound() + master_->eps();
+  else
+    gap = master_->primalBound() - value_ + master_->eps();
+
+  const double units = floor(gap/(*reco_)[i]);
+
+  if ((*fsVarStat_)[i]->status() == ABA_FSVARSTAT::FixedToLowerBound) {
+    const double newBound = (*bound_)[i] + units;
+    if (newBound < v->uBound() - master_->eps()) {
+      v->uBound(newBound);
+      return true;
+    }
+  }
+  else {
+    const double newBound = (*bound_)[i] - units;
+    if (newBound > v->lBound() + master_->eps()) {
+      v->lBound(newBound);
+      return true;
+    }
+  }
+
+  return false;
 
   }
 
@@ -199,6 +252,11 @@
       delete lhs_;
       lhs_ = 0;
     }
+
+    delete reco_;
+    reco_ = 0;
+    delete bound_;
+    bound_ = 0;
   }
 
   void ABA_FIXCAND::allocate(int nCand)
@@ -207,5 +265,7 @@
                                                 ABA_CONSTRAINT>*>(master_, nCand);
     fsVarStat_  = new ABA_BUFFER<ABA_FSVARSTAT*>(master_, nCand);
     lhs_        = new ABA_BUFFER<double>(master_, nCand);
+    reco_       = new ABA_BUFFER<double>(master_, nCand);
+    bound_      = new ABA_BUFFER<double>(master_, nCand);
   }
   
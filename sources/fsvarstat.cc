@@ -29,9 +29,7 @@
 #include "abacus/global.h"
 #include "abacus/fsvarstat.h"
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
 
   ABA_FSVARSTAT::ABA_FSVARSTAT(ABA_GLOBAL *glob, STATUS status) 
    :  
@@ -66,9 +64,7 @@
   {
   }
 
-#ifdef ABACUS_PARALLEL
-
-  ABA_FSVARSTAT::ABA_FSVARSTAT(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+  ABA_FSVARSTAT::ABA_FSVARSTAT(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
     :  
     glob_(glob)
   {
@@ -82,8 +78,6 @@
     msg.pack(value_);
   }
 
-#endif
-
   ostream &operator<<(ostream& out, const ABA_FSVARSTAT &rhs)
   {
     switch (rhs.status_) {
@@ -0,0 +1,211 @@
+/*!\file
+ * \author The ABACUS developers
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#include "abacus/heurserver.h"
+#include "abacus/master.h"
+#include "abacus/sub.h"
+#include "abacus/lpsolution.h"
+
+  ABA_HEURSERVER::ABA_HEURSERVER(ABA_MASTER *master, int nThreads,
+                                 int queueSize)
+  :
+    master_(master),
+    queue_(master, queueSize < 1 ? 1 : queueSize),
+    first_(0),
+    nQueue_(0),
+    processed_(master, (queueSize < 1 ? 1 : queueSize) + nThreads),
+    found_(false),
+    primalValue_(0.0),
+    done_(false),
+    thread_(master, nThreads < 1 ? 1 : nThreads),
+    nRunning_(0)
+  {
+// start the heuristic threads
+/* If no thread can be started, the solutions are processed
+ *   synchronously in \a post().
+ */
+    pthread_mutex_init(&mutex_, 0);
+    pthread_cond_init(&cond_, 0);
+
+    for (int t = 0; t < nThreads; t++) {
+      if (pthread_create(&thread_[nRunning_], 0, heuristic, this)) break;
+      ++nRunning_;
+    }
+
+    if (nRunning_ < nThreads) {
+      master_->err() << "WARNING: ABA_HEURSERVER::ABA_HEURSERVER(): ";
+      master_->err() << "only " << nRunning_ << " of " << nThreads;
+      master_->err() << " heuristic threads started";
+      if (!nRunning_) master_->err() << ", applying heuristics synchronously";
+      master_->err() << "." << endl;
+    }
+  }
+
+  ABA_HEURSERVER::~ABA_HEURSERVER()
+  {
+    stop();
+
+    pthread_cond_destroy(&cond_);
+    pthread_mutex_destroy(&mutex_);
+
+    deleteProcessed();
+  }
+
+  void ABA_HEURSERVER::stop()
+  {
+    pthread_mutex_lock(&mutex_);
+    done_ = true;
+    pthread_cond_broadcast(&cond_);
+    pthread_mutex_unlock(&mutex_);
+
+    for (int t = 0; t < nRunning_; t++)
+      pthread_join(thread_[t], 0);
+    nRunning_ = 0;
+
+    for (int i = 0; i < nQueue_; i++)
+      delete queue_[(first_ + i) % queue_.size()];
+    nQueue_ = 0;
+  }
+
+  void ABA_HEURSERVER::post(ABA_SUB *sub)
+  {
+    ABA_LPSOLUTION<ABA_VARIABLE, ABA_CONSTRAINT> *lpSolution
+      = new ABA_LPSOLUTION<ABA_VARIABLE, ABA_CONSTRAINT>(sub, true,
+                                                         sub->actVar());
+
+    if (!nRunning_) {
+      double primalValue;
+      if (master_->asyncImprove(lpSolution, primalValue)) found(primalValue);
+      delete lpSolution;
+      return;
+    }
+
+// append the solution to the queue
+/* If the queue is full, the oldest solution is replaced. As it has not
+ *   been taken by a heuristic thread yet, it can be deleted at once.
+ *   The processed solutions are deleted as well, such that there are never
+ *   more of them than solutions in the queue and heuristic threads.
+ */
+    ABA_LPSOLUTION<ABA_VARIABLE, ABA_CONSTRAINT> *discarded = 0;
+
+    pthread_mutex_lock(&mutex_);
+
+    deleteProcessed();
+
+    if (nQueue_ == queue_.size()) {
+      discarded = queue_[first_];
+      first_    = (first_ + 1) % queue_.size();
+      --nQueue_;
+    }
+
+    queue_[(first_ + nQueue_) % queue_.size()] = lpSolution;
+    ++nQueue_;
+
+    pthread_cond_signal(&cond_);
+    pthread_mutex_unlock(&mutex_);
+
+    delete discarded;
+  }
+
+  int ABA_HEURSERVER::harvest(double &primalValue)
+  {
+    int status = 0;
+
+    pthread_mutex_lock(&mutex_);
+
+    if (found_) {
+      primalValue = primalValue_;
+      found_      = false;
+      status      = 1;
+    }
+
+    deleteProcessed();
+
+    pthread_mutex_unlock(&mutex_);
+
+    return status;
+  }
+
+  void ABA_HEURSERVER::deleteProcessed()
+  {
+    const int nProcessed = processed_.number();
+
+    for (int i = 0; i < nProcessed; i++)
+      delete processed_[i];
+    processed_.clear();
+  }
+
+  void ABA_HEURSERVER::found(double primalValue)
+  {
+    if (!found_) primalValue_ = primalValue;
+    else if (master_->optSense()->max()) {
+      if (primalValue > primalValue_) primalValue_ = primalValue;
+    }
+    else if (primalValue < primalValue_) primalValue_ = primalValue;
+
+    found_ = true;
+  }
+
+  void *ABA_HEURSERVER::heuristic(void *heurServer)
+  {
+    ABA_HEURSERVER *server = (ABA_HEURSERVER*) heurServer;
+    ABA_LPSOLUTION<ABA_VARIABLE, ABA_CONSTRAINT> *lpSolution;
+    double primalValue;
+    int    status;
+
+// process the solutions of the queue
+/* A solution taken from the queue is not touched by \a post(), hence the
+ *   heuristic is applied without holding the mutex. Afterwards the solution
+ *   is passed to \a harvest() for deletion.
+ */
+    pthread_mutex_lock(&server->mutex_);
+    for (;;) {
+      while (!server->nQueue_ && !server->done_)
+        pthread_cond_wait(&server->cond_, &server->mutex_);
+
+      if (server->done_) break;
+
+      lpSolution     = server->queue_[server->first_];
+      server->first_ = (server->first_ + 1) % server->queue_.size();
+      --server->nQueue_;
+
+      pthread_mutex_unlock(&server->mutex_);
+
+      status = server->master_->asyncImprove(lpSolution, primalValue);
+
+      pthread_mutex_lock(&server->mutex_);
+
+      if (status) server->found(primalValue);
+      server->processed_.push(lpSolution);
+    }
+    pthread_mutex_unlock(&server->mutex_);
+
+    return 0;
+  }
@@ -34,6 +34,9 @@
 #include "abacus/lpvarstat.h"
 #include "abacus/slackstat.h"
 
+const char *ABA_LP::METHOD_[]={"Primal","Dual","BarrierAndCrossover",
+"BarrierNoCrossover","Approximate","Race"};
+
 ABA_LP::ABA_LP(ABA_MASTER*master)
 
 :
@@ -113,6 +116,8 @@ case BarrierNoCrossover:optStat_= _barrier(false);
 break;
 case Approximate:optStat_= _approx();
 break;
+case Race:optStat_= _race();
+break;
 }
 
 return optStat_;
@@ -210,6 +215,33 @@ initPostOpt();
 _changeUBound(i,newUb);
 }
 
+void ABA_LP::changeBounds(ABA_BUFFER<int> &ind, ABA_BUFFER<double> &lb,
+                          ABA_BUFFER<double> &ub)
+
+{
+#ifdef ABACUSSAFE
+for (int i = 0; i < ind.number(); i++) colRangeCheck(ind[i]);
+#endif
+
+if (ind.empty()) return;
+
+initPostOpt();
+
+_changeBounds(ind, lb, ub);
+}
+
+void ABA_LP::_changeBounds(ABA_BUFFER<int> &ind, ABA_BUFFER<double> &lb,
+                           ABA_BUFFER<double> &ub)
+
+{
+const int n = ind.number();
+
+for (int i = 0; i < n; i++) {
+  _changeLBound(ind[i], lb[i]);
+  _changeUBound(ind[i], ub[i]);
+}
+}
+
 int ABA_LP::pivotSlackVariableIn(ABA_BUFFER<int> &rows)
 
 {
@@ -467,3 +499,57 @@ int ABA_LP::getSimplexIterationLimit(int&limit)
 {
 return _getSimplexIterationLimit(limit);
 }
+
+int ABA_LP::setObjectiveLimit(double limit)
+
+{
+return _setObjectiveLimit(limit);
+}
+
+int ABA_LP::_setObjectiveLimit(double limit)
+
+{
+return 1;
+}
+
+int ABA_LP::getDualRay(double *ray)
+
+{
+return _getDualRay(ray);
+}
+
+int ABA_LP::_getDualRay(double *ray)
+
+{
+return 1;
+}
+
+int ABA_LP::nIterations()
+
+{
+return _nIterations();
+}
+
+bool ABA_LP::barrierAvailable()
+
+{
+return _barrierAvailable();
+}
+
+ABA_LP::OPTSTAT ABA_LP::_race()
+
+{
+return _primalSimplex();
+}
+
+int ABA_LP::_nIterations()
+
+{
+return 0;
+}
+
+bool ABA_LP::_barrierAvailable()
+
+{
+return true;
+}
@@ -0,0 +1,139 @@
+/*!\file
+ * \author The ABACUS developers
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#include "abacus/lpmethodstat.h"
+#include "abacus/master.h"
+
+#include <iomanip>
+
+  const char *ABA_LPMETHODSTAT::SITUATION_[]={"RootLp","FirstLp","ConAdded",
+                                               "VarAdded","OtherLp","None"};
+
+  ABA_LPMETHODSTAT::ABA_LPMETHODSTAT(ABA_MASTER *master)
+  :
+    master_(master)
+  {
+    for (int s = 0; s < nSituations; s++)
+      for (int m = 0; m < nMethods; m++) {
+        nSolved_[s][m]      = 0;
+        centiSeconds_[s][m] = 0;
+        nIterations_[s][m]  = 0;
+      }
+  }
+
+  ABA_LPMETHODSTAT::~ABA_LPMETHODSTAT()
+  { }
+
+  ostream &operator<<(ostream &out, const ABA_LPMETHODSTAT &rhs)
+  {
+    const int w1 = 10;  //!< width of the column of the situation
+    const int w2 = 22;  //!< width of the column of the method
+    const int w  = 12;  //!< width of the other columns
+
+    out << "LP-Method Statistics" << endl << endl;
+    out << setw(w1) << "Situation" << setw(w2) << "Method";
+    out << setw(w) << "#LPs" << setw(w) << "Avg. Time";
+    out << setw(w) << "Avg. Iter." << endl;
+
+    for (int s = 0; s < ABA_LPMETHODSTAT::nSituations; s++)
+      for (int m = 0; m < ABA_LPMETHODSTAT::nMethods; m++)
+        if (rhs.nSolved_[s][m]) {
+          out << setw(w1) << ABA_LPMETHODSTAT::SITUATION_[s];
+          out << setw(w2) << ABA_LP::METHOD_[m];
+          out << setw(w)  << rhs.nSolved_[s][m];
+          out << setw(w)  << rhs.avgTime(s, m)/100.0;
+          out << setw(w)  << rhs.avgIterations(s, m) << endl;
+        }
+
+    return out;
+  }
+
+  void ABA_LPMETHODSTAT::record(SITUATION situation, ABA_LP::METHOD method,
+                                long centiSeconds, int nIterations)
+  {
+    if (situation == NoSituation) return;
+
+    ++nSolved_[situation][method];
+    centiSeconds_[situation][method] += centiSeconds;
+    nIterations_[situation][method]  += nIterations;
+  }
+
+  ABA_LP::METHOD ABA_LPMETHODSTAT::choose(SITUATION situation,
+                                          ABA_LP::METHOD preferred,
+                                          bool barrier) const
+  {
+    if (situation == NoSituation) return preferred;
+
+    const int trials = master_->lpMethodTrials();
+
+    ABA_LP::METHOD candidate[4];
+    int            nCandidates = 0;
+
+// collect the candidates
+/* The preferred method is the first candidate, such that it is tried
+ *   first and wins ties.
+ */
+    candidate[nCandidates++] = preferred;
+    if (preferred != ABA_LP::Primal) candidate[nCandidates++] = ABA_LP::Primal;
+    if (preferred != ABA_LP::Dual)   candidate[nCandidates++] = ABA_LP::Dual;
+    if (barrier && preferred != ABA_LP::BarrierAndCrossover)
+      candidate[nCandidates++] = ABA_LP::BarrierAndCrossover;
+
+// try each candidate \a trials times
+    for (int c = 0; c < nCandidates; c++)
+      if (nSolved_[situation][candidate[c]] < trials) return candidate[c];
+
+// choose the fastest candidate
+    ABA_LP::METHOD best = candidate[0];
+
+    for (int c = 1; c < nCandidates; c++) {
+      const double time     = avgTime(situation, candidate[c]);
+      const double bestTime = avgTime(situation, best);
+
+      if (time < bestTime ||
+          (time == bestTime &&
+           avgIterations(situation, candidate[c]) < avgIterations(situation, best)))
+        best = candidate[c];
+    }
+
+    return best;
+  }
+
+  double ABA_LPMETHODSTAT::avgTime(int situation, int method) const
+  {
+    if (!nSolved_[situation][method]) return 0.0;
+    return (double) centiSeconds_[situation][method]/nSolved_[situation][method];
+  }
+
+  double ABA_LPMETHODSTAT::avgIterations(int situation, int method) const
+  {
+    if (!nSolved_[situation][method]) return 0.0;
+    return (double) nIterations_[situation][method]/nSolved_[situation][method];
+  }
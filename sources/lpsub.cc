@@ -65,24 +65,22 @@
     ABA_ARRAY<ABA_SLACKSTAT::STATUS> slackStat(master_, sub_->nCon());
 
     ABA_ROW   row(master_, sub_->nVar());                //!< buffer to store generated row
-    int         conNnz;                          //!< number of nonzeros of constraint \a c
     int         c;                               //!< loop index
 
     // generate the row format of the active constraints
     /* After the generation of the row format we allocate a row of
-     *   the correct length and make a copy in order to safe memory.
+     *   the correct length and make a copy in order to safe memory,
+     *   unless the row is dense enough to be transferred (see \a extractRow()).
      */  
     int nRow = 0;
 
     const int nCon = sub_->nCon();
   
     for (c = 0; c < nCon; c++) {
-      conNnz  = sub_->constraint(c)->genRow(sub_->actVar(), row);
-      rows[nRow] = new ABA_ROW(master_, conNnz);
-      rows[nRow]->copy(row);
+      sub_->constraint(c)->genRow(sub_->actVar(), row);
+      rows[nRow] = extractRow(row);
       slackStat[nRow] = sub_->slackStat(c)->status();
       ++nRow;
-      row.clear();
     }
 
     // eliminate set and fixed variables and initialize the columns
@@ -197,19 +195,33 @@
   void ABA_LPSUB::constraint2row(ABA_BUFFER<ABA_CONSTRAINT*> &cons,
                                  ABA_BUFFER<ABA_ROW*> &rows)
   {                              
-    int   conNnz;                      //!< number of nonzero elements in constraint
     ABA_ROW   rowBuf(master_, sub_->nVar());  //!< dummy to generate row
-    ABA_ROW  *row;                         //!< pointer to the new row
 
     const int nCons = cons.number();
     
     for (int c = 0; c < nCons; c++) {
-      conNnz = cons[c]->genRow(sub_->actVar(), rowBuf);
-      row = new ABA_ROW(master_, conNnz);
+      cons[c]->genRow(sub_->actVar(), rowBuf);
+      rows.push(extractRow(rowBuf));
+    }
+  }
+
+  ABA_ROW *ABA_LPSUB::extractRow(ABA_ROW &rowBuf)
+  {
+    const int bufSize = rowBuf.size();
+    ABA_ROW  *row;
+
+    if (2*rowBuf.nnz() >= bufSize) {
+      row = new ABA_ROW(master_, 0);
+      row->swap(rowBuf);
+      rowBuf.reserve(bufSize);
+    }
+    else {
+      row = new ABA_ROW(master_, rowBuf.nnz());
       row->copy(rowBuf);
-      rows.push(row);
       rowBuf.clear();
     }
+
+    return row;
   }
 
   bool ABA_LPSUB::eliminable(int i) const
@@ -639,6 +651,26 @@
      else ABA_LP::changeUBound(lpVar, newUb);
    }
 
+   void ABA_LPSUB::changeBounds(ABA_BUFFER<int> &ind, ABA_BUFFER<double> &lb,
+                                ABA_BUFFER<double> &ub)
+   {
+     const int n = ind.number();
+     ABA_BUFFER<int> lpInd(master_, n > 0 ? n : 1);
+
+     for (int i = 0; i < n; i++) {
+       int lpVar = orig2lp_[ind[i]];
+
+       if (lpVar == -1) {
+         master_->err() << "ABA_LPSUB::changeBounds(): variable " << ind[i];
+         master_->err() << " is eliminated, cannot change bounds!" << endl;
+         exit (Fatal);
+       }
+       lpInd.push(lpVar);
+     }
+
+     ABA_LP::changeBounds(lpInd, lb, ub);
+   }
+
   double ABA_LPSUB::lBound(int i) const
   {
     int lpVar = orig2lp_[i];
@@ -733,6 +765,6 @@
   void ABA_LPSUB::conRealloc(int newSize)
   {
     ABA_LP::rowRealloc(newSize);
-    infeasCons_.realloc(newSize);
+    infeasCons_.reserve(newSize);
   }
 
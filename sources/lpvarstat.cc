@@ -29,13 +29,9 @@
 #include "abacus/lpvarstat.h"
 #include "abacus/global.h"
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
 
-#ifdef ABACUS_PARALLEL
-
-  ABA_LPVARSTAT::ABA_LPVARSTAT(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+  ABA_LPVARSTAT::ABA_LPVARSTAT(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
     :  
     glob_(glob)
   {
@@ -47,8 +43,6 @@
     msg.pack((int)status_);
   }
 
-#endif
-
   ostream &operator<<(ostream& out, const ABA_LPVARSTAT &rhs)
   {
     switch (rhs.status_) {
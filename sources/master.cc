@@ -36,11 +36,18 @@
 #include "abacus/history.h"
 #include "abacus/opensub.h"
 #include "abacus/fixcand.h"
+#include "abacus/diveinfo.h"
+#include "abacus/heurserver.h"
+#include "abacus/lpmethodstat.h"
+#include "abacus/sepstat.h"
 #include "abacus/setbranchrule.h"
 #include "abacus/standardpool.h"
-
-#ifdef ABACUS_PARALLEL
-#include "abacus/parmaster.h"
+#include "abacus/treelog.h"
+#include "abacus/checkpoint.h"
+#include "abacus/spillfile.h"
+#include "abacus/worker.h"
+#include "abacus/coordinator.h"
+#include "abacus/sorter.h"
 #include "abacus/valbranchrule.h"
 #include "abacus/boundbranchrule.h"
 #include "abacus/conbranchrule.h"
@@ -49,6 +56,10 @@
 #include "abacus/srowcon.h"
 #include "abacus/numvar.h"
 #include "abacus/colvar.h"
+#include "abacus/conflictcon.h"
+
+#ifdef ABACUS_PARALLEL
+#include "abacus/parmaster.h"
 #include "abacus/subserver.h"
 #include "abacus/notifyserver.h"
 #include "abacus/notification.h"
@@ -62,6 +73,8 @@
 
 extern "C" {
 #include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
 }
 
 const char* ABA_MASTER::STATUS_[]={"Optimal", "Error", "OutOfMemory", "Unprocessed", "Processing",
@@ -74,9 +87,12 @@ const char * ABA_MASTER::ENUMSTRAT_[]={"BestFirst","BreadthFirst",
 const char * ABA_MASTER::BRANCHINGSTRAT_[]={"CloseHalf","CloseHalfExpensive"};
 const char* ABA_MASTER::PRIMALBOUNDMODE_[]={"None","Optimum","OptimumOne"};
 const char* ABA_MASTER::SKIPPINGMODE_[]={"SkipByNode","SkipByLevel"};
+const char* ABA_MASTER::DIVINGSTRAT_[]={"Fractional","Coefficient","PseudoCost",
+                                       "Guided","Rotating"};
+const char* ABA_MASTER::LPMETHODSEL_[]={"Fixed","Adaptive"};
 const char* ABA_MASTER::CONELIMMODE_[]={"None","NonBinding","Basic"};
 const char* ABA_MASTER::VARELIMMODE_[]={"None","ReducedCost"};
-const char* ABA_MASTER::VBCMODE_[]={"None","File","Pipe"};
+const char* ABA_MASTER::VBCMODE_[]={"None","File","Pipe","Binary"};
 
 // Possible values for the defaultLpSolver_ parameter
 const char* ABA_MASTER::OSISOLVER_[]={"Cbc","Clp","CPLEX","DyLP","FortMP",\
@@ -105,13 +121,29 @@ ABA_GLOBAL(eps, machineEps, infinity),
    conPool_(0),  
    cutPool_(0),  
    varPool_(0),  
+   conPools_(0),
+   zeroScratch_(0),
    fixCand_(0),  
+   diveInfo_(0),  
    cutting_(cutting),  
    pricing_(pricing),  
    solveApprox_(false),
    nSubSelected_(0),  
    VbcLog_(NoVbc),  
    treeStream_(0),  
+   treeLog_(0),  
+   vbcBufferSize_(1048576),  
+   checkpoint_(0),  
+   checkpointInterval_(0),  
+   checkpointFile_(this),  
+   checkpointRestart_(false),  
+   spillMemory_(0),  
+   spillFile_(0),  
+   workers_(0),  
+   workerRampUp_(2),  
+   worker_(0),  
+   coordinator_(0),  
+   packByValue_(false),  
    requiredGuarantee_(0.0),  
    maxLevel_(INT_MAX),  
    maxCpuTime_(this, "999999:59:59"),  
@@ -128,6 +160,23 @@ ABA_GLOBAL(eps, machineEps, infinity),
    skipFactor_(1),  
    skippingMode_(SkipByNode),  
    fixSetByRedCost_(true),  
+   boundPropagation_(true),  
+   objectiveCutoff_(true),  
+   conflictAnalysis_(true),  
+   maxConflictSize_(20),  
+   divingFrequency_(10),  
+   divingStrategy_(RotatingDiving),  
+   heuristicThreads_(0),  
+   heuristicQueueSize_(4),  
+   heurServer_(0),  
+   lpMethodSelection_(FixedLpMethod),  
+   lpMethodTrials_(3),  
+   lpRace_(false),  
+   rootRestart_(0.0),  
+   restartRoot_(false),  
+   adaptiveCutting_(0.0),  
+   lpMethodStat_(0),  
+   sepStat_(0),  
    printLP_(false),  
    maxConAdd_(100),  
    maxConBuffered_(100),  
@@ -161,13 +210,17 @@ ABA_GLOBAL(eps, machineEps, infinity),
    nRemCons_(0),  
    nAddVars_(0),  
    nRemVars_(0),  
-   nNewRoot_(0)
+   nNewRoot_(0),
+   nRootRestarts_(0)
 {
    _createLpMasters();
    // ABA_MASTER::ABA_MASTER(): allocate some members 
    history_ = new ABA_HISTORY(this);
    openSub_ = new ABA_OPENSUB(this);
    fixCand_ = new ABA_FIXCAND(this);
+   diveInfo_ = new ABA_DIVEINFO(this);
+   lpMethodStat_ = new ABA_LPMETHODSTAT(this);
+   sepStat_ = new ABA_SEPSTAT(this);
 
 #ifdef ABACUS_PARALLEL
    parmaster_ = new ABA_PARMASTER(this);
@@ -192,20 +245,28 @@ ABA_MASTER::~ABA_MASTER()
    delete parmaster_;
 #endif
    if (treeStream_ != &cout) delete treeStream_;
+   delete treeLog_;
+   delete checkpoint_;
+   delete heurServer_;
+   delete spillFile_;
+   delete coordinator_;
    delete history_;
    delete conPool_;
    delete cutPool_;
    delete varPool_;
+   delete conPools_;
+   delete zeroScratch_;
    delete openSub_;
    delete fixCand_;
+   delete diveInfo_;
+   delete lpMethodStat_;
+   delete sepStat_;
    _deleteLpMasters();
 }
 
 
 
-#ifdef ABACUS_PARALLEL
-
-ABA_CONVAR *ABA_MASTER::unpackConVar(ABA_MESSAGE &msg, int classId) const
+ABA_CONVAR *ABA_MASTER::unpackConVar(ABA_MESSAGE &msg, int classId)
 {
    switch (classId) {
       case NUMCON_CLASSID:
@@ -218,6 +279,8 @@ ABA_CONVAR *ABA_MASTER::unpackConVar(ABA_MESSAGE &msg, int classId) const
 	 return new ABA_NUMVAR(this, msg);
       case COLVAR_CLASSID:
 	 return new ABA_COLVAR(this, msg);
+      case CONFLICTCON_CLASSID:
+	 return new ABA_CONFLICTCON(this, msg);
    }
    err() << "ABA_MASTER::unpackConVar() : cannot unpack subclass of"
 					  << " ABA_CONVAR with classId = " << classId << "." << endl;
@@ -225,7 +288,7 @@ ABA_CONVAR *ABA_MASTER::unpackConVar(ABA_MESSAGE &msg, int classId) const
    return 0;           //!< to suppress compiler warning
 }
 
-ABA_BRANCHRULE *ABA_MASTER::unpackBranchrule(ABA_MESSAGE &msg, int classId) const
+ABA_BRANCHRULE *ABA_MASTER::unpackBranchrule(ABA_MESSAGE &msg, int classId)
 {
    switch (classId) {
       case SETBRANCHRULE_CLASSID:
@@ -243,7 +306,445 @@ ABA_BRANCHRULE *ABA_MASTER::unpackBranchrule(ABA_MESSAGE &msg, int classId) cons
    return 0;           //!< to suppress compiler warning
 }
 
+#ifndef ABACUS_PARALLEL
+
+ABA_SUB *ABA_MASTER::unpackSub(ABA_MESSAGE &msg)
+{
+   err() << "ABA_MASTER::unpackSub(): not redefined in the derived class, ";
+   err() << "subproblems cannot be restored from a checkpoint." << endl;
+   exit(Fatal);
+   return 0;           //!< to suppress compiler warning
+}
+
+void ABA_MASTER::packCheckpoint(ABA_MESSAGE &msg) const
+{ }
+
+void ABA_MASTER::unpackCheckpoint(ABA_MESSAGE &msg)
+{ }
+
+#endif
+
+void ABA_MASTER::_finalCheckpoint()
+{
+#ifndef ABACUS_PARALLEL
+   if (checkpointInterval_ && !openSub_->empty())
+      checkpoint_->write();
+#endif
+}
+
+void ABA_MASTER::_fathomTree()
+{
+   root_->fathomTheSubTree();
+
+#ifndef ABACUS_PARALLEL
+   // fathom the subtrees of subproblems received from other workers 
+   ABA_SUB *sub;
+
+   while (!openSub_->list_.firstElem(sub)) {
+      while (sub->father_) sub = sub->father_;
+      sub->fathomTheSubTree();
+   }
 #endif
+}
+
+void ABA_MASTER::_openSpillFile()
+{
+#ifndef ABACUS_PARALLEL
+   ABA_STRING spillName(this);
+   char      *spillFileName;
+
+   if (getParameter("SpillFile", spillName)) {
+      spillFileName = new char[strlen(problemName_.string())+40];
+      sprintf(spillFileName, "%s.%d.spill", problemName_.string(), getpid());
+   }
+   else if (worker_) {
+      spillFileName = new char[strlen(spillName.string())+40];
+      sprintf(spillFileName, "%s.%d", spillName.string(), getpid());
+   }
+   else {
+      spillFileName = new char[strlen(spillName.string())+1];
+      strcpy(spillFileName, spillName.string());
+   }
+
+   delete spillFile_;
+   spillFile_ = new ABA_SPILLFILE(this, spillFileName);
+
+   delete [] spillFileName;
+#endif
+}
+
+void ABA_MASTER::_harvestHeuristics()
+{
+   double primalValue;
+
+   if (heurServer_ && heurServer_->harvest(primalValue) &&
+	 betterPrimal(primalValue))
+      primalBound(primalValue);
+}
+
+bool ABA_MASTER::_fixedToZero(ABA_VARIABLE *v) const
+{
+   ABA_FSVARSTAT *stat = v->fsVarStat();
+   double value;
+
+   switch (stat->status()) {
+      case ABA_FSVARSTAT::FixedToLowerBound:
+	 value = v->lBound();
+	 break;
+      case ABA_FSVARSTAT::FixedToUpperBound:
+	 value = v->uBound();
+	 break;
+      case ABA_FSVARSTAT::Fixed:
+	 value = stat->value();
+	 break;
+      default:
+	 return false;
+   }
+
+   return fabs(value) < machineEps();
+}
+
+bool ABA_MASTER::_rootRestartDue() const
+{
+   if (rootRestart_ <= 0.0 || varPool_->number() == 0) return false;
+
+   // count the variables fixed to zero 
+   /* Variables fixed to a nonzero value contribute to the right hand sides
+    *   of the constraints, hence they cannot be removed from the problem.
+    */
+   int nFixedToZero = 0;
+   const int size = varPool_->size();
+
+   for (int i = 0; i < size; i++) {
+      ABA_VARIABLE *v = varPool_->slot(i)->conVar();
+      if (v && _fixedToZero(v)) ++nFixedToZero;
+   }
+
+   return nFixedToZero >= rootRestart_*varPool_->number();
+}
+
+void ABA_MASTER::_restartRoot()
+{
+   restartRoot_ = false;
+   ++nRootRestarts_;
+
+   // release the references to the variables 
+   /* The local data of the old root and the candidates for fixing by
+    *   reduced costs reference the variables. The candidates are saved
+    *   again by the new root.
+    */
+   root_->deleteLocalData();
+   delete root_;
+   root_ = rRoot_ = 0;
+
+   fixCand_->deleteAll();
+
+   // remove the variables fixed to zero from the variable pool 
+   /* Variables which are still referenced, e.g., by solutions waiting for
+    *   the asynchronous primal heuristic, stay in the pool.
+    */
+   int nRemoved = 0;
+   const int size = varPool_->size();
+
+   for (int i = 0; i < size; i++) {
+      ABA_POOLSLOT<ABA_VARIABLE, ABA_CONSTRAINT> *slot = varPool_->slot(i);
+      ABA_VARIABLE *v = slot->conVar();
+
+      if (v && _fixedToZero(v) && v->deletable()) {
+	 varPool_->removeConVar(slot);
+	 ++nRemoved;
+      }
+   }
+
+   out() << endl << "Root restart: " << nRemoved;
+   out() << " variables fixed to zero removed, " << varPool_->number();
+   out() << " variables left" << endl;
+
+   // if no variable could be removed, the next root would restart again 
+   if (nRemoved == 0) rootRestart_ = 0.0;
+
+   // optimize the new root node 
+   root_  = firstSub();
+   rRoot_ = root_;
+
+   openSub_->insert(root_);
+   treeInterfaceNewNode(root_);
+}
+
+#ifndef ABACUS_PARALLEL
+
+bool ABA_MASTER::_startWorkers()
+{
+   const int nOpen = openSub_->number();
+
+   // sort the open subproblems
+   /* The open subproblems are distributed round robin in the order of their
+    *   dual bounds, such that each worker gets some of the most promising
+    *   ones. Since the order is determined before the processes are forked,
+    *   it is the same in all of them. The local data of spilled subproblems
+    *   is read back, since the spill file is not shared by the workers.
+    */
+   ABA_ARRAY<ABA_SUB*>      subs(this, nOpen);
+   ABA_ARRAY<double>        key(this, nOpen);
+   ABA_DLISTITEM<ABA_SUB*> *item;
+   ABA_SUB                 *s;
+   int                      i = 0;
+
+   forAllDListElem(openSub_->list_, item, s) {
+      if (s->spilled()) s->unspill();
+      subs[i] = s;
+      key[i]  = optSense_.max() ? -s->dualBound() : s->dualBound();
+      ++i;
+   }
+
+   ABA_SORTER<ABA_SUB*, double> sorter(this);
+   sorter.quickSort(nOpen, subs, key);
+
+   delete spillFile_;
+   spillFile_ = 0;
+
+   // the statistics at the start of the workers 
+   ABA_MESSAGE base(this);
+
+   _packStatistics(base);
+
+   out() << nOpen << " open subproblems distributed to " << workers_;
+   out() << " workers" << endl;
+
+   // quiesce the threads of this process
+   /* \a fork() duplicates only the calling thread. A mutex held by another
+    *   thread at the time of the fork would stay locked in the workers
+    *   forever, and data buffered for a file would be written twice.
+    *   Therefore, the heuristic threads and the writer threads of the tree
+    *   log and the checkpoints are stopped, and all buffers are flushed.
+    *   No LP is racing, since the LP of the last subproblem has been
+    *   deleted when it was deactivated.
+    */
+   if (heurServer_) {
+      heurServer_->stop();
+      _harvestHeuristics();
+   }
+   if (treeLog_)    treeLog_->stopWriter();
+   if (checkpoint_) checkpoint_->stopWriter();
+
+   out() << flush;
+   err() << flush;
+
+   // fork the workers
+   /* Each worker is connected to the coordinator by a local stream socket.
+    *   The tree log and the checkpoints of the coordinator are not written
+    *   by the workers. The cpu time of a worker starts with the cpu time of
+    *   the coordinator at the fork.
+    */
+   ABA_ARRAY<int> fd(this, workers_);
+   ABA_ARRAY<int> pid(this, workers_);
+   const long     cpuTime = totalTime_.centiSeconds();
+
+   for (int w = 0; w < workers_; w++) {
+      int pair[2];
+
+      if (socketpair(AF_UNIX, SOCK_STREAM, 0, pair)) {
+	 err() << "ABA_MASTER::_startWorkers(): socketpair() failed." << endl;
+	 exit(Fatal);
+      }
+
+      pid[w] = fork();
+
+      if (pid[w] < 0) {
+	 err() << "ABA_MASTER::_startWorkers(): fork() failed." << endl;
+	 exit(Fatal);
+      }
+
+      if (pid[w] == 0) {
+	 for (int v = 0; v < w; v++) close(fd[v]);
+	 close(pair[0]);
+
+	 worker_ = new ABA_WORKER(this, pair[1]);
+
+	 delete treeLog_;
+	 delete checkpoint_;
+
+	 VbcLog_             = NoVbc;
+	 treeLog_            = 0;
+	 checkpoint_         = 0;
+	 checkpointInterval_ = 0;
+
+	 if (heurServer_) {
+	    delete heurServer_;
+	    heurServer_ = new ABA_HEURSERVER(this, heuristicThreads_,
+		  heuristicQueueSize_);
+	 }
+
+	 totalTime_.reset();
+	 totalTime_.addCentiSeconds(cpuTime);
+	 totalTime_.start();
+
+	 out().off();
+	 out().logOff();
+
+	 if (spillMemory_) _openSpillFile();
+
+	 // keep the subproblems of this worker 
+	 for (i = 0; i < nOpen; i++)
+	    if (i%workers_ != w) subs[i]->transfer();
+
+	 return false;
+      }
+
+      close(pair[1]);
+      fd[w] = pair[0];
+   }
+
+   // coordinate the workers
+   /* The open subproblems of the coordinator are transferred, since they
+    *   are processed by the workers. The tree log is written by a thread
+    *   again.
+    */
+   for (i = 0; i < nOpen; i++)
+      subs[i]->transfer();
+
+   if (treeLog_) treeLog_->startWriter();
+
+   coordinator_ = new ABA_COORDINATOR(this, fd, pid, base);
+   status_      = coordinator_->run();
+
+   return true;
+}
+
+void ABA_MASTER::_packStatistics(ABA_MESSAGE &msg) const
+{
+   msg.pack(nSub_);
+   msg.pack(nLp_);
+   msg.pack(highestLevel_);
+   msg.pack(nFixed_);
+   msg.pack(nAddCons_);
+   msg.pack(nRemCons_);
+   msg.pack(nAddVars_);
+   msg.pack(nRemVars_);
+   msg.pack(nNewRoot_);
+   msg.pack(nSubSelected_);
+   msg.pack(nRootRestarts_);
+
+   msg.pack(totalTime_.centiSeconds());
+   msg.pack(lpTime_.centiSeconds());
+   msg.pack(lpSolverTime_.centiSeconds());
+   msg.pack(separationTime_.centiSeconds());
+   msg.pack(improveTime_.centiSeconds());
+   msg.pack(pricingTime_.centiSeconds());
+   msg.pack(branchingTime_.centiSeconds());
+}
+
+// unpack a counter of the statistics relative to \a base 
+static void unpackCounter(ABA_MESSAGE &msg, ABA_MESSAGE *base, int &counter)
+{
+   int x;
+
+   msg.unpack(x);
+   if (base) counter += x - base->unpackInt();
+   else      counter  = x;
+}
+
+// add a cpu time of the statistics relative to \a base 
+static void unpackTimer(ABA_MESSAGE &msg, ABA_MESSAGE *base, ABA_TIMER &timer)
+{
+   long centiSeconds;
+   long baseCentiSeconds = 0;
+
+   msg.unpack(centiSeconds);
+   if (base) base->unpack(baseCentiSeconds);
+   timer.addCentiSeconds(centiSeconds - baseCentiSeconds);
+}
+
+void ABA_MASTER::_unpackStatistics(ABA_MESSAGE &msg, ABA_MESSAGE *base)
+{
+   unpackCounter(msg, base, nSub_);
+   unpackCounter(msg, base, nLp_);
+
+   // the highest level is the maximum of all levels 
+   int level;
+
+   msg.unpack(level);
+   if (base) base->unpackInt();
+   if (!base || level > highestLevel_) highestLevel_ = level;
+
+   unpackCounter(msg, base, nFixed_);
+   unpackCounter(msg, base, nAddCons_);
+   unpackCounter(msg, base, nRemCons_);
+   unpackCounter(msg, base, nAddVars_);
+   unpackCounter(msg, base, nRemVars_);
+   unpackCounter(msg, base, nNewRoot_);
+   unpackCounter(msg, base, nSubSelected_);
+   unpackCounter(msg, base, nRootRestarts_);
+
+   unpackTimer(msg, base, totalTime_);
+   unpackTimer(msg, base, lpTime_);
+   unpackTimer(msg, base, lpSolverTime_);
+   unpackTimer(msg, base, separationTime_);
+   unpackTimer(msg, base, improveTime_);
+   unpackTimer(msg, base, pricingTime_);
+   unpackTimer(msg, base, branchingTime_);
+}
+
+#endif
+
+void ABA_MASTER::registerConPool(ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE> *pool)
+{
+   if (conPools_ == 0)
+      conPools_ = new ABA_BUFFER<ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE>*>(this, 4);
+   else if (conPools_->full())
+      conPools_->realloc(2*conPools_->size());
+
+   conPools_->push(pool);
+}
+
+int ABA_MASTER::nDefaultPools() const
+{
+   return conPools_ ? 3 + conPools_->number() : 3;
+}
+
+void ABA_MASTER::registerSeparator(int separator, const char *name)
+{
+   sepStat_->registerSeparator(separator, name);
+}
+
+double *ABA_MASTER::zeroScratch(int size)
+{
+   if (size < 1) size = 1;
+
+   if (zeroScratch_ == 0)
+      zeroScratch_ = new ABA_ARRAY<double>(this, size, 0.0);
+   else if (zeroScratch_->size() < size) {
+      int newSize = 2*zeroScratch_->size();
+      if (newSize < size) newSize = size;
+      zeroScratch_->realloc(newSize, 0.0);
+   }
+
+   return &(*zeroScratch_)[0];
+}
+
+void *ABA_MASTER::defaultPool(int i) const
+{
+   switch (i) {
+      case 0: return conPool_;
+      case 1: return cutPool_;
+      case 2: return varPool_;
+   }
+   if (i > 2 && i < nDefaultPools()) return (*conPools_)[i - 3];
+   return 0;
+}
+
+int ABA_MASTER::defaultPoolIndex(const void *pool) const
+{
+   if (pool == 0)        return -1;
+   if (pool == conPool_) return 0;
+   if (pool == cutPool_) return 1;
+   if (pool == varPool_) return 2;
+
+   const int n = nDefaultPools();
+   for (int i = 3; i < n; i++)
+      if (pool == (*conPools_)[i - 3]) return i;
+   return -1;
+}
 
 ABA_MASTER::STATUS ABA_MASTER::optimize()
 {
@@ -282,6 +783,27 @@ ABA_MASTER::STATUS ABA_MASTER::optimize()
    if (logLevel_ != Full) out().logOff();
 
 #ifdef ABACUS_PARALLEL
+   //! the binary tree log is not supported by the parallel version
+   if (VbcLog_ == Binary) {
+      err() << "WARNING: ABA_MASTER::optimize(): VbcLog Binary is not ";
+      err() << "supported by the parallel version, using File." << endl;
+      VbcLog_ = File;
+   }
+
+   //! spilling subproblems is not supported by the parallel version
+   if (spillMemory_) {
+      err() << "WARNING: ABA_MASTER::optimize(): SpillMemory is not ";
+      err() << "supported by the parallel version, ignored." << endl;
+      spillMemory_ = 0;
+   }
+
+   //! distributing the optimization over workers is not supported either
+   if (workers_) {
+      err() << "WARNING: ABA_MASTER::optimize(): Workers is not ";
+      err() << "supported by the parallel version, ignored." << endl;
+      workers_ = 0;
+   }
+
    if (parmaster_->isHostZero()) {
       //! initialize the tree-log file
       if (VbcLog_ == File) {
@@ -312,6 +834,30 @@ ABA_MASTER::STATUS ABA_MASTER::optimize()
 
    }
 #else
+   // check the parameters of a distributed optimization
+   /* The constraints of the constraint pool and the variables must be
+    *   identical in all processes, hence no variables may be generated.
+    *   Checkpoints are not written, since the open subproblems are
+    *   distributed over the workers.
+    */
+   if (workers_ && pricing_) {
+      err() << "WARNING: ABA_MASTER::optimize(): Workers requires that ";
+      err() << "no variables are generated, ignored." << endl;
+      workers_ = 0;
+   }
+
+   if (workers_ && checkpointInterval_) {
+      err() << "WARNING: ABA_MASTER::optimize(): CheckpointInterval is not ";
+      err() << "supported with Workers, ignored." << endl;
+      checkpointInterval_ = 0;
+   }
+
+   if (workers_ && heuristicThreads_) {
+      err() << "WARNING: ABA_MASTER::optimize(): HeuristicThreads is not ";
+      err() << "supported with Workers, ignored." << endl;
+      heuristicThreads_ = 0;
+   }
+
    // initialize the tree-log file
    /* If \a VbcLog_ is \a File, then we generate a log-file which can be read
     *   by the VBC-tool to visualize the implicit enumeration. The name
@@ -320,6 +866,8 @@ ABA_MASTER::STATUS ABA_MASTER::optimize()
     *   of the log-file is sufficient for process ids represented by integers with
     *   up to 64 bit (a 64 bit integer has most 19 decimal digits).
     *   If \a VbcLog_ is \a Pipe then we write the instructions to standard out.
+    *   If \a VbcLog_ is \a Binary, the log-file gets the extension {\tt .btree}
+    *   and is written by an ABA_TREELOG.
     */  
    if (VbcLog_ == File) {
       char *treeStreamName = new char[strlen(problemName_.string())+40];
@@ -329,6 +877,15 @@ ABA_MASTER::STATUS ABA_MASTER::optimize()
 
       delete [] treeStreamName;
    }
+   else if (VbcLog_ == Binary) {
+      char *treeLogName = new char[strlen(problemName_.string())+40];
+
+      sprintf(treeLogName, "%s.%d.btree", problemName_.string(), getpid());
+      delete treeLog_;
+      treeLog_ = new ABA_TREELOG(this, treeLogName, vbcBufferSize_);
+
+      delete [] treeLogName;
+   }
    else if (VbcLog_ == Pipe)
    {
       ABA_STRING pipeName(this);
@@ -466,9 +1023,32 @@ ABA_MASTER::STATUS ABA_MASTER::optimize()
    root_   = firstSub();
    rRoot_  = root_;
 
-   openSub_->insert(root_);
+   // open the spill file 
+   if (spillMemory_) _openSpillFile();
 
-   treeInterfaceNewNode(root_);
+   // restart from a checkpoint
+   /* If the optimization is restarted from a checkpoint, the restored
+    *   open subproblems become the sons of the root node, which is not
+    *   optimized again. If the checkpoint cannot be read, we start
+    *   with the root node as usual.
+    */
+   if (checkpointInterval_ || checkpointRestart_) {
+      delete checkpoint_;
+      checkpoint_ = new ABA_CHECKPOINT(this, checkpointFile_.string());
+   }
+
+   if (!checkpointRestart_ || !checkpoint_->restart()) {
+      openSub_->insert(root_);
+
+      treeInterfaceNewNode(root_);
+   }
+
+   // start the asynchronous primal heuristic 
+   if (heuristicThreads_) {
+      delete heurServer_;
+      heurServer_ = new ABA_HEURSERVER(this, heuristicThreads_,
+	    heuristicQueueSize_);
+   }
 #endif
 
 #ifdef ABACUS_PARALLEL
@@ -485,10 +1065,16 @@ ABA_MASTER::STATUS ABA_MASTER::optimize()
     *   immediately..
     */  
    ABA_SUB *current;
+   long     lastCheckpoint = totalCowTime_.seconds();
 
    while ((current = select())) {
       ++nSubSelected_;
 
+#ifndef ABACUS_PARALLEL
+      // update the primal bound by the asynchronous primal heuristic 
+      _harvestHeuristics();
+#endif
+
       if (current->optimize()) {
 	 status_ = Error;
 	 break;
@@ -496,9 +1082,68 @@ ABA_MASTER::STATUS ABA_MASTER::optimize()
 #ifdef ABACUS_PARALLEL
       if (current->status() == ABA_SUB::Fathomed)
 	 delete current;
+#else
+      // restart the optimization with a new root node 
+      if (restartRoot_) {
+	 _restartRoot();
+	 continue;
+      }
+
+      // exchange information with the coordinator 
+      if (worker_) worker_->communicate();
+
+      // start the workers of a distributed optimization
+      /* The workers are started as soon as there are enough open subproblems
+       *   for all of them. In the coordinating process \a _startWorkers()
+       *   returns after the distributed optimization has terminated.
+       */
+      if (workers_ && !worker_ && !coordinator_ &&
+	    openSub_->number() >= workerRampUp_*workers_) {
+	 if (_startWorkers()) break;
+	 continue;
+      }
+
+      // write a checkpoint if the interval has elapsed 
+      if (checkpointInterval_ && 
+	    totalCowTime_.seconds() - lastCheckpoint >= checkpointInterval_) {
+	 checkpoint_->write();
+	 lastCheckpoint = totalCowTime_.seconds();
+      }
+
+      // spill open subproblems if the memory limit is exceeded 
+      if (spillMemory_) {
+	 int nSpilled = openSub_->spill(1048576L*spillMemory_);
+
+	 if (nSpilled) {
+	    out(1) << nSpilled << " open subproblems spilled to disk, ";
+	    out() << spillFile_->used() << " bytes in spill file" << endl;
+	 }
+      }
 #endif
    }
 
+#ifndef ABACUS_PARALLEL
+   // stop the asynchronous primal heuristic
+   /* The heuristic threads finish the solutions they are working on, such
+    *   that the best solution found by them is still taken into account.
+    */
+   if (heurServer_) {
+      heurServer_->stop();
+      _harvestHeuristics();
+   }
+
+   // terminate a worker of a distributed optimization
+   /* The status and the statistics are sent to the coordinator, which
+    *   outputs the result of the whole optimization. The process terminates
+    *   without cleaning up the tree and the pools.
+    */
+   if (worker_) {
+      worker_->finish(status_);
+      delete spillFile_;
+      _exit(0);
+   }
+#endif
+
    if (status_ == Processing) status_ = Optimal;
 
 
@@ -540,8 +1185,12 @@ ABA_MASTER::STATUS ABA_MASTER::optimize()
    out() << endl;
    out() << "  Number of root changes            : ";
    out() << setWidth(w) << nNewRoot_ << endl;
+   out() << "  Number of root restarts           : ";
+   out() << setWidth(w) << nRootRestarts_ << endl;
 
    _outputLpStatistics();
+   out() << endl << *lpMethodStat_;
+   out() << endl << *sepStat_;
 #ifdef ABACUS_PARALLEL
    parmaster_->outputStatistics();
 #endif
@@ -633,6 +1282,9 @@ ABA_MASTER::STATUS ABA_MASTER::optimize()
 
    fixCand_->deleteAll();
 
+   delete heurServer_;
+   heurServer_ = 0;
+
 #ifdef ABACUS_PARALLEL
    if (VbcLog_ == Pipe && parmaster_->isHostZero()) {
 #else
@@ -643,6 +1295,9 @@ ABA_MASTER::STATUS ABA_MASTER::optimize()
 	 writeTreeInterface(string);
       }
 
+      if (treeLog_) treeLog_->flush();
+      if (checkpoint_) checkpoint_->flush();
+
       return status_;
 
    }
@@ -650,6 +1305,12 @@ ABA_MASTER::STATUS ABA_MASTER::optimize()
    void ABA_MASTER::initializeOptimization()
    {}
 
+   int ABA_MASTER::asyncImprove(ABA_LPSOLUTION<ABA_VARIABLE, ABA_CONSTRAINT> *lpSolution,
+	 double &primalValue)
+   {
+      return 0;
+   }
+
    void ABA_MASTER::initializePools(ABA_BUFFER<ABA_CONSTRAINT*>  &constraints,
 	 ABA_BUFFER<ABA_VARIABLE*>    &variables,
 	 int varPoolSize,
@@ -781,10 +1442,18 @@ ABA_SUB* ABA_MASTER::select()
     *   sons of subproblems having this maximal level, but does not
     *   stop the optimization.
     */  
+#ifndef ABACUS_PARALLEL
+   if (worker_ && worker_->stopped()) {
+      _fathomTree();
+      return 0;
+   }
+#endif
+
    if (totalTime_.exceeds(maxCpuTime())) {
       out() << "Maximal CPU time " << maxCpuTime() << " exceeded." << endl;
       out() << "Stop optimization." << endl;
-      root_->fathomTheSubTree();
+      _finalCheckpoint();
+      _fathomTree();
       status_ = MaxCpuTime;
       return 0;
    }
@@ -792,22 +1461,35 @@ ABA_SUB* ABA_MASTER::select()
    if (totalCowTime_.exceeds(maxCowTime())) {
       out() << "Maximal elapsed time " << maxCowTime() << " exceeded." << endl;
       out() << "Stop optimization." << endl;
-      root_->fathomTheSubTree();
+      _finalCheckpoint();
+      _fathomTree();
       status_ = MaxCowTime;
       return 0;
    }
 
-   if (guaranteed()) {
+   // check the guarantee 
+   /* The guarantee of a worker of a distributed optimization is checked by
+    *   the coordinator, since the dual bound of the worker is only valid
+    *   for its own subproblems.
+    */
+   if (!worker_ && guaranteed()) {
       out() << endl;
       out() << "Guarantee " << requiredGuarantee() << " % reached." << endl;
       out() << "Terminate optimization." << endl;
       status_ = Guaranteed;
-      root_->fathomTheSubTree();
+      _fathomTree();
       return 0;
    }
 
+   ABA_SUB *sub = openSub_->select();
+
+#ifndef ABACUS_PARALLEL
+   // wait for subproblems of other workers 
+   while (sub == 0 && worker_ && worker_->idle())
+      sub = openSub_->select();
+#endif
 
-   return openSub_->select();
+   return sub;
 }
 
 int ABA_MASTER::enumerationStrategy(const ABA_SUB *s1, const ABA_SUB
@@ -935,6 +1617,11 @@ void ABA_MASTER::primalBound(double x)
    else                   treeInterfaceUpperBound(x);
 
    history_->update();
+
+#ifndef ABACUS_PARALLEL
+   // report the primal bound to the coordinator 
+   if (worker_) worker_->primalBound(x);
+#endif
 }
 
 void ABA_MASTER::dualBound(double x)
@@ -1179,7 +1866,7 @@ void ABA_MASTER::theFuture()
 
 void ABA_MASTER::writeTreeInterface(const char *info, bool time) const
 {
-   if (VbcLog_ == NoVbc) return;
+   if (VbcLog_ == NoVbc || VbcLog_ == Binary) return;
 
 #ifdef ABACUS_PARALLEL
    if (!parmaster_->isHostZero()) {
@@ -1212,6 +1899,11 @@ void ABA_MASTER::treeInterfaceNewNode(ABA_SUB *sub) const
 #else
       if (sub == root_) fatherId = 0;
       else              fatherId = sub->father()->id();
+
+      if (VbcLog_ == Binary) {
+	 treeLog_->newNode(totalTime_.centiSeconds(), fatherId, sub->id());
+	 return;
+      }
 #endif
       sprintf(string, "N %d %d 5", fatherId, sub->id());
       writeTreeInterface(string);
@@ -1233,6 +1925,11 @@ void ABA_MASTER::treeInterfacePaintNode(int id, int color) const
 {
    if (VbcLog_ == NoVbc) return;
 
+   if (VbcLog_ == Binary) {
+      treeLog_->paintNode(totalTime_.centiSeconds(), id, color);
+      return;
+   }
+
    char string[256];
    sprintf(string, "P %d %d", id, color);
    writeTreeInterface(string);
@@ -1242,6 +1939,11 @@ void ABA_MASTER::treeInterfaceLowerBound(double lb) const
 {
    if (VbcLog_ == NoVbc) return;
 
+   if (VbcLog_ == Binary) {
+      treeLog_->lowerBound(totalTime_.centiSeconds(), lb);
+      return;
+   }
+
    char string[256];
    sprintf(string, "L %f", lb);
    writeTreeInterface(string);
@@ -1251,6 +1953,11 @@ void ABA_MASTER::treeInterfaceUpperBound(double ub) const
 {
    if (VbcLog_ == NoVbc) return;
 
+   if (VbcLog_ == Binary) {
+      treeLog_->upperBound(totalTime_.centiSeconds(), ub);
+      return;
+   }
+
    char string[256];
    sprintf(string, "U %f", ub);
    writeTreeInterface(string);
@@ -1260,6 +1967,14 @@ void ABA_MASTER::treeInterfaceNodeBounds(int id, double lb, double ub)
 {
    if (VbcLog_ == NoVbc) return;
 
+   // infinite bounds are logged as \a HUGE_VAL in the binary log 
+   if (VbcLog_ == Binary) {
+      if (isInfinity(fabs(lb))) lb = HUGE_VAL;
+      if (isInfinity(fabs(ub))) ub = HUGE_VAL;
+      treeLog_->nodeBounds(totalTime_.centiSeconds(), id, lb, ub);
+      return;
+   }
+
    char string[256];
 
    if (isInfinity(fabs(lb))) {
@@ -1349,6 +2064,19 @@ void ABA_MASTER::_initializeParameters()
       insertParameter("SkipFactor","1");
       insertParameter("SkippingMode","SkipByNode");
       insertParameter("FixSetByRedCost","true");
+      insertParameter("BoundPropagation","true");
+      insertParameter("ObjectiveCutoff","true");
+      insertParameter("ConflictAnalysis","true");
+      insertParameter("MaxConflictSize","20");
+      insertParameter("DivingFrequency","10");
+      insertParameter("DivingStrategy","Rotating");
+      insertParameter("HeuristicThreads","0");
+      insertParameter("HeuristicQueueSize","4");
+      insertParameter("LpMethodSelection","Fixed");
+      insertParameter("LpMethodTrials","3");
+      insertParameter("LpRace","false");
+      insertParameter("RootRestart","0.0");
+      insertParameter("AdaptiveCutting","0.0");
       insertParameter("PrintLP","false");
       insertParameter("MaxConAdd","100");
       insertParameter("MaxConBuffered","100");
@@ -1365,6 +2093,12 @@ void ABA_MASTER::_initializeParameters()
       insertParameter("VarElimEps","0.001");
       insertParameter("VarElimAge","1");
       insertParameter("VbcLog","None");
+      insertParameter("VbcBufferSize","1048576");
+      insertParameter("CheckpointInterval","0");
+      insertParameter("CheckpointRestart","false");
+      insertParameter("SpillMemory","0");
+      insertParameter("Workers","0");
+      insertParameter("WorkerRampUp","2");
       insertParameter("DefaultLpSolver","Clp");
       insertParameter("SolveApprox","false");
 
@@ -1484,6 +2218,47 @@ void ABA_MASTER::_initializeParameters()
    // is fixing/setting by reduced costs turned on? 
    assignParameter(fixSetByRedCost_,"FixSetByRedCost");
 
+   // is the bound propagation turned on? 
+   assignParameter(boundPropagation_,"BoundPropagation");
+
+   // should the primal bound be passed as objective limit to the LP-solver? 
+   assignParameter(objectiveCutoff_,"ObjectiveCutoff");
+
+   // should conflict constraints be derived from infeasible LPs? 
+   assignParameter(conflictAnalysis_,"ConflictAnalysis");
+
+   // get the maximal size of a conflict constraint 
+   assignParameter(maxConflictSize_,"MaxConflictSize",0,INT_MAX);
+
+   // get the frequency of the diving heuristics 
+   assignParameter(divingFrequency_,"DivingFrequency",0,INT_MAX);
+
+   // get the diving heuristics 
+   divingStrategy_=(DIVINGSTRAT)
+      findParameter("DivingStrategy",5,DIVINGSTRAT_);
+
+   // get the number of threads of the asynchronous primal heuristic 
+   assignParameter(heuristicThreads_,"HeuristicThreads",0,INT_MAX);
+
+   // get the length of the queue of the asynchronous primal heuristic 
+   assignParameter(heuristicQueueSize_,"HeuristicQueueSize",1,INT_MAX);
+
+   // get the selection of the LP-method 
+   lpMethodSelection_=(LPMETHODSEL)
+      findParameter("LpMethodSelection",2,LPMETHODSEL_);
+
+   // get the number of trials of each LP-method 
+   assignParameter(lpMethodTrials_,"LpMethodTrials",0,INT_MAX);
+
+   // should the first LP of the root be solved by a race? 
+   assignParameter(lpRace_,"LpRace");
+
+   // share of variables fixed to zero for a restart of the root 
+   assignParameter(rootRestart_,"RootRestart",0.0,1.0);
+
+   // share of the root's improvement per second for the adaptive cutting 
+   assignParameter(adaptiveCutting_,"AdaptiveCutting",0.0,1.0);
+
    // should the LP be output every iteration? 
    assignParameter(printLP_, "PrintLP");
 
@@ -1540,7 +2315,32 @@ void ABA_MASTER::_initializeParameters()
    assignParameter(varElimAge_,"VarElimAge",1,INT_MAX);
 
    // should a log-file of the enumeration tree be generated? 
-   VbcLog_=(VBCMODE)findParameter("VbcLog",3,VBCMODE_);
+   VbcLog_=(VBCMODE)findParameter("VbcLog",4,VBCMODE_);
+
+   // get the buffer size of the binary log-file of the enumeration tree 
+   assignParameter(vbcBufferSize_,"VbcBufferSize",1024,INT_MAX,1048576);
+
+   // get the parameters for checkpoints of the enumeration tree
+   /* If no name of the checkpoint file is given, the name of the problem
+    *   with the extension {\tt .ckpt} is used.
+    */
+   assignParameter(checkpointInterval_,"CheckpointInterval",0,INT_MAX,0);
+   assignParameter(checkpointRestart_,"CheckpointRestart",false);
+   if (getParameter("CheckpointFile",checkpointFile_)) {
+      char *checkpointName = new char[strlen(problemName_.string())+6];
+
+      sprintf(checkpointName, "%s.ckpt", problemName_.string());
+      checkpointFile_ = checkpointName;
+
+      delete [] checkpointName;
+   }
+
+   // get the memory limit for open subproblems 
+   assignParameter(spillMemory_,"SpillMemory",0,INT_MAX,0);
+
+   // get the parameters of a distributed optimization 
+   assignParameter(workers_,"Workers",0,1024,0);
+   assignParameter(workerRampUp_,"WorkerRampUp",1,INT_MAX,2);
 
 
    //! get the default LP-solver 
@@ -1698,6 +2498,11 @@ bool ABA_MASTER::delayedBranching(int nOpt) const
    else                          return true;
 }
 
+void ABA_MASTER::pricing(bool on)
+{
+   pricing_ = on;
+}
+
 void ABA_MASTER::pricingFreq(int f)
 {
    if (f < 0) {
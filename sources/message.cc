@@ -28,6 +28,8 @@
 
 #include "abacus/message.h"
 
+#ifdef ABACUS_PARALLEL
+
 int ABA_MESSAGE::readit(ABA_MESSAGE *msg, char *buf, int len)
 {
   //! receive and decode len1 (the length of the message)
@@ -92,3 +94,147 @@ int ABA_MESSAGE::writeit(ABA_MESSAGE *msg, const char *buf, int len)
     stream_.close();
   }
 
+#else  // ABACUS_PARALLEL
+
+#include <errno.h>
+#include <unistd.h>
+
+  ABA_MESSAGE::ABA_MESSAGE(ABA_GLOBAL *glob, int size)
+  :
+    glob_(glob),
+    owner_(true),
+    size_(size < 16 ? 16 : size),
+    n_(0),
+    pos_(0)
+  {
+    buf_ = new char[size_];
+  }
+
+  ABA_MESSAGE::~ABA_MESSAGE()
+  {
+    if (owner_) delete [] buf_;
+  }
+
+  int ABA_MESSAGE::write(FILE *file) const
+  {
+    if (fwrite(&n_, sizeof(long), 1, file) != 1) return 1;
+    if (n_ && (long) fwrite(buf_, 1, n_, file) != n_) return 1;
+    return 0;
+  }
+
+  int ABA_MESSAGE::read(FILE *file)
+  {
+    long n;
+
+    clear();
+    if (fread(&n, sizeof(long), 1, file) != 1 || n < 0) return 1;
+    if (n > size_) realloc(n);
+    if (n && (long) fread(buf_, 1, n, file) != n) return 1;
+    n_ = n;
+    return 0;
+  }
+
+// write all \a n bytes of \a data to the file descriptor \a fd
+/* A single call of \a write() can write less bytes, e.g., if the buffer
+ *   of a socket is full, or it can be interrupted by a signal.
+ */
+  static int writeAll(int fd, const char *data, long n)
+  {
+    while (n > 0) {
+      ssize_t r = ::write(fd, data, n);
+      if (r < 0) {
+        if (errno == EINTR) continue;
+        return 1;
+      }
+      data += r;
+      n    -= r;
+    }
+    return 0;
+  }
+
+// read \a n bytes from the file descriptor \a fd to \a data
+  static int readAll(int fd, char *data, long n)
+  {
+    while (n > 0) {
+      ssize_t r = ::read(fd, data, n);
+      if (r < 0) {
+        if (errno == EINTR) continue;
+        return 1;
+      }
+      if (r == 0) return 1;
+      data += r;
+      n    -= r;
+    }
+    return 0;
+  }
+
+  int ABA_MESSAGE::send(int fd) const
+  {
+    if (writeAll(fd, (const char*) &n_, sizeof(long))) return 1;
+    return writeAll(fd, buf_, n_);
+  }
+
+  int ABA_MESSAGE::receive(int fd)
+  {
+    long n;
+
+    clear();
+    if (readAll(fd, (char*) &n, sizeof(long)) || n < 0) return 1;
+    if (n > size_) realloc(n);
+    if (readAll(fd, buf_, n)) return 1;
+    n_ = n;
+    return 0;
+  }
+
+  void ABA_MESSAGE::attach(const char *data, long n)
+  {
+    if (owner_) delete [] buf_;
+
+    buf_   = (char*) data;
+    owner_ = false;
+    size_  = n;
+    n_     = n;
+    pos_   = 0;
+  }
+
+  void ABA_MESSAGE::swap(ABA_MESSAGE &rhs)
+  {
+    char *buf   = buf_;
+    bool  owner = owner_;
+    long  size  = size_;
+    long  n     = n_;
+    long  pos   = pos_;
+
+    buf_   = rhs.buf_;
+    owner_ = rhs.owner_;
+    size_  = rhs.size_;
+    n_     = rhs.n_;
+    pos_   = rhs.pos_;
+
+    rhs.buf_   = buf;
+    rhs.owner_ = owner;
+    rhs.size_  = size;
+    rhs.n_     = n;
+    rhs.pos_   = pos;
+  }
+
+// enlarge the buffer
+/* The size of the buffer is at least doubled such that packing a message
+ *   of \a n bytes requires only \a O(log n) reallocations. Attached data
+ *   is copied to a buffer of the message, but not released.
+ */
+  void ABA_MESSAGE::realloc(long n)
+  {
+    long newSize = 2*size_;
+    if (newSize < n) newSize = n;
+
+    char *newBuf = new char[newSize];
+    if (n_) memcpy(newBuf, buf_, n_);
+    if (owner_) delete [] buf_;
+
+    buf_   = newBuf;
+    owner_ = true;
+    size_  = newSize;
+  }
+
+#endif  // ABACUS_PARALLEL
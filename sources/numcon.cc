@@ -47,9 +47,7 @@
   { }
 
 
-#ifdef ABACUS_PARALLEL
-
-  ABA_NUMCON::ABA_NUMCON(const ABA_MASTER *master, ABA_MESSAGE &msg)
+  ABA_NUMCON::ABA_NUMCON(ABA_MASTER *master, ABA_MESSAGE &msg)
   :  
     ABA_CONSTRAINT(master, msg)
   {
@@ -67,7 +65,10 @@
     return NUMCON_CLASSID;
   }
 
-#endif
+  bool ABA_NUMCON::explicitRow() const
+  {
+    return true;
+  }
 
   ostream &operator<<(ostream &out, const ABA_NUMCON &rhs)
   {
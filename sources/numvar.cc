@@ -47,9 +47,7 @@
   { }
 
 
-#ifdef ABACUS_PARALLEL
-
-  ABA_NUMVAR::ABA_NUMVAR(const ABA_MASTER *master, ABA_MESSAGE &msg)
+  ABA_NUMVAR::ABA_NUMVAR(ABA_MASTER *master, ABA_MESSAGE &msg)
   :  
     ABA_VARIABLE(master, msg)
   {
@@ -67,8 +65,6 @@
     return NUMVAR_CLASSID;
   }
 
-#endif
-
   ostream &operator<<(ostream &out, const ABA_NUMVAR &rhs)
   {
     return out << '(' << rhs.number_  << ')' << endl;
@@ -30,6 +30,7 @@
 #include "abacus/sub.h"
 #include "abacus/master.h"
 #include "abacus/optsense.h"
+#include "abacus/sorter.h"
 
 #ifdef ABACUS_PARALLEL
 #include "abacus/parmaster.h"
@@ -218,10 +219,85 @@
     
     updateDualBound();
 
+    if (min->spilled()) min->unspill();
+
     return min;
 #endif
   }
 
+#ifndef ABACUS_PARALLEL
+
+  int ABA_OPENSUB::spill(long memoryLimit)
+  {
+    ABA_DLISTITEM<ABA_SUB*> *item;
+    ABA_SUB                 *s;
+
+// estimate the memory of the open subproblems
+/* The data of a father is counted when its first son is found which
+ *   depends on it, i.e., which is unprocessed, not spilled, and has no
+ *   own data. Such sons and the subproblems with own data are the
+ *   candidates for spilling.
+ */
+  long memory = 0;
+  int  nCand  = 0;
+
+  forAllDListElem(list_, item, s) {
+    if (s->spilled()) continue;
+    if (s->actVar_) {
+      memory += s->localMemory();
+      ++nCand;
+    }
+    else if (s->father_) {
+      ABA_SUB *father = s->father_;
+      int      i;
+
+      for (i = 0; i < father->sons_->number(); i++) {
+        ABA_SUB *son = (*(father->sons_))[i];
+        if (son->status_ == ABA_SUB::Unprocessed && son->actVar_ == 0 &&
+            !son->spilled())
+          break;
+      }
+      if ((*(father->sons_))[i] == s)
+        memory += father->localMemory();
+      ++nCand;
+    }
+  }
+
+  if (memory <= memoryLimit) return 0;
+
+// sort the candidates
+/* The candidates are sorted according to their dual bounds such that
+ *   the least promising subproblems come first.
+ */
+  ABA_ARRAY<ABA_SUB*> cand(master_, nCand);
+  ABA_ARRAY<double>   key(master_, nCand);
+  const bool          max = master_->optSense()->max();
+
+  nCand = 0;
+  forAllDListElem(list_, item, s) {
+    if (s->spilled() || (s->actVar_ == 0 && s->father_ == 0)) continue;
+    cand[nCand] = s;
+    key[nCand]  = max ? s->dualBound() : -s->dualBound();
+    ++nCand;
+  }
+
+  ABA_SORTER<ABA_SUB*, double> sorter(master_);
+  sorter.quickSort(nCand, cand, key);
+
+  // spill the subproblems
+  const long target  = memoryLimit/4*3;
+  int        nSpilled = 0;
+
+  for (int i = 0; i < nCand && memory > target; i++) {
+    memory -= cand[i]->spill();
+    ++nSpilled;
+  }
+
+  return nSpilled;
+  }
+
+#endif
+
   void ABA_OPENSUB::remove(ABA_SUB* sub)
   {
 #ifdef ABACUS_PARALLEL
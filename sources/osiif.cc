@@ -32,17 +32,62 @@
 #include "abacus/osiif.h"
 #include "abacus/column.h"
 #include "abacus/row.h"
+#include "abacus/sorter.h"
+#include "abacus/cowtimer.h"
 
 #include <string.h>
 #include <stdio.h>
 #include <limits.h>
 
 #include <math.h>
+#include <pthread.h>
 
 extern "C" {
 #include <unistd.h>
 }
 
+// the state of a race of the primal and the dual simplex method
+/* The state is shared by \a ABA_OSIIF::_race() and the two racing threads.
+ *   It is deleted by \a ABA_OSIIF::joinRace() after both threads have been
+ *   joined, since the losing thread may still be running after \a _race()
+ *   has returned.
+ */
+  struct OsiRace {
+    pthread_mutex_t     mutex;
+    pthread_cond_t      cond;
+    OsiSolverInterface *lp[2];
+    pthread_t           thread[2];
+    bool                started[2];
+    int                 winner;
+  };
+
+  struct OsiRacer {
+    OsiRace *race;
+    int      index;
+  };
+
+  static void *osiRacer(void *arg)
+  {
+    OsiRacer *racer = (OsiRacer*) arg;
+    OsiRace  *race  = racer->race;
+    const int index = racer->index;
+
+    delete racer;
+
+    // copy 0 is solved with the primal, copy 1 with the dual simplex method
+    if (index == 0) race->lp[0]->initialSolve();
+    else            race->lp[1]->resolve();
+
+    pthread_mutex_lock(&race->mutex);
+    if (race->winner == -1) {
+      race->winner = index;
+      pthread_cond_signal(&race->cond);
+    }
+    pthread_mutex_unlock(&race->mutex);
+
+    return 0;
+  }
+
 void ABA_OSIIF::freeInt(int*& ptr)
 {
    if( ptr != NULL )
@@ -92,6 +137,12 @@ ABA_OSIIF::ABA_OSIIF(ABA_MASTER *master)
    : 
 ABA_LP(master),
    osiLP_(NULL),
+   standbyLP_(NULL),
+   race_(0),
+   approxX_(0),
+   approxY_(0),
+   approxNCol_(0),
+   approxNRow_(0),
    value_(0.),
    xVal_(NULL),
    barXVal_(NULL),
@@ -123,6 +174,12 @@ ABA_OSIIF::ABA_OSIIF(ABA_MASTER *master,
 : 
 ABA_LP(master),
    osiLP_(NULL),
+   standbyLP_(NULL),
+   race_(0),
+   approxX_(0),
+   approxY_(0),
+   approxNCol_(0),
+   approxNRow_(0),
    value_(0.),
    xVal_(NULL),
    barXVal_(NULL),
@@ -144,7 +201,10 @@ ABA_LP(master),
 
 ABA_OSIIF::~ABA_OSIIF()
 {
+   joinRace();
+   discardApprox();
    delete ws_;
+   delete standbyLP_;
    delete osiLP_;
 }
 
@@ -153,6 +213,8 @@ void ABA_OSIIF::_initialize(ABA_OPTSENSE sense, int nRow, int maxRow,
       ABA_ARRAY<double> &obj, ABA_ARRAY<double> &lBound,
       ABA_ARRAY<double> &uBound, ABA_ARRAY<ABA_ROW*> &rows)
 {
+   discardStandby();
+   discardApprox();
    osiLP_ = getDefaultInterface();
    currentSolverType_ = Exact;
 
@@ -296,6 +358,8 @@ int ABA_OSIIF::_getInfeas(int &infeasRow, int &infeasCol, double *bInvRow)
 
 void ABA_OSIIF::_remRows(ABA_BUFFER<int> &ind)
 {
+   discardStandby();
+   discardApprox();
    const int n = ind.number();
    int *indices = new int[n];
 
@@ -315,6 +379,7 @@ void ABA_OSIIF::_remRows(ABA_BUFFER<int> &ind)
 
 void ABA_OSIIF::_addRows(ABA_BUFFER<ABA_ROW*> &rows)
 {
+   discardStandby();
    CoinPackedVector *coinrow = new CoinPackedVector();
 
    for (int i = 0; i < rows.number(); i++) {
@@ -340,6 +405,8 @@ void ABA_OSIIF::_addRows(ABA_BUFFER<ABA_ROW*> &rows)
 
 void ABA_OSIIF::_remCols(ABA_BUFFER<int> &vars)
 {
+   discardStandby();
+   discardApprox();
    int num = vars.number();
    int *indices = new int[num];
 
@@ -359,6 +426,7 @@ void ABA_OSIIF::_remCols(ABA_BUFFER<int> &vars)
 
 void ABA_OSIIF::_addCols(ABA_BUFFER<ABA_COLUMN*> &newCols)
 {
+   discardStandby();
    int num;
    double ub, lb, obj;
    int  *supports; //!< supports of added rows
@@ -398,6 +466,8 @@ void ABA_OSIIF::_addCols(ABA_BUFFER<ABA_COLUMN*> &newCols)
 
 void ABA_OSIIF::_changeRhs(ABA_ARRAY<double> &newRhs)
 {
+   discardStandby();
+
    lpSolverTime_.start();
 
    for (int i = 0; i < newRhs.size(); i++) 
@@ -410,6 +480,8 @@ void ABA_OSIIF::_changeRhs(ABA_ARRAY<double> &newRhs)
 
 void ABA_OSIIF::_changeLBound(int i, double newLb)
 {
+   discardStandby();
+
    lpSolverTime_.start();
 
    osiLP_->setColLower(i, newLb);
@@ -420,6 +492,8 @@ void ABA_OSIIF::_changeLBound(int i, double newLb)
 
 void ABA_OSIIF::_changeUBound(int i, double newUb)
 {
+   discardStandby();
+
    lpSolverTime_.start();
 
    osiLP_->setColUpper(i, newUb);
@@ -428,6 +502,33 @@ void ABA_OSIIF::_changeUBound(int i, double newUb)
    lpSolverTime_.stop();
 }
 
+void ABA_OSIIF::_changeBounds(ABA_BUFFER<int> &ind, ABA_BUFFER<double> &lb,
+                              ABA_BUFFER<double> &ub)
+{
+   discardStandby();
+
+   lpSolverTime_.start();
+
+   const int n = ind.number();
+   int    *index  = new int[n];
+   double *bounds = new double[2*n];
+
+   for (int i = 0; i < n; i++) {
+      index[i]        = ind[i];
+      bounds[2*i]     = lb[i];
+      bounds[2*i + 1] = ub[i];
+   }
+
+   osiLP_->setColSetBounds(index, index + n, bounds);
+   collower_ = osiLP_->getColLower();
+   colupper_ = osiLP_->getColUpper();
+
+   delete [] index;
+   delete [] bounds;
+
+   lpSolverTime_.stop();
+}
+
 int ABA_OSIIF::_pivotSlackVariableIn(ABA_BUFFER<int> &rows)
 {
    master_->err() << "ABA_OSIIF::_getInfeas(): currently not available" << endl;
@@ -437,6 +538,8 @@ int ABA_OSIIF::_pivotSlackVariableIn(ABA_BUFFER<int> &rows)
 
 ABA_LP::OPTSTAT ABA_OSIIF::_primalSimplex()
 {
+   joinRace();
+
    lpSolverTime_.start();
 
    // switch the interface, if necessary
@@ -473,6 +576,8 @@ ABA_LP::OPTSTAT ABA_OSIIF::_primalSimplex()
 
 ABA_LP::OPTSTAT ABA_OSIIF::_dualSimplex()
 {
+   joinRace();
+
    lpSolverTime_.start();
 
    // switch the interface, if necessary
@@ -497,6 +602,7 @@ ABA_LP::OPTSTAT ABA_OSIIF::_dualSimplex()
 
    // The order is important here
    if (osiLP_->isProvenOptimal()) return Optimal;
+   if (osiLP_->isDualObjectiveLimitReached()) return LimitReached;
    if (osiLP_->isProvenPrimalInfeasible()) return Infeasible;
    if (osiLP_->isProvenDualInfeasible()) return Unbounded;
    else {
@@ -507,6 +613,150 @@ ABA_LP::OPTSTAT ABA_OSIIF::_dualSimplex()
    }
 }
 
+ABA_LP::OPTSTAT ABA_OSIIF::_race()
+{
+   joinRace();
+
+   lpSolverTime_.start();
+
+   // switch the interface, if necessary
+   if (currentSolverType_ != Exact){
+      currentSolverType_ = Exact;
+      osiLP_ = switchInterfaces(Exact);
+   }
+
+   // start the racing threads
+   /* The copy of the primal simplex method is forced to use the primal
+    *   simplex method also in \a initialSolve(). If no thread can be
+    *   started, we fall back to the primal simplex method.
+    */
+   OsiRace *race = new OsiRace;
+
+   pthread_mutex_init(&race->mutex, 0);
+   pthread_cond_init(&race->cond, 0);
+   race->winner = -1;
+
+   race->lp[0] = osiLP_->clone();
+   race->lp[1] = osiLP_->clone();
+   race->lp[0]->setHintParam(OsiDoDualInInitial, false, OsiHintDo);
+
+   int nStarted = 0;
+
+   for (int i = 0; i < 2; i++) {
+      OsiRacer *racer = new OsiRacer;
+
+      racer->race  = race;
+      racer->index = i;
+
+      race->started[i] = pthread_create(&race->thread[i], 0, osiRacer,
+                                        racer) == 0;
+      if (race->started[i]) ++nStarted;
+      else                  delete racer;
+   }
+
+   if (nStarted == 0) {
+      master_->err() << "WARNING: ABA_OSIIF::_race(): starting the racing ";
+      master_->err() << "threads failed, using primal simplex method." << endl;
+      delete race->lp[0];
+      delete race->lp[1];
+      pthread_cond_destroy(&race->cond);
+      pthread_mutex_destroy(&race->mutex);
+      delete race;
+      lpSolverTime_.stop();
+      return _primalSimplex();
+   }
+
+   // wait for the winner
+   /* The waiting thread hardly consumes cpu time, hence the elapsed time
+    *   of the race is added to the solver time. The copy of the winner
+    *   replaces the linear program, hence the pointers to the data of the
+    *   linear program have to be updated. The loser is joined by
+    *   \a joinRace(), the copy of a thread which could not be started is
+    *   deleted immediately.
+    */
+   ABA_COWTIMER raceTime(master_);
+
+   raceTime.start();
+   pthread_mutex_lock(&race->mutex);
+   while (race->winner == -1) pthread_cond_wait(&race->cond, &race->mutex);
+   const int winner = race->winner;
+   pthread_mutex_unlock(&race->mutex);
+   raceTime.stop();
+
+   pthread_join(race->thread[winner], 0);
+   race->started[winner] = false;
+
+   if (!race->started[1 - winner]) {
+      delete race->lp[1 - winner];
+      race->lp[1 - winner] = 0;
+   }
+
+   delete osiLP_;
+   osiLP_ = race->lp[winner];
+   race->lp[winner] = 0;
+   race_ = race;
+
+   rhs_ = osiLP_->getRightHandSide();
+   rowsense_ = osiLP_->getRowSense();
+   colupper_ = osiLP_->getColUpper();
+   collower_ = osiLP_->getColLower();
+   objcoeff_ = osiLP_->getObjCoefficients();
+
+   lpSolverTime_.stop();
+   lpSolverTime_.addCentiSeconds(raceTime.centiSeconds());
+
+   master_->out() << "LP race won by the ";
+   master_->out() << (winner == 0 ? "primal" : "dual") << " simplex method." << endl;
+
+   // check for solver statuses 
+   if (osiLP_->isAbandoned()){
+      master_->err() << "ABA_OSIIF::_race(): ";
+      master_->err() << "Warning: solver Interface reports status isAbandoned" << endl;
+      master_->err() << "There have been numerical difficulties, aborting...";
+      exit(Fatal);
+   }
+
+   // get information about the solution
+   getSol();
+
+   // The order is important here
+   if (osiLP_->isProvenOptimal()) return Optimal;
+   if (osiLP_->isDualObjectiveLimitReached()) return LimitReached;
+   if (osiLP_->isProvenPrimalInfeasible()) return Infeasible;
+   if (osiLP_->isProvenDualInfeasible()) return Unbounded;
+   else {
+      master_->err() << "ABA_OSIIF::_race(): ";
+      master_->err() << "unable to determine status of LP, aborting...";
+      exit(Fatal);
+      return Infeasible; //!< to suppress compiler warning
+   }
+}
+
+void ABA_OSIIF::joinRace()
+{
+   if (race_ == 0) return;
+
+   for (int i = 0; i < 2; i++) {
+      if (race_->started[i]) pthread_join(race_->thread[i], 0);
+      delete race_->lp[i];
+   }
+
+   pthread_cond_destroy(&race_->cond);
+   pthread_mutex_destroy(&race_->mutex);
+   delete race_;
+   race_ = 0;
+}
+
+int ABA_OSIIF::_nIterations()
+{
+   return osiLP_->getIterationCount();
+}
+
+bool ABA_OSIIF::_barrierAvailable()
+{
+   return false;
+}
+
 ABA_LP::OPTSTAT ABA_OSIIF::_barrier(bool doCrossover)
 {
       // The barrier method is not implemented in Osi.
@@ -518,6 +768,8 @@ ABA_LP::OPTSTAT ABA_OSIIF::_barrier(bool doCrossover)
 
 ABA_LP::OPTSTAT ABA_OSIIF::_approx()
 {
+   joinRace();
+
    lpSolverTime_.start();
 
    // switch the interface, if necessary
@@ -539,6 +791,7 @@ ABA_LP::OPTSTAT ABA_OSIIF::_approx()
 
    // get information about the solution
    getSol();
+   saveApprox();
 
    // The order is important here
    if (osiLP_->isProvenOptimal()) return Optimal;
@@ -568,6 +821,7 @@ ABA_OPTSENSE ABA_OSIIF::_sense() const
 
 void ABA_OSIIF::_sense(const ABA_OPTSENSE &newSense)
 {
+   discardStandby();
    if (newSense.unknown()) {
       master_->err() << "ABA_OSIIF::_sense: The objective sense can not be set to 'unknown' with OSI." << endl;
       exit(Fatal);
@@ -731,7 +985,8 @@ void ABA_OSIIF::getSol()
       recoStatus_ = Available;
    }
 
-   if( osiLP_->isProvenOptimal() || osiLP_->isIterationLimitReached() ) {
+   if( osiLP_->isProvenOptimal() || osiLP_->isIterationLimitReached() ||
+       osiLP_->isDualObjectiveLimitReached() ) {
       value_ = osiLP_->getObjValue();
       reco_ = osiLP_->getReducedCost();
       recoStatus_ = Available;
@@ -771,6 +1026,32 @@ int ABA_OSIIF::_getSimplexIterationLimit(int &limit)
    return(!osiLP_->getIntParam(OsiMaxNumIteration, limit));
 }
 
+int ABA_OSIIF::_setObjectiveLimit(double limit)
+{
+   // an infinite limit is passed to the solver as its own infinity
+   if (fabs(limit) >= master_->infinity())
+      limit = limit > 0.0 ? osiLP_->getInfinity() : -osiLP_->getInfinity();
+
+   return(!osiLP_->setDblParam(OsiDualObjectiveLimit, limit));
+}
+
+int ABA_OSIIF::_getDualRay(double *ray)
+{
+   lpSolverTime_.start();
+   std::vector<double*> rays = osiLP_->getDualRays(1);
+   lpSolverTime_.stop();
+
+   if (rays.empty()) return 1;
+
+   for (int i = 0; i < numRows_; i++)
+      ray[i] = rays[0][i];
+
+   for (unsigned r = 0; r < rays.size(); r++)
+      delete [] rays[r];
+
+   return 0;
+}
+
 double ABA_OSIIF::_xVal(int i)
 {
    return xVal_[i];
@@ -967,34 +1248,66 @@ OsiSolverInterface* ABA_OSIIF::getDefaultInterface()
 
 OsiSolverInterface* ABA_OSIIF::switchInterfaces(SOLVERTYPE newMethod) 
 {
-   OsiSolverInterface *s2 = NULL;
-   if( newMethod == Exact ) 
-      s2 = getDefaultInterface();
-   else
+   // the solution of the current interface belongs to the linear program
+   // only if the linear program has not been modified after solving it
+   const bool solved = xValStatus_ == Available && yValStatus_ == Available;
+
+   // reuse the interface kept by the last switch: it holds the same
+   // linear program and the matrix need not be copied
+   OsiSolverInterface *s2 = standbyLP_;
+   standbyLP_ = NULL;
+
+   if (s2 == NULL) {
+      if( newMethod == Exact ) 
+         s2 = getDefaultInterface();
+      else
 #ifdef OSI_VOL
-      // TODO switchInterfaces
-      // s2 = getApproxInterface()
-      s2 = new OsiVolSolverInterface;
+         // TODO switchInterfaces
+         // s2 = getApproxInterface()
+         s2 = new OsiVolSolverInterface;
 #else
-      master_->err() << "ABACUS has not been compiled with support for the Volume Algorithm, cannot switch to approximate solver." << endl;
-      exit(Fatal);
+         master_->err() << "ABACUS has not been compiled with support for the Volume Algorithm, cannot switch to approximate solver." << endl;
+         exit(Fatal);
 #endif
-   
-   s2->messageHandler()->setLogLevel(0);
-   master_->setSolverParameters(s2, currentSolverType());
 
-   if (currentSolverType() == Exact && numRows_ == 0 && master_->defaultLpSolver() == ABA_MASTER::CPLEX) {
-      loadDummyRow(s2, osiLP_->getColLower(), osiLP_->getColUpper(), osiLP_->getObjCoefficients());
-   }
-   else {
-      s2->loadProblem(*osiLP_->getMatrixByCol(), osiLP_->getColLower(),
-	    osiLP_->getColUpper(), osiLP_->getObjCoefficients(),
-	    osiLP_->getRowLower(), osiLP_->getRowUpper());
+      s2->messageHandler()->setLogLevel(0);
+      master_->setSolverParameters(s2, currentSolverType());
+
+      if (currentSolverType() == Exact && numRows_ == 0 && master_->defaultLpSolver() == ABA_MASTER::CPLEX) {
+         loadDummyRow(s2, osiLP_->getColLower(), osiLP_->getColUpper(), osiLP_->getObjCoefficients());
+      }
+      else {
+         s2->loadProblem(*osiLP_->getMatrixByCol(), osiLP_->getColLower(),
+	       osiLP_->getColUpper(), osiLP_->getObjCoefficients(),
+	       osiLP_->getRowLower(), osiLP_->getRowUpper());
+      }
+
+      s2->setObjSense(osiLP_->getObjSense());
+
+      // warm start the new interface with the solution of the approximate
+      // solver: the exact solver with a crash basis, which also covers
+      // the rows and columns added since the approximate solution has been
+      // computed, the approximate solver with the dual values
+      if (newMethod == Exact) {
+         if (approxX_) crashBasis(s2);
+      }
+      else if (solved)
+         s2->setRowPrice(osiLP_->getRowPrice());
    }
-  
-   s2->setObjSense(osiLP_->getObjSense());
-   
-   delete osiLP_;
+
+   if (newMethod == Exact) discardApprox();
+
+   // the limits may have been changed since the interface was used last
+   double dblParam;
+   int    intParam;
+
+   if (osiLP_->getDblParam(OsiDualObjectiveLimit, dblParam))
+      s2->setDblParam(OsiDualObjectiveLimit, dblParam);
+   if (osiLP_->getIntParam(OsiMaxNumIteration, intParam))
+      s2->setIntParam(OsiMaxNumIteration, intParam);
+
+   // keep the old interface for the next switch
+   standbyLP_ = osiLP_;
 
    // get the pointers to the solution, reduced costs etc.
    rhs_ = s2->getRightHandSide();
@@ -1009,6 +1322,159 @@ OsiSolverInterface* ABA_OSIIF::switchInterfaces(SOLVERTYPE newMethod)
    return s2;
 }
 
+void ABA_OSIIF::discardStandby()
+{
+   delete standbyLP_;
+   standbyLP_ = NULL;
+}
+
+void ABA_OSIIF::saveApprox()
+{
+   discardApprox();
+
+   if (xValStatus_ != Available || yValStatus_ != Available) return;
+
+   approxNCol_ = numCols_;
+   approxNRow_ = numRows_;
+   approxX_    = new double[approxNCol_ > 0 ? approxNCol_ : 1];
+   approxY_    = new double[approxNRow_ > 0 ? approxNRow_ : 1];
+
+   for (int j = 0; j < approxNCol_; j++) approxX_[j] = xVal_[j];
+   for (int i = 0; i < approxNRow_; i++) approxY_[i] = yVal_[i];
+}
+
+void ABA_OSIIF::discardApprox()
+{
+   delete [] approxX_;
+   delete [] approxY_;
+   approxX_ = approxY_ = 0;
+   approxNCol_ = approxNRow_ = 0;
+}
+
+void ABA_OSIIF::crashBasis(OsiSolverInterface *exact)
+{
+   const int nCol = exact->getNumCols();
+   const int nRow = exact->getNumRows();
+   const double *lb = exact->getColLower();
+   const double *ub = exact->getColUpper();
+   const double inf = exact->getInfinity();
+   const double eps = master_->eps();
+
+   if (approxX_ == 0 || nRow == 0) return;
+
+   // rows and columns can only have been appended to the linear program
+   if (approxNCol_ > nCol || approxNRow_ > nRow) return;
+
+   CoinWarmStartBasis *ws = new CoinWarmStartBasis();
+   ws->setSize(nCol, nRow);
+
+   ABA_ARRAY<int> cand(master_, nCol > nRow ? nCol : nRow);
+   ABA_ARRAY<double> key(master_, nCol > nRow ? nCol : nRow);
+   ABA_BUFFER<int> freeBasic(master_, nCol > 0 ? nCol : 1);
+   int nCand = 0;
+   int nBasic = 0;
+
+   // structural variables: a variable strictly between its bounds is basic,
+   // the others are candidates for leaving the basis, sorted by the
+   // distance to the closest finite bound; the columns added after the
+   // approximate solution has been computed are nonbasic
+   for (int j = 0; j < nCol; j++) {
+      if (j >= approxNCol_) {
+	 if (lb[j] > -inf)
+	    ws->setStructStatus(j, lpVarStat2osi(ABA_LPVARSTAT::AtLowerBound));
+	 else if (ub[j] < inf)
+	    ws->setStructStatus(j, lpVarStat2osi(ABA_LPVARSTAT::AtUpperBound));
+	 else
+	    ws->setStructStatus(j, lpVarStat2osi(ABA_LPVARSTAT::NonBasicFree));
+	 continue;
+      }
+
+      const double x = approxX_[j];
+      const double dLb = lb[j] > -inf ? x - lb[j] : inf;
+      const double dUb = ub[j] < inf ? ub[j] - x : inf;
+
+      if (dLb <= eps*(1.0 + fabs(lb[j])))
+	 ws->setStructStatus(j, lpVarStat2osi(ABA_LPVARSTAT::AtLowerBound));
+      else if (dUb <= eps*(1.0 + fabs(ub[j])))
+	 ws->setStructStatus(j, lpVarStat2osi(ABA_LPVARSTAT::AtUpperBound));
+      else {
+	 ws->setStructStatus(j, lpVarStat2osi(ABA_LPVARSTAT::Basic));
+	 ++nBasic;
+	 if (dLb < inf || dUb < inf) {
+	    cand[nCand] = j;
+	    key[nCand] = dLb < dUb ? dLb : dUb;
+	    ++nCand;
+	 }
+	 else
+	    freeBasic.push(j);
+      }
+   }
+
+   // the slack variables of the added rows are basic
+   for (int i = approxNRow_; i < nRow; i++) {
+      ws->setArtifStatus(i, slackStat2osi(ABA_SLACKSTAT::Basic));
+      ++nBasic;
+   }
+
+   ABA_SORTER<int, double> sorter(master_);
+
+   if (nBasic > nRow) {
+      if (nCand > 1) sorter.quickSort(nCand, cand, key);
+      for (int i = 0; i < nCand && nBasic > nRow; i++) {
+	 const int j = cand[i];
+	 if (approxX_[j] - lb[j] <= ub[j] - approxX_[j])
+	    ws->setStructStatus(j, lpVarStat2osi(ABA_LPVARSTAT::AtLowerBound));
+	 else
+	    ws->setStructStatus(j, lpVarStat2osi(ABA_LPVARSTAT::AtUpperBound));
+	 --nBasic;
+      }
+   }
+
+   // free structural variables leave the basis as nonbasic free variables
+   for (int i = 0; i < freeBasic.number() && nBasic > nRow; i++) {
+      ws->setStructStatus(freeBasic[i], lpVarStat2osi(ABA_LPVARSTAT::NonBasicFree));
+      --nBasic;
+   }
+
+   // slack variables: the basis is completed with the slacks of the
+   // constraints with the smallest absolute dual values
+   const int nOldRow = approxNRow_;
+
+   for (int i = 0; i < nOldRow; i++) {
+      cand[i] = i;
+      key[i] = fabs(approxY_[i]);
+      ws->setArtifStatus(i, slackStat2osi(ABA_SLACKSTAT::NonBasicZero));
+   }
+   if (nOldRow > 1) sorter.quickSort(nOldRow, cand, key);
+
+   for (int i = 0; i < nOldRow && nBasic < nRow; i++) {
+      ws->setArtifStatus(cand[i], slackStat2osi(ABA_SLACKSTAT::Basic));
+      ++nBasic;
+   }
+
+   // check the basis
+   /* The solvers do not necessarily repair a basis with a wrong number of
+    *   basic variables, hence such a basis is not loaded and the exact
+    *   solver starts from its default basis.
+    */
+   int nBasis = 0;
+
+   for (int j = 0; j < nCol; j++)
+      if (ws->getStructStatus(j) == CoinWarmStartBasis::basic) ++nBasis;
+   for (int i = 0; i < nRow; i++)
+      if (ws->getArtifStatus(i) == CoinWarmStartBasis::basic) ++nBasis;
+
+   if (nBasis == nRow)
+      exact->setWarmStart(dynamic_cast<CoinWarmStart *>(ws));
+   else {
+      master_->err() << "WARNING: ABA_OSIIF::crashBasis(): the crash basis ";
+      master_->err() << "is not loaded, it has " << nBasis;
+      master_->err() << " basic variables and " << nRow << " rows." << endl;
+   }
+
+   delete ws;
+}
+
 void ABA_OSIIF::loadDummyRow(OsiSolverInterface* s2, const double* lbounds, const double* ubounds, const double* objectives)
 {
    CoinPackedVector *coinrow = new CoinPackedVector();
@@ -0,0 +1,421 @@
+/*!\file
+ * \author The ABACUS developers
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#include "abacus/propagator.h"
+#include "abacus/master.h"
+#include "abacus/sub.h"
+#include "abacus/row.h"
+#include "abacus/lpsub.h"
+#include "abacus/constraint.h"
+#include "abacus/variable.h"
+
+#include <math.h>
+
+// the number of row visits per nonzero in one call of propagate()
+  static const int workFactor = 20;
+
+  ABA_PROPAGATOR::ABA_PROPAGATOR(ABA_MASTER *master, ABA_SUB *sub)
+  :
+    master_(master),
+    sub_(sub),
+    cons_(master, 1),
+    vars_(master, 1),
+    nRow_(0),
+    rowBeg_(master, 1),
+    rowVar_(master, 1),
+    rowCoeff_(master, 1),
+    colBeg_(master, 1),
+    colRow_(master, 1),
+    colCoeff_(master, 1),
+    sense_(master, 1),
+    rhs_(master, 1),
+    minAct_(master, 1),
+    maxAct_(master, 1),
+    minInf_(master, 1),
+    maxInf_(master, 1),
+    lBound_(master, 1),
+    uBound_(master, 1),
+    queue_(master, 1),
+    inQueue_(master, 1),
+    nTightened_(0)
+  {
+    build();
+  }
+
+  ABA_PROPAGATOR::~ABA_PROPAGATOR()
+  { }
+
+  int ABA_PROPAGATOR::propagate(bool &newValues)
+  {
+    newValues   = false;
+    nTightened_ = 0;
+
+// take the changes of the subproblem into account
+/* If constraints or variables have been added or removed, the rows are
+ *   generated again. Otherwise, only the activities of the constraints
+ *   containing variables with changed bounds are updated.
+ */
+  if (changed()) build();
+  else {
+    const int nVariables = vars_.size();
+    for (int j = 0; j < nVariables; j++) update(j);
+  }
+
+// process the queue
+/* The work is limited, since the bounds of general integer variables
+ *   might be tightened by one unit per constraint only. Rows which
+ *   have not been processed stay in the queue for the next call.
+ */
+  const int maxWork = workFactor*(rowBeg_[nRow_] + nRow_);
+  int       work    = 0;
+  bool      lNewValues;
+
+  while (!queue_.empty() && work <= maxWork) {
+    const int r = queue_.pop();
+    inQueue_[r] = false;
+
+    if (propagateRow(r, lNewValues)) {
+      while (!queue_.empty()) inQueue_[queue_.pop()] = false;
+      return 1;
+    }
+    if (lNewValues) newValues = true;
+
+    work += rowBeg_[r + 1] - rowBeg_[r] + 1;
+  }
+
+  return 0;
+  }
+
+  void ABA_PROPAGATOR::build()
+  {
+    const int nConstraints = sub_->nCon();
+    const int nVariables   = sub_->nVar();
+
+    if (cons_.size() != nConstraints) cons_.realloc(nConstraints);
+    if (vars_.size() != nVariables)   vars_.realloc(nVariables);
+
+    int i;
+    for (i = 0; i < nConstraints; i++) cons_[i] = sub_->constraint(i);
+    for (i = 0; i < nVariables; i++)   vars_[i] = sub_->variable(i);
+
+// generate the rows of the constraints given by an explicit row
+  if (rowBeg_.size() < nConstraints + 1) {
+    rowBeg_.realloc(nConstraints + 1);
+    sense_.realloc(nConstraints);
+    rhs_.realloc(nConstraints);
+  }
+
+  ABA_ROW row(master_, nVariables);
+  int     nnz = 0;
+
+  nRow_      = 0;
+  rowBeg_[0] = 0;
+
+  for (i = 0; i < nConstraints; i++) {
+    if (!cons_[i]->explicitRow()) continue;
+
+    const int rowNnz = cons_[i]->genRow(sub_->actVar(), row);
+
+    if (rowVar_.size() < nnz + rowNnz) {
+      rowVar_.realloc(2*(nnz + rowNnz));
+      rowCoeff_.realloc(2*(nnz + rowNnz));
+    }
+
+    for (int k = 0; k < rowNnz; k++) {
+      rowVar_[nnz]   = row.support(k);
+      rowCoeff_[nnz] = row.coeff(k);
+      ++nnz;
+    }
+
+    sense_[nRow_] = row.sense()->sense();
+    rhs_[nRow_]   = row.rhs();
+    ++nRow_;
+    rowBeg_[nRow_] = nnz;
+    row.clear();
+  }
+
+// generate the columns
+/* First the nonzeros of each column are counted. While the columns are
+ *   filled, \a colBeg_[j] is the next free position of column \a j.
+ */
+  if (colBeg_.size() < nVariables + 1) colBeg_.realloc(nVariables + 1);
+  if (colRow_.size() < nnz) {
+    colRow_.realloc(rowVar_.size());
+    colCoeff_.realloc(rowVar_.size());
+  }
+
+  for (i = 0; i <= nVariables; i++) colBeg_[i] = 0;
+  for (i = 0; i < nnz; i++) ++colBeg_[rowVar_[i] + 1];
+  for (i = 0; i < nVariables; i++) colBeg_[i + 1] += colBeg_[i];
+
+  for (int r = 0; r < nRow_; r++)
+    for (int k = rowBeg_[r]; k < rowBeg_[r + 1]; k++) {
+      const int pos = colBeg_[rowVar_[k]]++;
+      colRow_[pos]   = r;
+      colCoeff_[pos] = rowCoeff_[k];
+    }
+
+  for (i = nVariables; i > 0; i--) colBeg_[i] = colBeg_[i - 1];
+  colBeg_[0] = 0;
+
+// compute the activities and add all rows to the queue
+  if (lBound_.size() < nVariables) {
+    lBound_.realloc(nVariables);
+    uBound_.realloc(nVariables);
+  }
+
+  for (i = 0; i < nVariables; i++) {
+    lBound_[i] = sub_->lBound(i);
+    uBound_[i] = sub_->uBound(i);
+  }
+
+  if (minAct_.size() < nRow_) {
+    minAct_.realloc(nConstraints);
+    maxAct_.realloc(nConstraints);
+    minInf_.realloc(nConstraints);
+    maxInf_.realloc(nConstraints);
+    inQueue_.realloc(nConstraints);
+  }
+  if (queue_.size() < nRow_) queue_.realloc(nConstraints);
+
+  queue_.clear();
+  for (int r = 0; r < nRow_; r++) {
+    activity(r);
+    queue_.push(r);
+    inQueue_[r] = true;
+  }
+  }
+
+  bool ABA_PROPAGATOR::changed() const
+  {
+    const int nConstraints = sub_->nCon();
+    const int nVariables   = sub_->nVar();
+
+    if (nConstraints != cons_.size() || nVariables != vars_.size()) return true;
+
+    int i;
+    for (i = 0; i < nConstraints; i++)
+      if (sub_->constraint(i) != cons_[i]) return true;
+    for (i = 0; i < nVariables; i++)
+      if (sub_->variable(i) != vars_[i]) return true;
+
+    return false;
+  }
+
+  void ABA_PROPAGATOR::update(int j)
+  {
+    const double lb = sub_->lBound(j);
+    const double ub = sub_->uBound(j);
+
+    if (lb == lBound_[j] && ub == uBound_[j]) return;
+
+    const int last = colBeg_[j + 1];
+
+    for (int k = colBeg_[j]; k < last; k++) {
+      const int r = colRow_[k];
+      contribute(r, colCoeff_[k], lBound_[j], uBound_[j], -1);
+      contribute(r, colCoeff_[k], lb, ub, 1);
+      if (!inQueue_[r]) {
+        queue_.push(r);
+        inQueue_[r] = true;
+      }
+    }
+
+    lBound_[j] = lb;
+    uBound_[j] = ub;
+  }
+
+  void ABA_PROPAGATOR::activity(int r)
+  {
+    minAct_[r] = 0.0;
+    maxAct_[r] = 0.0;
+    minInf_[r] = 0;
+    maxInf_[r] = 0;
+
+    const int last = rowBeg_[r + 1];
+
+    for (int k = rowBeg_[r]; k < last; k++)
+      contribute(r, rowCoeff_[k], lBound_[rowVar_[k]], uBound_[rowVar_[k]], 1);
+  }
+
+  void ABA_PROPAGATOR::contribute(int r, double a, double lb, double ub, int sign)
+  {
+    const double inf = master_->infinity();
+    const double lo  = a > 0.0 ? lb : ub;
+    const double hi  = a > 0.0 ? ub : lb;
+
+    if (fabs(lo) >= inf) minInf_[r] += sign;
+    else                 minAct_[r] += sign*a*lo;
+
+    if (fabs(hi) >= inf) maxInf_[r] += sign;
+    else                 maxAct_[r] += sign*a*hi;
+  }
+
+  int ABA_PROPAGATOR::propagateRow(int r, bool &newValues)
+  {
+    const double eps  = master_->eps();
+    const double inf  = master_->infinity();
+    const double rhs  = rhs_[r];
+    const bool   less = sense_[r] != ABA_CSENSE::Greater;
+    const bool   grt  = sense_[r] != ABA_CSENSE::Less;
+
+    newValues = false;
+
+// check the feasibility of the constraint
+/* Before a contradiction is reported, the activities are computed from
+ *   scratch, since the incremental updates accumulate rounding errors.
+ */
+  if ((less && minInf_[r] == 0 && minAct_[r] > rhs + eps) ||
+      (grt  && maxInf_[r] == 0 && maxAct_[r] < rhs - eps)) {
+    activity(r);
+    if ((less && minInf_[r] == 0 && minAct_[r] > rhs + eps) ||
+        (grt  && maxInf_[r] == 0 && maxAct_[r] < rhs - eps))
+      return 1;
+  }
+
+  if ((!less || minInf_[r] > 1) && (!grt || maxInf_[r] > 1)) return 0;
+
+// derive bounds of the discrete variables
+/* The minimal activity of the constraint without variable \a j is
+ *   finite if either all contributions are finite or the only infinite
+ *   contribution is the one of variable \a j. The same holds for the
+ *   maximal activity.
+ */
+  bool lNewValues;
+  const int last = rowBeg_[r + 1];
+
+  for (int k = rowBeg_[r]; k < last; k++) {
+    const int j = rowVar_[k];
+
+    if (lBound_[j] == uBound_[j] || !vars_[j]->discrete()) continue;
+
+    const double a = rowCoeff_[k];
+    double       rest;
+
+    if (less) {
+      const double lo = a > 0.0 ? lBound_[j] : uBound_[j];
+      bool         finite;
+
+      if (fabs(lo) >= inf) {
+        finite = minInf_[r] == 1;
+        rest   = minAct_[r];
+      }
+      else {
+        finite = minInf_[r] == 0;
+        rest   = minAct_[r] - a*lo;
+      }
+
+      if (finite) {
+        if (tighten(j, a > 0.0, (rhs - rest)/a, lNewValues)) return 1;
+        if (lNewValues) newValues = true;
+      }
+    }
+
+    if (grt) {
+      const double hi = a > 0.0 ? uBound_[j] : lBound_[j];
+      bool         finite;
+
+      if (fabs(hi) >= inf) {
+        finite = maxInf_[r] == 1;
+        rest   = maxAct_[r];
+      }
+      else {
+        finite = maxInf_[r] == 0;
+        rest   = maxAct_[r] - a*hi;
+      }
+
+      if (finite) {
+        if (tighten(j, a < 0.0, (rhs - rest)/a, lNewValues)) return 1;
+        if (lNewValues) newValues = true;
+      }
+    }
+  }
+
+  return 0;
+  }
+
+  int ABA_PROPAGATOR::tighten(int j, bool upper, double x, bool &newValues)
+  {
+    const double eps = master_->eps();
+    const double lb  = sub_->lBound(j);
+    const double ub  = sub_->uBound(j);
+
+    newValues = false;
+
+    if (fabs(x) >= master_->infinity()) return 0;
+
+// round the new bound
+/* A bound is only changed if it is improved by at least one, which also
+ *   guarantees that the propagation terminates. If the new bound equals
+ *   the other bound, the variable is set, such that the setting is
+ *   inherited by the sons of the subproblem and the variable can be
+ *   eliminated from the linear program.
+ */
+  double newBound;
+  int    contra = 0;
+
+  if (upper) {
+    newBound = floor(x + eps);
+    if (newBound > ub - 1.0 + eps) return 0;
+    if (newBound < lb - eps)       return 1;
+
+    if (newBound < lb + eps)
+      contra = sub_->set(j, ABA_FSVARSTAT::SetToLowerBound, newValues);
+    else {
+      (*sub_->uBound_)[j] = newBound;
+      if (sub_->lp_) {
+        if (!sub_->lp_->eliminated(j)) sub_->lp_->changeUBound(j, newBound);
+        if (sub_->xVal_[j] > newBound + eps) newValues = true;
+      }
+    }
+  }
+  else {
+    newBound = ceil(x - eps);
+    if (newBound < lb + 1.0 - eps) return 0;
+    if (newBound > ub + eps)       return 1;
+
+    if (newBound > ub - eps)
+      contra = sub_->set(j, ABA_FSVARSTAT::SetToUpperBound, newValues);
+    else {
+      (*sub_->lBound_)[j] = newBound;
+      if (sub_->lp_) {
+        if (!sub_->lp_->eliminated(j)) sub_->lp_->changeLBound(j, newBound);
+        if (sub_->xVal_[j] < newBound - eps) newValues = true;
+      }
+    }
+  }
+
+  if (contra) return 1;
+
+  ++nTightened_;
+  update(j);
+
+  return 0;
+  }
@@ -29,9 +29,7 @@
 #include "abacus/row.h"
 #include "abacus/global.h"
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
 
   ABA_ROW::ABA_ROW(ABA_GLOBAL *glob, 
                    int nnz,
@@ -76,9 +74,7 @@
   {}
     
 
-#ifdef ABACUS_PARALLEL
-
-  ABA_ROW::ABA_ROW(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+  ABA_ROW::ABA_ROW(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
     :  
     ABA_SPARVEC(glob, msg),  
     sense_(glob, msg)
@@ -93,8 +89,6 @@
     msg.pack(rhs_);
   }
 
-#endif
-
   ostream &operator<<(ostream& out, const ABA_ROW &rhs)
   {
     int    s;
@@ -133,6 +127,20 @@
     ABA_SPARVEC::copy(row);
   }
 
+  void ABA_ROW::swap(ABA_ROW &row)
+  {
+    ABA_CSENSE sense = sense_;
+    double     rhs   = rhs_;
+
+    sense_ = row.sense_;
+    rhs_   = row.rhs_;
+
+    row.sense_ = sense;
+    row.rhs_   = rhs;
+
+    ABA_SPARVEC::swap(row);
+  }
+
   void ABA_ROW::delInd(ABA_BUFFER<int> &buf, double rhsDelta)
   {
     leftShift(buf);
@@ -29,6 +29,7 @@
 #include "abacus/rowcon.h"
 #include "abacus/master.h"
 #include "abacus/numvar.h"
+#include "abacus/active.h"
 
   ABA_ROWCON::ABA_ROWCON(ABA_MASTER *master, 
                          const ABA_SUB *sub, 
@@ -64,9 +65,7 @@
   { }
 
 
-#ifdef ABACUS_PARALLEL
-
-  ABA_ROWCON::ABA_ROWCON(const ABA_MASTER *master, ABA_MESSAGE &msg)
+  ABA_ROWCON::ABA_ROWCON(ABA_MASTER *master, ABA_MESSAGE &msg)
   :  
     ABA_CONSTRAINT(master, msg),  
     row_(master, msg)
@@ -83,7 +82,10 @@
     return ROWCON_CLASSID;
   }
 
-#endif
+  bool ABA_ROWCON::explicitRow() const
+  {
+    return true;
+  }
 
   double ABA_ROWCON::coeff(ABA_VARIABLE *v)
   {
@@ -91,6 +93,43 @@
     return row_.origCoeff(numVar->number());
   }
 
+  double ABA_ROWCON::slack(ABA_ACTIVE<ABA_VARIABLE, ABA_CONSTRAINT> *variables,
+                           double *x)
+  {
+    // store \a x by the numbers of the variables
+    /* The support of \a row_ refers to the numbers of the variables,
+     *   whereas \a x is indexed by the positions of the active variables.
+     *   Variables that are not active have value 0. The dense vector is
+     *   the scratch vector of the master, which is reset to 0 afterwards,
+     *   such that nothing is allocated for the many calls of a separation
+     *   round.
+     */
+    const int n    = variables->number();
+    const int nnz  = row_.nnz();
+    int       size = 0;
+    int       i;
+
+    for (i = 0; i < n; i++) {
+      const int number = ((ABA_NUMVAR *) (*variables)[i])->number();
+      if (number >= size) size = number + 1;
+    }
+
+    for (i = 0; i < nnz; i++)
+      if (row_.support(i) >= size) size = row_.support(i) + 1;
+
+    double *xByNumber = master_->zeroScratch(size);
+
+    for (i = 0; i < n; i++)
+      xByNumber[((ABA_NUMVAR *) (*variables)[i])->number()] = x[i];
+
+    const double lhs = row_.dot(xByNumber);
+
+    for (i = 0; i < n; i++)
+      xByNumber[((ABA_NUMVAR *) (*variables)[i])->number()] = 0.0;
+
+    return rhs() - lhs;
+  }
+
   void ABA_ROWCON::print(ostream &out)
   {
     out << row_;
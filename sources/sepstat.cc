@@ -0,0 +1,219 @@
+/*!\file
+ * \author The ABACUS developers
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#include "abacus/sepstat.h"
+#include "abacus/master.h"
+
+#include <iomanip>
+
+  ABA_SEPSTAT::ABA_SEPSTAT(ABA_MASTER *master)
+  :
+    master_(master),
+    nSeparators_(FirstUser),
+    startTime_(master, FirstUser, 0),
+    startCuts_(master, FirstUser, 0),
+    nCalls_(master, FirstUser, 0),
+    nCuts_(master, FirstUser, 0),
+    centiSeconds_(master, FirstUser, 0),
+    gain_(master, FirstUser, 0.0),
+    rootCentiSeconds_(master, FirstUser, 0),
+    rootGain_(master, FirstUser, 0.0),
+    roundCuts_(master, FirstUser, 0),
+    name_(master, FirstUser, 0),
+    roundTotal_(0),
+    rootTime_(0),
+    rootGainTotal_(0.0)
+  {
+    name_[Pool] = "Pool";
+  }
+
+  ABA_SEPSTAT::~ABA_SEPSTAT()
+  { }
+
+  ostream &operator<<(ostream &out, const ABA_SEPSTAT &rhs)
+  {
+    const int w1 = 10;  //!< width of the column of the separator
+    const int w  = 12;  //!< width of the other columns
+
+    out << "Separator Statistics" << endl << endl;
+    out << setw(w1) << "Separator" << setw(w) << "#Calls";
+    out << setw(w) << "#Cuts" << setw(w) << "Time";
+    out << setw(w) << "Gain (%)" << setw(w) << "Root Gain/s" << endl;
+
+    for (int s = 0; s < rhs.nSeparators_; s++)
+      if (rhs.nCalls_[s]) {
+        if (rhs.name_[s]) out << setw(w1) << rhs.name_[s];
+        else              out << setw(w1) << s;
+        out << setw(w) << rhs.nCalls_[s];
+        out << setw(w) << rhs.nCuts_[s];
+        out << setw(w) << rhs.centiSeconds_[s]/100.0;
+        out << setw(w) << rhs.gain_[s];
+        out << setw(w) << ABA_SEPSTAT::rate(rhs.rootGain_[s],
+                                            rhs.rootCentiSeconds_[s]);
+        out << endl;
+      }
+
+    out << setw(w1) << "Root" << setw(3*w) << rhs.rootTime_/100.0;
+    out << setw(w) << rhs.rootGainTotal_ << setw(w) << rhs.rootRate() << endl;
+
+    return out;
+  }
+
+  void ABA_SEPSTAT::registerSeparator(int separator, const char *name)
+  {
+    if (separator < FirstUser) {
+      master_->err() << "ABA_SEPSTAT::registerSeparator(): separator ";
+      master_->err() << separator << " is reserved." << endl;
+      exit(Fatal);
+    }
+
+    if (separator >= nSeparators_) realloc(separator);
+
+    name_[separator] = name;
+  }
+
+  const char *ABA_SEPSTAT::name(int separator) const
+  {
+    if (separator >= nSeparators_) return 0;
+    return name_[separator];
+  }
+
+  void ABA_SEPSTAT::start(int separator, int nBuffered)
+  {
+    if (separator >= nSeparators_) realloc(separator);
+
+    startTime_[separator] = master_->totalTime()->centiSeconds();
+    startCuts_[separator] = nBuffered;
+  }
+
+  void ABA_SEPSTAT::stop(int separator, int nBuffered, bool root)
+  {
+    const long centiSeconds = master_->totalTime()->centiSeconds()
+                              - startTime_[separator];
+    const int  nCuts        = nBuffered - startCuts_[separator];
+
+    ++nCalls_[separator];
+    nCuts_[separator]        += nCuts;
+    centiSeconds_[separator] += centiSeconds;
+    roundCuts_[separator]    += nCuts;
+    if (root) rootCentiSeconds_[separator] += centiSeconds;
+  }
+
+  void ABA_SEPSTAT::round(int nCuts)
+  {
+    roundTotal_ += nCuts;
+  }
+
+  void ABA_SEPSTAT::attribute(double gain, long centiSeconds, bool root)
+  {
+    if (root) {
+      rootGainTotal_ += gain;
+      rootTime_      += centiSeconds;
+    }
+
+// distribute the gain among the separators
+/* The separators may be nested, e.g., the pool separation is called within
+ *   ABA_SUB::separate(), hence the share of a separator refers to all
+ *   cutting planes of the round and not to the sum over the separators.
+ */
+    int total = roundTotal_;
+
+    for (int s = 0; s < nSeparators_; s++)
+      if (roundCuts_[s] > total) total = roundCuts_[s];
+
+    if (total > 0)
+      for (int s = 0; s < nSeparators_; s++)
+        if (roundCuts_[s]) {
+          const double share = gain*roundCuts_[s]/total;
+          gain_[s] += share;
+          if (root) rootGain_[s] += share;
+        }
+
+    clearRound();
+  }
+
+  void ABA_SEPSTAT::clearRound()
+  {
+    for (int s = 0; s < nSeparators_; s++)
+      roundCuts_[s] = 0;
+    roundTotal_ = 0;
+  }
+
+  double ABA_SEPSTAT::rootRate() const
+  {
+    if (!rootTime_ && rootGainTotal_ == 0.0) return 0.0;
+    return rate(rootGainTotal_, rootTime_);
+  }
+
+  bool ABA_SEPSTAT::profitable(int separator, double share) const
+  {
+    if (separator >= nSeparators_ || !rootCentiSeconds_[separator])
+      return true;
+
+    return rate(rootGain_[separator], rootCentiSeconds_[separator])
+           >= share*rootRate();
+  }
+
+  double ABA_SEPSTAT::rate(double gain, long centiSeconds)
+  {
+    if (centiSeconds < 1) centiSeconds = 1;
+    return gain*100.0/centiSeconds;
+  }
+
+  void ABA_SEPSTAT::realloc(int separator)
+  {
+    const int newSize = separator + 1;
+
+    startTime_.realloc(newSize);
+    startCuts_.realloc(newSize);
+    nCalls_.realloc(newSize);
+    nCuts_.realloc(newSize);
+    centiSeconds_.realloc(newSize);
+    gain_.realloc(newSize);
+    rootCentiSeconds_.realloc(newSize);
+    rootGain_.realloc(newSize);
+    roundCuts_.realloc(newSize);
+    name_.realloc(newSize);
+
+    for (int s = nSeparators_; s < newSize; s++) {
+      startTime_[s]        = 0;
+      startCuts_[s]        = 0;
+      nCalls_[s]           = 0;
+      nCuts_[s]            = 0;
+      centiSeconds_[s]     = 0;
+      gain_[s]             = 0.0;
+      rootCentiSeconds_[s] = 0;
+      rootGain_[s]         = 0.0;
+      roundCuts_[s]        = 0;
+      name_[s]             = 0;
+    }
+
+    nSeparators_ = newSize;
+  }
@@ -31,9 +31,7 @@
 #include "abacus/sub.h"
 #include "abacus/lpsub.h"
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
 
   ABA_SETBRANCHRULE::ABA_SETBRANCHRULE(ABA_MASTER *master, 
                                        int variable, 
@@ -47,9 +45,7 @@
   ABA_SETBRANCHRULE::~ABA_SETBRANCHRULE()
   { }
 
-#ifdef ABACUS_PARALLEL
-
-  ABA_SETBRANCHRULE::ABA_SETBRANCHRULE(const ABA_MASTER *master, ABA_MESSAGE &msg)
+  ABA_SETBRANCHRULE::ABA_SETBRANCHRULE(ABA_MASTER *master, ABA_MESSAGE &msg)
     :  
     ABA_BRANCHRULE(master, msg)
   {
@@ -71,8 +67,6 @@
     return SETBRANCHRULE_CLASSID;
   }
 
-#endif
-
   ostream &operator<<(ostream &out, const ABA_SETBRANCHRULE &rhs)
   {
     return out << "x" << rhs.variable_ << " = " << (int) rhs.status_;
@@ -29,13 +29,9 @@
 #include "abacus/slackstat.h"
 #include "abacus/global.h"
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
 
-#ifdef ABACUS_PARALLEL
-
-  ABA_SLACKSTAT::ABA_SLACKSTAT(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+  ABA_SLACKSTAT::ABA_SLACKSTAT(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
     :  
     glob_(glob)
   {
@@ -47,8 +43,6 @@
     msg.pack((int)status_);
   }
 
-#endif
-
   ostream &operator<<(ostream &out, const ABA_SLACKSTAT &rhs)
   {
     switch (rhs.status_) {
@@ -29,10 +29,10 @@
 #include "abacus/sparvec.h"
 
 #include <math.h>
+#include <string.h>
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
+#include "abacus/trivialcopy.h"
 
   ABA_SPARVEC::ABA_SPARVEC(ABA_GLOBAL *glob, 
                            int size, 
@@ -76,9 +76,9 @@
       
     nnz_ = size < s.size() ? size : s.size();
     
-    for(int i = 0; i < nnz_; i++) {
-      support_[i] = s[i];
-      coeff_[i]   = c[i];
+    if (nnz_) {
+      ABA_ELEMENTCOPY<int>::copy(support_, &s[0], nnz_);
+      ABA_ELEMENTCOPY<double>::copy(coeff_, &c[0], nnz_);
     }
 
   }
@@ -104,10 +104,8 @@
       coeff_   = 0;
     }
       
-    for(int i = 0; i < nnz; i++) {
-      support_[i] = s[i];
-      coeff_[i]   = c[i];
-    }
+    ABA_ELEMENTCOPY<int>::copy(support_, s, nnz);
+    ABA_ELEMENTCOPY<double>::copy(coeff_, c, nnz);
 
   }
 
@@ -122,11 +120,9 @@
     if (size_) {
       support_ = new int[size_];
       coeff_   = new double[size_];
-      
-      for(int i = 0; i < nnz_; i++) {
-        support_[i] = rhs.support_[i];
-        coeff_[i]   = rhs.coeff_[i];
-      }
+
+      ABA_ELEMENTCOPY<int>::copy(support_, rhs.support_, nnz_);
+      ABA_ELEMENTCOPY<double>::copy(coeff_, rhs.coeff_, nnz_);
     }
     else {
       support_ = 0;
@@ -141,9 +137,7 @@
   }
   
 
-#ifdef ABACUS_PARALLEL
-
-  ABA_SPARVEC::ABA_SPARVEC(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+  ABA_SPARVEC::ABA_SPARVEC(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
     :  
     glob_(glob)
   {
@@ -176,8 +170,6 @@
     }
   }
 
-#endif
-
   const ABA_SPARVEC& ABA_SPARVEC::operator=(const ABA_SPARVEC& rhs)
   {
     if (this == &rhs)
@@ -189,10 +181,8 @@
       exit(Fatal);
     }
 
-    for(int i = 0; i < rhs.nnz_; i++) {
-      support_[i] = rhs.support_[i];
-      coeff_[i]   = rhs.coeff_[i];
-    }
+    ABA_ELEMENTCOPY<int>::copy(support_, rhs.support_, rhs.nnz_);
+    ABA_ELEMENTCOPY<double>::copy(coeff_, rhs.coeff_, rhs.nnz_);
 
     nnz_ = rhs.nnz_;
     glob_ = rhs.glob_;
@@ -237,6 +227,9 @@ ostream& operator<<(ostream &out, const ABA_SPARVEC &rhs)
     /* All elements in the arrays between the removed elements \a del[i] and
      *   del[i+1] are shifted left in the inner loop.
      */  
+    /* Each of these blocks is moved at once. Only the leading blocks
+     *   overlap with their destination, which is handled by memmove().
+     */
     for (i = 0; i < nDel - 1; i++) {
 
 #ifdef ABACUSSAFE
@@ -246,12 +239,13 @@ ostream& operator<<(ostream &out, const ABA_SPARVEC &rhs)
       }
 #endif      
 
-      const int last = del[i+1];
+      const int first = del[i] + 1;
+      const int len   = del[i+1] - first;
 
-      for(j = del[i]+1; j < last; j++) {
-	support_[current] = support_[j];
-	coeff_[current]   = coeff_[j];
-	++current;
+      if (len > 0) {
+	memmove(support_ + current, support_ + first, len*sizeof(int));
+	memmove(coeff_ + current, coeff_ + first, len*sizeof(double));
+	current += len;
       }
     }
 
@@ -263,10 +257,11 @@ ostream& operator<<(ostream &out, const ABA_SPARVEC &rhs)
     }
 #endif      
 
-    for (j = del[nDel - 1] + 1; j < nnz_; j++) {
-      support_[current] = support_[j];
-      coeff_[current]   = coeff_[j];
-      ++current;
+    j = del[nDel - 1] + 1;
+
+    if (j < nnz_) {
+      memmove(support_ + current, support_ + j, (nnz_ - j)*sizeof(int));
+      memmove(coeff_ + current, coeff_ + j, (nnz_ - j)*sizeof(double));
     }
 
 
@@ -280,10 +275,8 @@ ostream& operator<<(ostream &out, const ABA_SPARVEC &rhs)
 
     nnz_ = vec.nnz();
 
-    for(int i = 0; i < nnz_; i++) {
-      support_[i] = vec.support(i);
-      coeff_[i]   = vec.coeff(i);
-    }
+    ABA_ELEMENTCOPY<int>::copy(support_, vec.support_, nnz_);
+    ABA_ELEMENTCOPY<double>::copy(coeff_, vec.coeff_, nnz_);
   }
 
   void ABA_SPARVEC::rename(ABA_ARRAY<int> &newName)
@@ -294,17 +287,61 @@ ostream& operator<<(ostream &out, const ABA_SPARVEC &rhs)
 
   double ABA_SPARVEC::norm()
   {
-    double v = 0.0;
+    // four independent partial sums like in dot()
+    double v0 = 0.0;
+    double v1 = 0.0;
+    double v2 = 0.0;
+    double v3 = 0.0;
+
+    const int n4 = nnz_ - nnz_ % 4;
+    int i;
+
+    for (i = 0; i < n4; i += 4) {
+      v0 += coeff_[i]*coeff_[i];
+      v1 += coeff_[i+1]*coeff_[i+1];
+      v2 += coeff_[i+2]*coeff_[i+2];
+      v3 += coeff_[i+3]*coeff_[i+3];
+    }
+    for (; i < nnz_; i++)
+      v0 += coeff_[i]*coeff_[i];
 
-    for (int i = 0; i < nnz_; i++)
-      v += coeff_[i]*coeff_[i];
+    return sqrt((v0 + v1) + (v2 + v3));
+  }
 
-    return sqrt(v);
+  double ABA_SPARVEC::dot(const double *x) const
+  {
+    double s0 = 0.0;
+    double s1 = 0.0;
+    double s2 = 0.0;
+    double s3 = 0.0;
+
+    const int    n4 = nnz_ - nnz_ % 4;
+    const int    *s = support_;
+    const double *c = coeff_;
+    int i;
+
+    for (i = 0; i < n4; i += 4) {
+      s0 += c[i]   * x[s[i]];
+      s1 += c[i+1] * x[s[i+1]];
+      s2 += c[i+2] * x[s[i+2]];
+      s3 += c[i+3] * x[s[i+3]];
+    }
+    for (; i < nnz_; i++)
+      s0 += c[i] * x[s[i]];
+
+    return (s0 + s1) + (s2 + s3);
+  }
+
+  double ABA_SPARVEC::dot(const ABA_ARRAY<double> &x) const
+  {
+    if (nnz_ == 0) return 0.0;
+
+    return dot(&x[0]);
   }
 
   void ABA_SPARVEC::realloc()
   {
-    realloc((int) ((1.0 + reallocFac_/100.0) * size_) + 1);
+    reserve(size_ + 1);
   }
 
   void ABA_SPARVEC::realloc(int newSize)
@@ -319,10 +356,8 @@ ostream& operator<<(ostream &out, const ABA_SPARVEC &rhs)
     int    *newSupport = new int[newSize];
     double *newCoeff    = new double[newSize];
 
-    for (int i = 0; i < nnz_; i++) {
-      newSupport[i] = support_[i];
-      newCoeff[i]   = coeff_[i];
-    }
+    ABA_ELEMENTCOPY<int>::copy(newSupport, support_, nnz_);
+    ABA_ELEMENTCOPY<double>::copy(newCoeff, coeff_, nnz_);
 
     delete [] support_;
     delete [] coeff_;
@@ -332,6 +367,39 @@ ostream& operator<<(ostream &out, const ABA_SPARVEC &rhs)
     size_    = newSize;
   }
 
+  void ABA_SPARVEC::reserve(int newSize)
+  {
+    if (newSize <= size_) return;
+
+    const int defaultSize = (int) ((1.0 + reallocFac_/100.0) * size_) + 1;
+
+    realloc(newSize < defaultSize ? defaultSize : newSize);
+  }
+
+  void ABA_SPARVEC::swap(ABA_SPARVEC &rhs)
+  {
+    ABA_GLOBAL *glob       = glob_;
+    int         size       = size_;
+    int         nnz        = nnz_;
+    double      reallocFac = reallocFac_;
+    int        *support    = support_;
+    double     *coeff      = coeff_;
+
+    glob_       = rhs.glob_;
+    size_       = rhs.size_;
+    nnz_        = rhs.nnz_;
+    reallocFac_ = rhs.reallocFac_;
+    support_    = rhs.support_;
+    coeff_      = rhs.coeff_;
+
+    rhs.glob_       = glob;
+    rhs.size_       = size;
+    rhs.nnz_        = nnz;
+    rhs.reallocFac_ = reallocFac;
+    rhs.support_    = support;
+    rhs.coeff_      = coeff;
+  }
+
   void ABA_SPARVEC::rangeCheck(int i) const
   {
     if (i < 0 || i >= nnz_) {
@@ -0,0 +1,154 @@
+/*!\file
+ * \author The ABACUS developers
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#include "abacus/spillfile.h"
+#include "abacus/master.h"
+#include "abacus/message.h"
+
+// the smallest free part of the file which is kept when a record is written
+  static const long minFreeSize = 64;
+
+  ABA_SPILLFILE::ABA_SPILLFILE(ABA_MASTER *master, const char *fileName)
+  :
+    master_(master),
+    fileName_(master, fileName),
+    size_(0),
+    used_(0),
+    freeOffset_(master, 64),
+    freeSize_(master, 64)
+  {
+    file_ = fopen(fileName, "w+b");
+    if (file_ == 0) {
+      master_->err() << "ABA_SPILLFILE::ABA_SPILLFILE(): opening file ";
+      master_->err() << fileName << " failed." << endl;
+      exit(Fatal);
+    }
+  }
+
+  ABA_SPILLFILE::~ABA_SPILLFILE()
+  {
+    fclose(file_);
+    ::remove(fileName_.string());
+  }
+
+  long ABA_SPILLFILE::write(const ABA_MESSAGE &msg, long &size)
+  {
+    const long required = sizeof(long) + msg.length();
+    long       offset   = size_;
+
+// find a free part of the file for the record
+/* We take the first free part which is large enough. If the remaining
+ *   part is not too small, it stays free. Otherwise, the record is
+ *   written at the end of the file.
+ */
+  size = required;
+
+  const int nFree = freeOffset_.number();
+  int i;
+
+  for (i = 0; i < nFree; i++)
+    if (freeSize_[i] >= required) break;
+
+  if (i < nFree) {
+    offset = freeOffset_[i];
+    if (freeSize_[i] - required >= minFreeSize) {
+      freeOffset_[i] += required;
+      freeSize_[i]   -= required;
+    }
+    else {
+      size = freeSize_[i];
+      freeOffset_[i] = freeOffset_[nFree - 1];
+      freeSize_[i]   = freeSize_[nFree - 1];
+      freeOffset_.pop();
+      freeSize_.pop();
+    }
+  }
+  else
+    size_ += required;
+
+  if (fseek(file_, offset, SEEK_SET) || msg.write(file_)) {
+    master_->err() << "ABA_SPILLFILE::write(): writing to " << fileName_;
+    master_->err() << " failed." << endl;
+    exit(Fatal);
+  }
+
+  used_ += size;
+
+  return offset;
+  }
+
+  void ABA_SPILLFILE::read(long offset, ABA_MESSAGE &msg)
+  {
+    if (fseek(file_, offset, SEEK_SET) || msg.read(file_)) {
+      master_->err() << "ABA_SPILLFILE::read(): reading from " << fileName_;
+      master_->err() << " failed." << endl;
+      exit(Fatal);
+    }
+  }
+
+  void ABA_SPILLFILE::remove(long offset, long size)
+  {
+    used_ -= size;
+
+// merge the record with adjacent free parts
+  int i = 0;
+
+  while (i < freeOffset_.number()) {
+    if (freeOffset_[i] + freeSize_[i] == offset || offset + size == freeOffset_[i]) {
+      if (freeOffset_[i] < offset) offset = freeOffset_[i];
+      size += freeSize_[i];
+
+      const int last = freeOffset_.number() - 1;
+      freeOffset_[i] = freeOffset_[last];
+      freeSize_[i]   = freeSize_[last];
+      freeOffset_.pop();
+      freeSize_.pop();
+    }
+    else
+      ++i;
+  }
+
+// release the free part
+/* A free part at the end of the file is not stored but the file
+ *   is shortened.
+ */
+  if (offset + size == size_) {
+    size_ = offset;
+    return;
+  }
+
+  if (freeOffset_.full()) {
+    freeOffset_.realloc(2*freeOffset_.size());
+    freeSize_.realloc(2*freeSize_.size());
+  }
+
+  freeOffset_.push(offset);
+  freeSize_.push(size);
+  }
@@ -65,9 +65,7 @@
   { }
 
 
-#ifdef ABACUS_PARALLEL
-
-  ABA_SROWCON::ABA_SROWCON(const ABA_MASTER *master, ABA_MESSAGE &msg)
+  ABA_SROWCON::ABA_SROWCON(ABA_MASTER *master, ABA_MESSAGE &msg)
   :  
     ABA_ROWCON(master, msg)
   {  }
@@ -82,8 +80,6 @@
     return SROWCON_CLASSID;
   }
 
-#endif
-
   int ABA_SROWCON::genRow(ABA_ACTIVE<ABA_VARIABLE, ABA_CONSTRAINT> *var, 
                           ABA_ROW &row)
   {
@@ -95,13 +91,5 @@
   double ABA_SROWCON::slack(ABA_ACTIVE<ABA_VARIABLE, ABA_CONSTRAINT> *variables, 
                             double *x)
   {
-
-    int nnz = row_.nnz();
-
-    double lhs = 0.0;
-
-    for (int i = 0; i < nnz; i++)
-      lhs += x[row_.support(i)] * row_.coeff(i);
-
-    return rhs() - lhs;
+    return rhs() - row_.dot(x);
   }
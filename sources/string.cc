@@ -36,9 +36,7 @@
 #include "abacus/string.h"
 #include "abacus/global.h"
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
 
   ABA_STRING::ABA_STRING(ABA_GLOBAL *glob, const char *cString) 
   :  
@@ -70,9 +68,7 @@
   }
 
 
-#ifdef ABACUS_PARALLEL
-
-  ABA_STRING::ABA_STRING(const ABA_GLOBAL *glob, ABA_MESSAGE &msg)
+  ABA_STRING::ABA_STRING(ABA_GLOBAL *glob, ABA_MESSAGE &msg)
   :  
     glob_(glob),  
     string_(0)
@@ -97,8 +93,6 @@
     msg.pack(string_, size);
   }
 
-#endif
-
   const ABA_STRING& ABA_STRING::operator=(const ABA_STRING &rhs)
   {
     if (&rhs == this) return *this;
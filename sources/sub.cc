@@ -50,6 +50,15 @@ using namespace std;
 #include "abacus/boundbranchrule.h"
 #include "abacus/active.h"
 #include "abacus/standardpool.h"
+#include "abacus/spillfile.h"
+#include "abacus/propagator.h"
+#include "abacus/conflictcon.h"
+#include "abacus/row.h"
+#include "abacus/sorter.h"
+#include "abacus/sepstat.h"
+#include "abacus/diver.h"
+#include "abacus/diveinfo.h"
+#include "abacus/heurserver.h"
 
 #ifdef ABACUS_PARALLEL
 #include "abacus/parmaster.h"
@@ -78,6 +87,7 @@ using namespace std;
     uBound_(0),  
     slackStat_(0),  
     tailOff_(0),  
+    propagator_(0),  
     dualBound_(master->dualBound()),  
     nIter_(0),  
     lastIterConAdd_(0),  
@@ -110,8 +120,11 @@ using namespace std;
     ignoreInTailingOff_(false),  
     //lastLP_(ABA_LP::BarrierAndCrossover),
     lastLP_(ABA_LP::Primal),
+    lpSituation_(ABA_LPMETHODSTAT::NoSituation),
     localTimer_(master),
-    forceExactSolver_(false)
+    forceExactSolver_(false),
+    spillOffset_(-1),
+    spillSize_(0)
   {
 #ifdef ABACUS_PARALLEL
     master_->parmaster()->incWorkCount();
@@ -141,10 +154,15 @@ using namespace std;
         
   actCon_ = new ABA_ACTIVE<ABA_CONSTRAINT, ABA_VARIABLE>(master_, maxCon);
 
-  const int nConPool = master_->conPool()->number();
+  // insert the constraints of the pool
+  /* After a restart of the root the variable pool can contain void slots
+   *   between the occupied ones, hence we scan all slots of the pools.
+   */
+  const int nConPool = master_->conPool()->size();
 
   for (int i = 0; i < nConPool; i++)
-    actCon_->insert(master_->conPool()->slot(i));
+    if (master_->conPool()->slot(i)->conVar())
+      actCon_->insert(master_->conPool()->slot(i));
 
     }
 
@@ -176,9 +194,10 @@ using namespace std;
     maxVar = master_->varPool()->number() + (int) varRes;
   actVar_ = new ABA_ACTIVE<ABA_VARIABLE, ABA_CONSTRAINT>(master_, maxVar);
 
-  const int nVarPool = master_->varPool()->number();
+  const int nVarPool = master_->varPool()->size();
   for (int i = 0; i < nVarPool; i++)
-    actVar_->insert(master_->varPool()->slot(i));
+    if (master_->varPool()->slot(i)->conVar())
+      actVar_->insert(master_->varPool()->slot(i));
 
   }
 
@@ -230,6 +249,7 @@ using namespace std;
     uBound_(0),  
     slackStat_(0),  
     tailOff_(0),  
+    propagator_(0),  
     dualBound_(father->dualBound_),  
     nIter_(0),  
     lastIterConAdd_(0),  
@@ -262,8 +282,11 @@ using namespace std;
     ignoreInTailingOff_(false) ,  
     //lastLP_(ABA_LP::BarrierAndCrossover),
     lastLP_(ABA_LP::Primal),
+    lpSituation_(ABA_LPMETHODSTAT::NoSituation),
     localTimer_(master),
-    forceExactSolver_(false)
+    forceExactSolver_(false),
+    spillOffset_(-1),
+    spillSize_(0)
   {
 #ifdef ABACUS_PARALLEL
     master_->parmaster()->incWorkCount();
@@ -400,6 +423,7 @@ using namespace std;
     uBound_(0),  
     slackStat_(0),  
     tailOff_(0),  
+    propagator_(0),  
     branchRule_(0),  
     addVarBuffer_(0),  
     addConBuffer_(0),  
@@ -412,7 +436,9 @@ using namespace std;
     sons_(0),  
     activated_(false),  
     ignoreInTailingOff_(false) ,  
-    localTimer_(master)
+    localTimer_(master),
+    spillOffset_(-1),
+    spillSize_(0)
   {
     master_->parmaster()->incWorkCount();
 
@@ -604,6 +630,286 @@ using namespace std;
       master_->out() << "DEBUG_MESSAGE_SUB: subproblem sent." << endl;
   }
 
+#else
+
+  ABA_SUB::ABA_SUB(ABA_MASTER *master, ABA_MESSAGE &msg)
+  :  
+    master_(master),  
+    actCon_(0),  
+    actVar_(0),  
+    father_(0),  
+    lp_(0),  
+    fsVarStat_(0),  
+    lpVarStat_(0),  
+    lBound_(0),  
+    uBound_(0),  
+    slackStat_(0),  
+    tailOff_(0),  
+    propagator_(0),  
+    branchRule_(0),  
+    addVarBuffer_(0),  
+    addConBuffer_(0),  
+    removeVarBuffer_(0),  
+    removeConBuffer_(0),  
+    xVal_(0),  
+    yVal_(0),  
+    bInvRow_(0),  
+    genNonLiftCons_(false),  
+    sons_(0),  
+    activated_(false),  
+    ignoreInTailingOff_(false) ,  
+    lastLP_(ABA_LP::Primal),
+    lpSituation_(ABA_LPMETHODSTAT::NoSituation),
+    localTimer_(master),
+    forceExactSolver_(false),
+    spillOffset_(-1),
+    spillSize_(0)
+  {
+// unpack the active constraints/variables and the local data
+/* The active sets refer to slots of the default pools, which have been
+ *   restored before. The remaining data is unpacked in the order of \a pack().
+ */
+  unpackLocalData(msg);
+
+  msg.unpack(dualBound_);
+  msg.unpack(nIter_);
+  msg.unpack(lastIterConAdd_);
+  msg.unpack(lastIterVarAdd_);
+  if (msg.unpackInt()) {
+    int classId;
+    msg.unpack(classId);
+    branchRule_ = master_->unpackBranchrule(msg, classId);
+  }
+  msg.unpack(allBranchOnSetVars_);
+  lpMethod_ = (ABA_LP::METHOD) msg.unpackInt();
+  msg.unpack(level_);
+  msg.unpack(id_);
+  status_ = (STATUS) msg.unpackInt();
+  msg.unpack(maxIterations_);
+  msg.unpack(nOpt_);
+  msg.unpack(relativeReserve_);
+  msg.unpack(varReserve_);
+  msg.unpack(conReserve_);
+  msg.unpack(nnzReserve_);
+  msg.unpack(nDormantRounds_);
+
+    if (branchRule_)
+      branchRule_->initialize(this);
+  }
+
+  void ABA_SUB::pack(ABA_MESSAGE &msg) const
+  {
+    if (status_ != Unprocessed && status_ != Dormant) {
+      master_->err() << "ABA_SUB::pack(): only open subproblems can be packed." << endl;
+      exit(Fatal);
+    }
+
+  packLocalData(msg);
+
+  msg.pack(dualBound_);
+  msg.pack(nIter_);
+  msg.pack(lastIterConAdd_);
+  msg.pack(lastIterVarAdd_);
+
+// pack the branching rule
+/* The branching rule has only to be extracted if the subproblem is
+ *   unprocessed. Subproblems which are dormant already contain the
+ *   modifications of the branching rule in their local data.
+ */
+  if (branchRule_ && status_ == Unprocessed) {
+    msg.pack(1);
+    msg.pack(branchRule_->classId());
+    branchRule_->pack(msg);
+  }
+  else
+    msg.pack(0);
+  msg.pack(allBranchOnSetVars_);
+  msg.pack((int)lpMethod_);             //!< ABA_LP::METHOD
+  msg.pack(level_);
+  msg.pack(id_);
+  msg.pack((int)status_);               //!< STATUS
+  msg.pack(maxIterations_);
+  msg.pack(nOpt_);
+  msg.pack(relativeReserve_);
+  msg.pack(varReserve_);
+  msg.pack(conReserve_);
+  msg.pack(nnzReserve_);
+  msg.pack(nDormantRounds_);
+  }
+
+#endif
+
+  void ABA_SUB::deleteLocalData()
+  {
+    if (fsVarStat_) {
+      const int nVariables = nVar();
+      for (int i = 0; i < nVariables; i++)
+        delete (*fsVarStat_)[i];
+    }
+
+    if (lpVarStat_) {
+      const int nVariables = nVar();
+      for (int i = 0; i < nVariables; i++)
+        delete (*lpVarStat_)[i];
+    }
+
+    delete fsVarStat_;
+    fsVarStat_ = 0;
+    delete lpVarStat_;
+    lpVarStat_ = 0;
+    
+    delete lBound_;
+    lBound_ = 0;
+    delete uBound_;
+    uBound_ = 0;
+
+    if (slackStat_) {
+      const int nConstraints = nCon();
+      for (int i = 0; i < nConstraints; i++)
+        delete (*slackStat_)[i];
+      delete slackStat_;
+      slackStat_ = 0;
+    }
+    
+    delete actCon_;
+    actCon_ = 0;
+    delete actVar_;
+    actVar_ = 0;
+  }
+
+#ifndef ABACUS_PARALLEL
+
+  void ABA_SUB::packLocalData(ABA_MESSAGE &msg) const
+  {
+    if (spilled()) {
+      ABA_MESSAGE spillMsg(master_);
+      master_->spillFile_->read(spillOffset_, spillMsg);
+      msg.pack(spillMsg);
+      return;
+    }
+
+// pack the active constraints/variables and their statuses and bounds
+/* An unprocessed subproblem (except the root) still shares the active
+ *   sets and the local data of its father, from which they are copied
+ *   when it is activated. In this case we pack the data of the father.
+ */
+  const ABA_SUB *data = actVar_ ? this : father_;
+
+  data->actCon_->pack(msg);
+  data->actVar_->pack(msg);
+  data->fsVarStat_->pack(msg, data->actVar_->number());
+  data->lpVarStat_->pack(msg, data->actVar_->number());
+  data->lBound_->pack(msg, data->actVar_->number());
+  data->uBound_->pack(msg, data->actVar_->number());
+  data->slackStat_->pack(msg, data->actCon_->number());
+  }
+
+  void ABA_SUB::unpackLocalData(ABA_MESSAGE &msg)
+  {
+    actCon_    = new ABA_ACTIVE<ABA_CONSTRAINT, ABA_VARIABLE>(master_, msg);
+    actVar_    = new ABA_ACTIVE<ABA_VARIABLE, ABA_CONSTRAINT>(master_, msg);
+    fsVarStat_ = new ABA_ARRAY<ABA_FSVARSTAT*>(master_, msg);
+    lpVarStat_ = new ABA_ARRAY<ABA_LPVARSTAT*>(master_, msg);
+    lBound_    = new ABA_ARRAY<double>(master_, msg);
+    uBound_    = new ABA_ARRAY<double>(master_, msg);
+    slackStat_ = new ABA_ARRAY<ABA_SLACKSTAT*>(master_, msg);
+  }
+
+  long ABA_SUB::localMemory() const
+  {
+    if (actVar_ == 0) return 0;
+
+// estimate the memory of the local data
+/* For each possible variable we store a reference to its pool slot,
+ *   pointers to the statuses, the redundancy age, and both bounds,
+ *   for each possible constraint its reference, the pointer to its slack
+ *   status and its age. The statuses are only allocated for the active
+ *   variables and constraints.
+ */
+  const long varSize = sizeof(ABA_POOLSLOTREF<ABA_VARIABLE, ABA_CONSTRAINT>)
+                       + 3*sizeof(void*) + sizeof(int) + 2*sizeof(double);
+  const long conSize = sizeof(ABA_POOLSLOTREF<ABA_CONSTRAINT, ABA_VARIABLE>)
+                       + 2*sizeof(void*) + sizeof(int);
+
+  return maxVar()*varSize
+         + nVar()*(sizeof(ABA_FSVARSTAT) + sizeof(ABA_LPVARSTAT))
+         + maxCon()*conSize + nCon()*sizeof(ABA_SLACKSTAT);
+  }
+
+  long ABA_SUB::spill()
+  {
+    ABA_MESSAGE msg(master_);
+
+    packLocalData(msg);
+    spillOffset_ = master_->spillFile_->write(msg, spillSize_);
+
+// lock the packed constraints and variables
+/* The spill file refers to the pool slots of the active constraints and
+ *   variables. Without the references of the deleted local data they could
+ *   be removed from the pools by a cleanup, and would be missing when the
+ *   subproblem is unspilled. The locks are removed by \a unspill().
+ */
+  ABA_SUB *data = actVar_ ? this : father_;
+  data->lockLocalData(true);
+
+    long released = localMemory();
+    deleteLocalData();
+
+// release the data of the father
+/* The data of the father is only required for the initialization of
+ *   unprocessed sons which are not spilled, and for the reoptimization
+ *   of the father if it becomes the root of the remaining tree.
+ */
+  if (father_ == 0 || father_->actVar_ == 0 || father_->status_ != Processed
+      || master_->newRootReOptimize())
+    return released;
+
+  const int nSons = father_->sons_->number();
+  for (int i = 0; i < nSons; i++) {
+    ABA_SUB *son = (*(father_->sons_))[i];
+    if (son->status_ == Unprocessed && son->actVar_ == 0 && !son->spilled())
+      return released;
+  }
+
+  released += father_->localMemory();
+  father_->deleteLocalData();
+
+  return released;
+  }
+
+  void ABA_SUB::unspill()
+  {
+    ABA_MESSAGE msg(master_);
+
+    master_->spillFile_->read(spillOffset_, msg);
+    master_->spillFile_->remove(spillOffset_, spillSize_);
+    spillOffset_ = -1;
+
+    unpackLocalData(msg);
+    lockLocalData(false);
+  }
+
+  void ABA_SUB::lockLocalData(bool lock)
+  {
+    ABA_CONVAR *cv;
+
+    const int nConstraints = actCon_->number();
+    for (int i = 0; i < nConstraints; i++) {
+      cv = (*actCon_)[i];
+      if (cv == 0) continue;
+      if (lock) cv->lock();
+      else      cv->unlock();
+    }
+
+    const int nVariables = actVar_->number();
+    for (int i = 0; i < nVariables; i++) {
+      cv = (*actVar_)[i];
+      if (cv == 0) continue;
+      if (lock) cv->lock();
+      else      cv->unlock();
+    }
+  }
+
 #endif
 
   int ABA_SUB::optimize()
@@ -836,7 +1142,7 @@ using namespace std;
 #ifdef ABACUS_PARALLEL
   if (status_ == Unprocessed && level_ > 1) {
 #else
-  if (status_ == Unprocessed && this != master_->root()) {
+  if (status_ == Unprocessed && this != master_->root() && actVar_ == 0) {
 #endif
     if (relativeReserve_) {
       initialMaxVar = (int) (father_->nVar() *(1.0 + varReserve_/100.0));
@@ -871,9 +1177,11 @@ using namespace std;
  *   information of the subproblem we can immediately fathom the subproblem.
  */
   if (status_ == Unprocessed && this != master_->root()) {
-    initializeVars(initialMaxVar);
-    initializeCons(initialMaxCon);
-    if (branchRule_->extract(this))
+    if (actVar_ == 0) {
+      initializeVars(initialMaxVar);
+      initializeCons(initialMaxCon);
+    }
+    if (branchRule_ && branchRule_->extract(this))
       return Fathoming;
   }
 
@@ -971,7 +1279,9 @@ using namespace std;
 // update fixed and set variables and set by logical implications
 /* We update global variable fixings which have been performed
  *   while the subproblem was sleeping. If there is a contradiction to
- *   set variables we can fathom the node.
+ *   set variables we can fathom the node. Likewise, the local bounds are
+ *   restricted to the global bounds, which might have been tightened by
+ *   the reduced cost criterion.
 
  *   The adaption of branching variables may allow us to set further
  *   variables by logical implications. Again contradictions to
@@ -1000,6 +1310,14 @@ using namespace std;
       (*lBound_)[i] = newBound;
       (*uBound_)[i] = newBound;
     }
+    else if (!local->fixedOrSet()) {
+      if (variable(i)->lBound() > (*lBound_)[i]) (*lBound_)[i] = variable(i)->lBound();
+      if (variable(i)->uBound() < (*uBound_)[i]) (*uBound_)[i] = variable(i)->uBound();
+      if ((*lBound_)[i] > (*uBound_)[i] + master_->eps()) {
+        infeasibleSub();
+        return Fathoming;
+      }
+    }
   }
 
   bool newValues;  //!< in this context only required as a dummy
@@ -1009,6 +1327,11 @@ using namespace std;
     return Fathoming;
   }
 
+  if (_propagate(newValues)) {
+    infeasibleSub();
+    return Fathoming;
+  }
+
   // output the dimension of the subproblem 
   if (master_->out().isOn() || master_->out().isLogOn()) {
   
@@ -1063,8 +1386,11 @@ using namespace std;
     for (int i = 0; i < nVariables; i++) {
       (*lpVarStat_)[i]  = new ABA_LPVARSTAT(father_->lpVarStat(i));
       (*fsVarStat_)[i]  = new ABA_FSVARSTAT(father_->fsVarStat(i));
-      (*lBound_)[i]     = father_->lBound(i);
-      (*uBound_)[i]     = father_->uBound(i);
+    }
+
+    if (nVariables) {
+      lBound_->copy(*(father_->lBound_), 0, nVariables - 1);
+      uBound_->copy(*(father_->uBound_), 0, nVariables - 1);
     }
   }
 
@@ -1094,6 +1420,8 @@ using namespace std;
   // delete members redundant for inactive subproblems 
   delete tailOff_;
   tailOff_ = 0;
+  delete propagator_;
+  propagator_ = 0;
 
   localTimer_.start(true);
 
@@ -1192,6 +1520,186 @@ using namespace std;
                             ABA_BUFFER<ABA_FSVARSTAT*> &status)
   { }
 
+  int ABA_SUB::_propagate(bool &newValues)
+  {
+    newValues = false;
+
+    if (!master_->boundPropagation() || master_->pricing()) return 0;
+
+    master_->out() << "Bound Propagation: " << flush;
+
+// propagate the bounds
+/* The propagator is kept while the subproblem is active, such that
+ *   only the constraints affected by changed bounds are processed again.
+ */
+  if (propagator_ == 0) propagator_ = new ABA_PROPAGATOR(master_, this);
+
+  int contra = propagator_->propagate(newValues);
+
+  if (contra)
+    master_->out() << "contradiction found" << endl;
+  else
+    master_->out() << propagator_->nTightened() << " bounds tightened" << endl;
+
+  return contra;
+  }
+
+  int ABA_SUB::conflictAnalysis()
+  {
+    if (!master_->conflictAnalysis() || master_->pricing()) return 0;
+
+    ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE> *pool = master_->cutPool();
+
+    const int    nConstraints = nCon();
+    const int    nVariables   = nVar();
+    const double eps          = master_->eps();
+    const double inf          = master_->infinity();
+
+    if (pool == 0 || nConstraints == 0) return 0;
+
+    double *ray = new double[nConstraints];
+
+    if (lp_->getDualRay(ray)) {
+      delete [] ray;
+      return 0;
+    }
+
+// aggregate the dual ray to a constraint
+/* The sign of the multipliers depends on the LP-solver, hence we try
+ *   the ray and its negation. A \f$\le\f$-constraint is only added with
+ *   a nonnegative multiplier and a \f$\ge\f$-constraint with a nonpositive
+ *   one, such that the aggregated constraint \f$\alpha x \le \beta\f$ is
+ *   valid. Locally valid constraints are skipped. The aggregated constraint
+ *   proves the infeasibility if its minimal activity with respect to the
+ *   local bounds exceeds \f$\beta\f$.
+ */
+  ABA_ARRAY<double> alpha(master_, nVariables);
+  ABA_ARRAY<double> bestAlpha(master_, nVariables);
+  ABA_ROW           row(master_, nVariables);
+  double            bestSlack = 0.0;
+  double            bestBeta  = 0.0;
+  double            beta;
+  double            minAct;
+  double            y;
+  int               c;
+  int               j;
+
+  for (int s = 1; s >= -1; s -= 2) {
+    alpha.set(0.0);
+    beta = 0.0;
+
+    for (c = 0; c < nConstraints; c++) {
+      y = s*ray[c];
+      if (fabs(y) < eps || constraint(c)->local()) continue;
+
+      ABA_CSENSE::SENSE sense = constraint(c)->sense()->sense();
+      if ((sense == ABA_CSENSE::Less && y < 0.0) ||
+          (sense == ABA_CSENSE::Greater && y > 0.0)) continue;
+
+      row.clear();
+      const int rowNnz = constraint(c)->genRow(actVar_, row);
+      for (int k = 0; k < rowNnz; k++)
+        alpha[row.support(k)] += y*row.coeff(k);
+      beta += y*row.rhs();
+    }
+
+    minAct = 0.0;
+    for (j = 0; j < nVariables; j++) {
+      if (fabs(alpha[j]) < eps) continue;
+      const double b = alpha[j] > 0.0 ? lBound(j) : uBound(j);
+      if (fabs(b) >= inf) break;
+      minAct += alpha[j]*b;
+    }
+
+    if (j == nVariables && minAct - beta > bestSlack + eps*(1.0 + fabs(beta))) {
+      bestSlack = minAct - beta;
+      bestBeta  = beta;
+      for (j = 0; j < nVariables; j++) bestAlpha[j] = alpha[j];
+    }
+  }
+
+  delete [] ray;
+
+  if (bestSlack == 0.0) return 0;
+
+// relax the local bounds
+/* A local bound contributes \f$\alpha_j (l_j - L_j)\f$ or
+ *   \f$\alpha_j (u_j - U_j)\f$ to the violation, where \f$L_j\f$ and
+ *   \f$U_j\f$ are the global bounds. The bounds are relaxed in the order of
+ *   increasing contributions as long as the aggregated constraint remains
+ *   violated, such that a small conflict remains. Globally fixed variables
+ *   do not belong to a conflict.
+ */
+  ABA_ARRAY<int>    cand(master_, nVariables);
+  ABA_ARRAY<double> contribution(master_, nVariables);
+  int               nCand = 0;
+
+  for (j = 0; j < nVariables; j++) {
+    if (fabs(bestAlpha[j]) < eps) continue;
+
+    ABA_VARIABLE *v = variable(j);
+    if (v->fsVarStat()->fixed()) continue;
+
+    const double local  = bestAlpha[j] > 0.0 ? lBound(j)    : uBound(j);
+    const double global = bestAlpha[j] > 0.0 ? v->lBound() : v->uBound();
+    double       d;
+
+    if (fabs(global) >= inf) d = inf;
+    else                     d = bestAlpha[j]*(local - global);
+
+    if (d > eps) {
+      cand[nCand]         = j;
+      contribution[nCand] = d;
+      ++nCand;
+    }
+  }
+
+  if (nCand > 1) {
+    ABA_SORTER<int, double> sorter(master_);
+    sorter.quickSort(nCand, cand, contribution);
+  }
+
+  const double minSlack  = eps*(1.0 + fabs(bestBeta));
+  double       slack     = bestSlack;
+  int          nConflict = 0;
+
+  for (int i = 0; i < nCand; i++) {
+    if (contribution[i] < inf && slack - contribution[i] > minSlack)
+      slack -= contribution[i];
+    else
+      cand[nConflict++] = cand[i];
+  }
+
+// generate the conflict constraint
+/* The conflict constraint can only be formulated if all variables of the
+ *   conflict are binary. Long conflicts are rejected, since they hardly
+ *   cut off other subproblems.
+ */
+  if (nConflict == 0 || nConflict > master_->maxConflictSize()) return 0;
+
+  ABA_ARRAY<ABA_POOLSLOT<ABA_VARIABLE, ABA_CONSTRAINT>*> slot(master_, nConflict);
+  ABA_ARRAY<double> value(master_, nConflict);
+
+  for (int i = 0; i < nConflict; i++) {
+    j = cand[i];
+    if (!variable(j)->binary()) return 0;
+    slot[i]  = actVar_->poolSlotRef(j)->slot();
+    value[i] = bestAlpha[j] > 0.0 ? lBound(j) : uBound(j);
+  }
+
+  ABA_CONFLICTCON *conflict = new ABA_CONFLICTCON(master_, nConflict, slot, value);
+
+  if (pool->insert(conflict) == 0) {
+    delete conflict;
+    return 0;
+  }
+
+  master_->out(1) << "conflict constraint with " << nConflict;
+  master_->out()  << " variables generated" << endl;
+
+  return 1;
+  }
+
    ABA_SUB::PHASE ABA_SUB::cutting ()
    {
 // ABA_SUB::cutting(): local variables
@@ -1456,6 +1964,7 @@ using namespace std;
     master_->out() << "LP-solution is feasible" << endl;
     if (master_->betterPrimal(lp_->value()))
       master_->primalBound(lp_->value());
+    storeIncumbent(lp_->value());
      
     status = _pricing(newValues);
     if (status)     continue;
@@ -1555,6 +2064,12 @@ using namespace std;
     }
   }
 
+  // check if the cutting plane algorithm stalls 
+  if (!terminate && cuttingStalls()) {
+    master_->out() << "Cutting plane algorithm stalls: enforce branching" << endl;
+    terminate = true;
+  }
+
   // should we pause the subproblem 
   if (!terminate && pausing()) {
     master_->out() << "Try to pause subproblem" << endl;
@@ -1687,8 +2202,14 @@ using namespace std;
 
   localTimer_.start(true);
 
+  lp_->setObjectiveLimit(objectiveLimit());
   status = lp_->optimize(lpMethod_);
   lastLP_ = lpMethod_;
+
+  master_->lpMethodStat()->record(lpSituation_, lpMethod_,
+                                  lp_->lpSolverTime_.centiSeconds(),
+                                  lp_->nIterations());
+  lpSituation_ = ABA_LPMETHODSTAT::NoSituation;
   
   master_->lpSolverTime_.addCentiSeconds( lp_->lpSolverTime_.centiSeconds() );
   lp_->lpSolverTime_.reset();
@@ -1698,6 +2219,19 @@ using namespace std;
   if (master_->printLP())
     master_->out() << *lp_;
 
+// the objective limit has been reached
+/* The dual simplex method has been stopped, since the value of the
+ *   linear program exceeds the primal bound. As for a bound crash, the
+ *   subproblem can be fathomed without solving the linear program to
+ *   optimality.
+ */
+  if (status == ABA_LP::LimitReached) {
+    master_->out() << endl;
+    master_->out(1) << "LP objective limit reached: " << lp_->value() << endl;
+    if (betterDual(lp_->value())) dualBound(dualRound(lp_->value()));
+    return 1;
+  }
+
 #ifdef TTT1
   char fileName[256];
 #ifdef ABACUS_PARALLEL
@@ -1752,10 +2286,25 @@ using namespace std;
   master_->out(1) << "LP-solution            : " << lp_->value() <<::endl;
   master_->out(1) << "Best feasible solution : " << master_->primalBound()  << endl;
 
-  if (ignoreInTailingOff_)
+// attribute the improvement of the dual bound to the separators
+/* The improvement of the dual bound by the linear program is attributed to
+ *   the separators of the preceding separation round. If there is no
+ *   preceding linear program in the subproblem, the round is forgotten.
+ */
+  double gain;
+  long   gainTime;
+
+  if (ignoreInTailingOff_) {
     ignoreInTailingOff_ = false;
-  else 
+    master_->sepStat()->clearRound();
+  }
+  else {
     tailOff_->update(lp_->value());
+    if (tailOff_->lastGain(gain, gainTime))
+      master_->sepStat()->clearRound();
+    else
+      master_->sepStat()->attribute(gain, gainTime, level_ == 1);
+  }
 
   getBase();    
 
@@ -1768,6 +2317,7 @@ using namespace std;
  *   or minus infinity) for an infeasible subproblem.
  */ 
   if (!master_->pricing()) {
+    conflictAnalysis();
     infeasibleSub();
     return 1;
   }
@@ -1895,12 +2445,7 @@ using namespace std;
                         double lb, 
                         double ub)
   {
-    double p = 0.0;
-
-    const int nnz = col.nnz();
-
-    for (int i = 0; i < nnz; i++)
-      p += col.coeff(i) * row[col.support(i)];
+    const double p = col.dot(row);
 
     if (x < lb) {
       if (p < -master_->eps()) return true;
@@ -2028,7 +2573,7 @@ using namespace std;
 
     do {
       if (this == current) return true;
-      if (current == master_->root()) break;
+      if (current == master_->root() || current->father() == 0) break;
       current = current->father();
     } while (1);
 #endif
@@ -2070,15 +2615,25 @@ using namespace std;
 
     if (nIter_ == 0) {
 #ifdef ABACUS_PARALLEL
-      if (level_ == 1)
+      if (level_ == 1) {
 #else
-      if (this == master_->root())
+      if (this == master_->root()) {
 #endif
         //lpMethod = ABA_LP::BarrierAndCrossover;
-        lpMethod = ABA_LP::Primal;
-      else
-        lpMethod = ABA_LP::Dual;
+        lpMethod     = ABA_LP::Primal;
+        lpSituation_ = ABA_LPMETHODSTAT::RootLp;
+      }
+      else {
+        lpMethod     = ABA_LP::Dual;
+        lpSituation_ = ABA_LPMETHODSTAT::FirstLp;
+      }
     }
+    else if (nConAdded && !nVarAdded)
+      lpSituation_ = ABA_LPMETHODSTAT::ConAdded;
+    else if (nVarAdded && !nConAdded)
+      lpSituation_ = ABA_LPMETHODSTAT::VarAdded;
+    else
+      lpSituation_ = ABA_LPMETHODSTAT::OtherLp;
       
     if (nConAdded)
       lpMethod = ABA_LP::Dual;
@@ -2094,6 +2649,17 @@ using namespace std;
       //lpMethod = ABA_LP::BarrierAndCrossover;
       lpMethod = ABA_LP::Primal;
 
+// choose the method adaptively
+/* The method chosen by the fixed rule is only preferred. The first linear
+ *   program of the root can be raced, since there are no statistics for it.
+ */
+    if (master_->lpMethodSelection() == ABA_MASTER::AdaptiveLpMethod)
+      lpMethod = master_->lpMethodStat()->choose(lpSituation_, lpMethod,
+                                                 lp_->barrierAvailable());
+
+    if (lpSituation_ == ABA_LPMETHODSTAT::RootLp && master_->lpRace())
+      lpMethod = ABA_LP::Race;
+
     return lpMethod;
   }
 
@@ -2188,8 +2754,13 @@ using namespace std;
   int i;
 
   // require the new constraints a reallocation? 
+  /* The maximal number of constraints is at least doubled, such that
+   *   the subproblem and its linear program are reallocated only a
+   *   logarithmic number of times.
+   */
   if (nCon() + nNewCons >= maxCon()) {
-    int newMax = ((maxCon() + nNewCons)*11)/10 + 1;
+    int newMax = 2*maxCon();
+    if (newMax <= nCon() + nNewCons) newMax = nCon() + nNewCons + 1;
     conRealloc(newMax);
   }
 
@@ -2309,12 +2880,20 @@ using namespace std;
                                         ABA_POOL<ABA_CONSTRAINT, ABA_VARIABLE> *pool,
                                         double minViolation)
   {
+    if (!startSeparator(ABA_SEPSTAT::Pool)) return 0;
+
+    int nGen;
+
     if (pool)
-      return pool->separate(xVal_, actVar_, this, addConBuffer_,
+      nGen = pool->separate(xVal_, actVar_, this, addConBuffer_,
                             minViolation, ranking);
     else
-      return master_->cutPool()->separate(xVal_, actVar_, this, addConBuffer_,
+      nGen = master_->cutPool()->separate(xVal_, actVar_, this, addConBuffer_,
                                           minViolation, ranking);
+
+    stopSeparator(ABA_SEPSTAT::Pool);
+
+    return nGen;
   }
 
   bool ABA_SUB::objAllInteger()
@@ -2405,6 +2984,21 @@ using namespace std;
       return Done;
     }
 
+#ifndef ABACUS_PARALLEL
+// restart the root on the reduced problem
+/* If many variables have been fixed to zero in the root node, the root is
+ *   not branched. Instead the master removes these variables from the
+ *   variable pool and optimizes a new root node (see
+ *   ABA_MASTER::_restartRoot()).
+ */
+  if (this == master_->root() && master_->_rootRestartDue()) {
+    master_->out() << "restarting the root on the reduced problem" << endl;
+    master_->restartRoot_ = true;
+    status_ = Processed;
+    return Done;
+  }
+#endif
+
 // generate the branching rules 
 /* If no branching rule is found we can fathom the subproblem.
  *   A branch rule defines the modifications of the current subproblem for
@@ -2981,12 +3575,16 @@ for (int i = 0; i < nSamples; i++)
 
   branchRule->extract(lp_);
   localTimer_.start(true);
-  lp_->optimize(ABA_LP::Dual);
+  lp_->setObjectiveLimit(objectiveLimit());
+  ABA_LP::OPTSTAT status = lp_->optimize(ABA_LP::Dual);
   master_->lpTime_.addCentiSeconds(localTimer_.centiSeconds());
 
-  // get the \a value of the linear program 
+// get the \a value of the linear program 
+/* If the objective limit has been reached, the son generated by the
+ *   branching rule would be fathomed like an infeasible one.
+ */
   double value;
-  if (lp_->infeasible()) {
+  if (lp_->infeasible() || status == ABA_LP::LimitReached) {
     if (master_->optSense()->max()) value = -master_->infinity();
     else                            value =  master_->infinity();
   }
@@ -3008,6 +3606,30 @@ for (int i = 0; i < nSamples; i++)
     return value;
   }
 
+  double ABA_SUB::objectiveLimit()
+  {
+    const bool max = master_->optSense()->max();
+
+    if (!master_->objectiveCutoff() || master_->pricing() ||
+        !master_->feasibleFound())
+      return max ? -master_->infinity() : master_->infinity();
+
+// determine the limit
+/* A value \f$x\f$ of the linear program is worse than the limit only if
+ *   \a master_->primalViolated() holds for \a dualRound(x).
+ */
+  double limit;
+
+  if (master_->objInteger())
+    limit = max ? master_->primalBound() + 1.0 - master_->eps()
+                : master_->primalBound() - 1.0 + master_->eps();
+  else
+    limit = max ? master_->primalBound() - master_->eps()
+                : master_->primalBound() + master_->eps();
+
+  return limit;
+  }
+
   int ABA_SUB::compareBranchingSampleRanks(ABA_ARRAY<double> &rank1,
                                            ABA_ARRAY<double> &rank2)
   {
@@ -3143,53 +3765,29 @@ for (int i = 0; i < nSamples; i++)
 /* A fathomed subproblem will neither be required for the initialization of
  *   one of its sons nor in a reoptimization to determine the new candidates
  *   for fixing variables. Hence we can delete all local memory. 
+ *   The local data of a spilled subproblem is read from the spill file
+ *   first, such that the locks of its constraints and variables are removed.
  */
+#ifndef ABACUS_PARALLEL
+  if (spilled()) unspill();
+#endif
 
-  if (fsVarStat_) {
-    const int nVariables = nVar();
-    for (int i = 0; i < nVariables; i++)
-      delete (*fsVarStat_)[i];
-  }
-
-  if (lpVarStat_) {
-    const int nVariables = nVar();
-    for (int i = 0; i < nVariables; i++)
-      delete (*lpVarStat_)[i];
-  }
-
-  delete fsVarStat_;
-  fsVarStat_ = 0;
-  delete lpVarStat_;
-  lpVarStat_ = 0;
-    
-  delete lBound_;
-  lBound_ = 0;
-  delete uBound_;
-  uBound_ = 0;
-
-  if (slackStat_) {
-    const int nConstraints = nCon();
-    for (int i = 0; i < nConstraints; i++)
-      delete (*slackStat_)[i];
-    delete slackStat_;
-    slackStat_ = 0;
-  }
-    
-  delete actCon_;
-  actCon_ = 0;
-  delete actVar_;
-  actVar_ = 0;
+  deleteLocalData();
 
   delete branchRule_;
   branchRule_ = 0;
 
 #ifndef ABACUS_PARALLEL
+
   // check if the root node is fathomed 
   if (this == master_->root()) {
     master_->out(2) << "root node fathomed" << endl;
     return;
   }
 
+  // a subproblem received from another worker has no father 
+  if (father_ == 0) return;
+
   // count the number of unfathomed sons of the father 
   int   nuf = 0;            //!< number of unfathomed sons of \a father_
 
@@ -3262,10 +3860,16 @@ for (int i = 0; i < nSamples; i++)
 
     status = setByRedCost();
     if (status) return 1;
+
+    tightenByRedCost();
     
     status = _setByLogImp(lNewValues);
     if (lNewValues) newValues = true;
     if (status)     return 1;
+
+    status = _propagate(lNewValues);
+    if (lNewValues) newValues = true;
+    if (status)     return 1;
     
     return 0;
   }
@@ -3302,6 +3906,30 @@ for (int i = 0; i < nSamples; i++)
       if (lNewValues) newValues = true;
     }
   }
+
+// update the global bounds also in the subproblem
+/* The global bounds might have been tightened by the reduced cost
+ *   criterion. The current LP-solution is not cut off, since it
+ *   is at the bound which is not changed.
+ */
+  ABA_BUFFER<int> tightened(master_, nVariables);
+
+#ifdef ABACUS_NO_FOR_SCOPE
+  for (i = 0; i < nVariables; i++) {
+#else
+  for (int i = 0; i < nVariables; i++) {
+#endif
+    if ((*fsVarStat_)[i]->fixedOrSet()) continue;
+    if (variable(i)->lBound() > (*lBound_)[i] || variable(i)->uBound() < (*uBound_)[i]) {
+      if (variable(i)->lBound() > (*lBound_)[i]) (*lBound_)[i] = variable(i)->lBound();
+      if (variable(i)->uBound() < (*uBound_)[i]) (*uBound_)[i] = variable(i)->uBound();
+      if ((*lBound_)[i] > (*uBound_)[i] + master_->eps()) return 1;
+      tightened.push(i);
+    }
+  }
+
+  updateBoundInLp(tightened);
+
   return 0;
 
     
@@ -3430,6 +4058,64 @@ for (int i = 0; i < nSamples; i++)
     return 0;
   }
 
+  int ABA_SUB::tightenByRedCost()
+  {
+    if (!master_->fixSetByRedCost() || !master_->feasibleFound()) return 0;
+
+    master_->out() << "Tightening Bounds by Reduced Costs:       " << flush;
+
+// determine the gap
+/* As in \a setByRedCost() a deterioration of the value of the linear
+ *   program by the gap is still allowed up to \a master_->eps(), such
+ *   that no solution as good as the primal bound is cut off.
+ */
+  double gap;
+
+  if (master_->optSense()->max())
+    gap = lp_->value() - master_->primalBound() + master_->eps();
+  else
+    gap = master_->primalBound() - lp_->value() + master_->eps();
+
+// tighten the bounds
+/* Only the bound opposite to the one the variable is at can be tightened.
+ *   Binary variables are not considered, since they are handled
+ *   by \a setByRedCost() already.
+ */
+  ABA_BUFFER<int> tightened(master_, nVar());
+  double          units;
+
+  const int nVariables = nVar();
+
+  for (int i = 0; i < nVariables; i++) {
+    if (!variable(i)->discrete() || variable(i)->binary() ||
+        (*fsVarStat_)[i]->fixedOrSet()) continue;
+
+    const double reco = fabs(lp_->reco(i));
+    if (reco < master_->machineEps()) continue;
+
+    units = floor(gap/reco);
+
+    if (lpVarStat(i)->status() == ABA_LPVARSTAT::AtLowerBound) {
+      if ((*lBound_)[i] + units < (*uBound_)[i] - master_->eps()) {
+        (*uBound_)[i] = (*lBound_)[i] + units;
+        tightened.push(i);
+      }
+    }
+    else if (lpVarStat(i)->status() == ABA_LPVARSTAT::AtUpperBound) {
+      if ((*uBound_)[i] - units > (*lBound_)[i] + master_->eps()) {
+        (*lBound_)[i] = (*uBound_)[i] - units;
+        tightened.push(i);
+      }
+    }
+  }
+
+  updateBoundInLp(tightened);
+
+  master_->out() << tightened.number() << " bounds tightened" << endl;
+
+  return tightened.number();
+  }
+
   ABA_CONSTRAINT *ABA_SUB::constraint(int i) const
   {
     return (*actCon_)[i];
@@ -3727,6 +4413,26 @@ for (int i = 0; i < nSamples; i++)
     
   }
 
+  void ABA_SUB::updateBoundInLp(ABA_BUFFER<int> &variables)
+  {
+    if (lp_ == 0) return;
+
+    const int          nVariables = variables.number();
+    ABA_BUFFER<int>    ind(master_, nVariables > 0 ? nVariables : 1);
+    ABA_BUFFER<double> lb(master_, nVariables > 0 ? nVariables : 1);
+    ABA_BUFFER<double> ub(master_, nVariables > 0 ? nVariables : 1);
+
+    for (int k = 0; k < nVariables; k++) {
+      const int i = variables[k];
+      if (lp_->eliminated(i)) continue;
+      ind.push(i);
+      lb.push((*lBound_)[i]);
+      ub.push((*uBound_)[i]);
+    }
+
+    lp_->changeBounds(ind, lb, ub);
+  }
+
   double ABA_SUB::fixSetNewBound(int i)
   {
     switch ((*fsVarStat_)[i]->status()) {
@@ -3888,6 +4594,43 @@ for (int i = 0; i < nSamples; i++)
 #endif
   }
 
+#ifndef ABACUS_PARALLEL
+
+  void ABA_SUB::transfer()
+  {
+    if (status_ == Fathomed) return;
+
+    if (status_ == Dormant || status_ == Unprocessed)
+      master_->openSub()->remove(this);
+
+    if (sons_)
+      for (int i = 0; i < sons_->number(); i++)
+        (*sons_)[i]->transfer();
+
+    if (status_ == Fathomed) return;  // transferred by the last son
+
+    status_ = Fathomed;
+
+    if (spilled()) unspill();
+    deleteLocalData();
+
+    delete branchRule_;
+    branchRule_ = 0;
+
+// transfer the father if all its sons are fathomed
+/* In contrast to \a fathom(), the father is not fathomed, since its
+ *   subtree is not solved, but only processed elsewhere.
+ */
+    if (this == master_->root() || father_ == 0) return;
+
+    for (int i = 0; i < father_->sons_->number(); i++)
+      if ((*(father_->sons_))[i]->status_ != Fathomed) return;
+
+    father_->transfer();
+  }
+
+#endif
+
   int ABA_SUB::_separate()
   {
   // should we separate cuts at all? 
@@ -3899,10 +4642,14 @@ for (int i = 0; i < nSamples; i++)
   master_->out() << endl;
   master_->out() << "Separation of Cutting Planes" << endl;
 
+  const int nBuffered = addConBuffer_->number();
+
   localTimer_.start(true);
   nCuts = separate();
   master_->separationTime_.addCentiSeconds( localTimer_.centiSeconds() );
 
+  master_->sepStat()->round(addConBuffer_->number() - nBuffered);
+
   return nCuts;
 
   }
@@ -3913,6 +4660,46 @@ for (int i = 0; i < nSamples; i++)
     return 0;
   }
 
+  bool ABA_SUB::startSeparator(int separator)
+  {
+    const double share = master_->adaptiveCutting();
+
+    if (level_ > 1 && share > 0.0 &&
+        !master_->sepStat()->profitable(separator, share) &&
+        !integerFeasible()) {
+      const char *name = master_->sepStat()->name(separator);
+
+      master_->out(1) << "separator ";
+      if (name) master_->out() << name;
+      else      master_->out() << separator;
+      master_->out() << " skipped" << endl;
+      return false;
+    }
+
+    master_->sepStat()->start(separator, addConBuffer_->number());
+    return true;
+  }
+
+  void ABA_SUB::stopSeparator(int separator)
+  {
+    master_->sepStat()->stop(separator, addConBuffer_->number(), level_ == 1);
+  }
+
+  bool ABA_SUB::cuttingStalls()
+  {
+    const double share = master_->adaptiveCutting();
+    double       gain;
+    long         gainTime;
+
+    if (level_ == 1 || share <= 0.0) return false;
+    if (tailOff_->lastGain(gain, gainTime)) return false;
+
+    if (ABA_SEPSTAT::rate(gain, gainTime) >= share*master_->sepStat()->rootRate())
+      return false;
+
+    return !integerFeasible();
+  }
+
   int ABA_SUB::_improve(double &primalValue)
   {
     if (master_->pbMode() != ABA_MASTER::NoPrimalBound) return 0;
@@ -3921,13 +4708,74 @@ for (int i = 0; i < nSamples; i++)
     
     localTimer_.start(true);
 
+// pass the solution to the asynchronous primal heuristic
+/* The solution is only queued, and the best value found by the heuristic
+ *   threads for earlier solutions is collected without waiting.
+ */
+    ABA_HEURSERVER *heurServer = master_->heurServer();
+    double          asyncValue;
+    int             asyncStatus = 0;
+
+    if (heurServer) {
+      heurServer->post(this);
+      asyncStatus = heurServer->harvest(asyncValue);
+    }
+
     int status = improve(primalValue);
 
+// apply the diving heuristics
+/* The best one of the solutions found by \a improve(), by the diving
+ *   heuristics, and by the asynchronous primal heuristic is returned.
+ */
+    double diveValue;
+
+    if (dive(diveValue)) betterSolution(status, primalValue, diveValue);
+    if (asyncStatus)     betterSolution(status, primalValue, asyncValue);
+
     master_->improveTime_.addCentiSeconds( localTimer_.centiSeconds() );
 
     return status;
   }
 
+  void ABA_SUB::betterSolution(int &status, double &primalValue, double value)
+  {
+    if (!status) primalValue = value;
+    else if (master_->optSense()->max()) {
+      if (value > primalValue) primalValue = value;
+    }
+    else if (value < primalValue) primalValue = value;
+    status = 1;
+  }
+
+  int ABA_SUB::dive(double &primalValue)
+  {
+    const int frequency = master_->divingFrequency();
+
+    if (!frequency || master_->pricing() || nIter_ != 1) return 0;
+    if ((level_ - 1) % frequency) return 0;
+
+    ABA_MASTER::DIVINGSTRAT strat = master_->divingStrategy();
+
+    if (strat == ABA_MASTER::RotatingDiving)
+      strat = (ABA_MASTER::DIVINGSTRAT) (id_ % ABA_MASTER::RotatingDiving);
+
+    ABA_DIVER diver(master_, this);
+
+    return diver.dive(strat, primalValue);
+  }
+
+  void ABA_SUB::storeIncumbent(double value)
+  {
+    if (!master_->betterPrimal(value) && !master_->equal(value, master_->primalBound()))
+      return;
+
+    ABA_DIVEINFO *info = master_->diveInfo();
+
+    info->clearIncumbent();
+    for (int i = 0; i < nVar(); i++)
+      info->incumbent(actVar_->poolSlotRef(i)->slot()->index(), xVal_[i]);
+  }
+
   int ABA_SUB::improve(double &primalValue)
   {
     master_->out() << endl << "no primal heuristic implemented" << endl;
@@ -3963,7 +4811,8 @@ for (int i = 0; i < nSamples; i++)
   int n = nVar();
     
   if (n + newVars.number() >= maxVar()) {
-    int newMax = ((maxVar() + newVars.number())*11)/10 + 1;
+    int newMax = 2*maxVar();
+    if (newMax <= n + newVars.number()) newMax = n + newVars.number() + 1;
     varRealloc(newMax);
   }
 
@@ -4172,10 +5021,7 @@ for (int i = 0; i < nSamples; i++)
 
     double *xValNew = new double[newSize];
 
-    const int nVariables = nVar();
-
-    for (int i = 0; i < nVariables; i++)
-      xValNew[i] = xVal_[i];
+    ABA_ELEMENTCOPY<double>::copy(xValNew, xVal_, nVar());
 
     delete [] xVal_;
     xVal_ = xValNew;
@@ -4196,10 +5042,7 @@ for (int i = 0; i < nSamples; i++)
 
     double *yValNew = new double[newSize];
 
-    const int nConstraints = nCon();
-
-    for (int i = 0; i < nConstraints; i++)
-      yValNew[i] = yVal_[i];
+    ABA_ELEMENTCOPY<double>::copy(yValNew, yVal_, nCon());
 
     delete [] yVal_;
     yVal_ = yValNew;
@@ -4280,5 +5123,5 @@ for (int i = 0; i < nSamples; i++)
 
   bool ABA_SUB::solveApproxNow()
   {
-     return false;
+     return level_ == 1 && nIter_ == 0;
   }
@@ -35,7 +35,13 @@
 
   ABA_TAILOFF::ABA_TAILOFF(ABA_MASTER *master) 
   :  
-    master_(master)  
+    master_(master),  
+    hasLast_(false),  
+    lastValue_(0.0),  
+    lastTime_(0),  
+    gainAvailable_(false),  
+    gain_(0.0),  
+    gainTime_(0)  
   {
     if (master->tailOffNLp() > 0)
       lpHistory_ = new ABA_RING<double>(master, master->tailOffNLp());
@@ -47,7 +53,13 @@
 // The parameter NLp determines the size of the buffer
   ABA_TAILOFF::ABA_TAILOFF(ABA_MASTER *master, int NLp) 
   :  
-    master_(master)  
+    master_(master),  
+    hasLast_(false),  
+    lastValue_(0.0),  
+    lastTime_(0),  
+    gainAvailable_(false),  
+    gain_(0.0),  
+    gainTime_(0)  
   {
     if (NLp > 0)
       lpHistory_ = new ABA_RING<double>(master, NLp);
@@ -74,11 +86,37 @@
   void ABA_TAILOFF::update(double value)
   {
     if (lpHistory_) lpHistory_->insert(value);
+
+// update the improvement of the dual bound
+/* The cpu time is the time for separation and linear programming, such
+ *   that the time of primal heuristics does not reduce the improvement
+ *   per second. If the older value is zero, the absolute difference is taken.
+ *   The improvement is signed, i.e., a linear program weakening the dual
+ *   bound, e.g., after the generation of variables, gives a negative gain.
+ */
+    const long now = master_->lpTime()->centiSeconds()
+                     + master_->separationTime()->centiSeconds();
+
+    if (hasLast_) {
+      const double base = fabs(lastValue_);
+
+      gain_ = (value - lastValue_)*100.0;
+      if (master_->optSense()->max()) gain_ = -gain_;
+      if (base > master_->machineEps()) gain_ /= base;
+      gainTime_      = now - lastTime_;
+      gainAvailable_ = true;
+    }
+
+    hasLast_   = true;
+    lastValue_ = value;
+    lastTime_  = now;
   }
 
   void ABA_TAILOFF::reset()
   {
     if (lpHistory_) lpHistory_->clear();
+    hasLast_       = false;
+    gainAvailable_ = false;
   }
 
   bool ABA_TAILOFF::tailOff() const
@@ -105,3 +143,13 @@
 
     return 0;
   }
+
+  int ABA_TAILOFF::lastGain(double &gain, long &centiSeconds) const
+  {
+    if (!gainAvailable_) return 1;
+
+    gain         = gain_;
+    centiSeconds = gainTime_;
+
+    return 0;
+  }
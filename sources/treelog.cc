@@ -0,0 +1,234 @@
+/*!\file
+ * \author The ABACUS developers
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#include "abacus/treelog.h"
+#include "abacus/master.h"
+
+#include <string.h>
+
+// the maximal size of a record
+/* A record of type \a NodeBounds is the largest one. It consists
+ *   of the type, the time, the node and the two bounds.
+ */
+  static const int maxRecordSize = 1 + sizeof(int) + sizeof(int)
+                                   + 2*sizeof(double);
+
+  ABA_TREELOG::ABA_TREELOG(ABA_MASTER *master, const char *fileName,
+                           int bufferSize)
+  :
+    master_(master),
+    size_(bufferSize < 1024 ? 1024 : bufferSize),
+    nFill_(0),
+    nWrite_(0),
+    done_(false),
+    running_(false)
+  {
+    file_ = fopen(fileName, "wb");
+    if (file_ == 0) {
+      master_->err() << "ABA_TREELOG::ABA_TREELOG(): opening file ";
+      master_->err() << fileName << " failed." << endl;
+      exit(Fatal);
+    }
+
+    fill_  = new char[size_];
+    write_ = new char[size_];
+
+    // write the header of the file
+    int one = 1;
+    fwrite(magic(), 1, strlen(magic()), file_);
+    fwrite(&one, sizeof(int), 1, file_);
+
+    pthread_mutex_init(&mutex_, 0);
+    pthread_cond_init(&cond_, 0);
+
+    startWriter();
+  }
+
+  ABA_TREELOG::~ABA_TREELOG()
+  {
+    stopWriter();
+
+    pthread_cond_destroy(&cond_);
+    pthread_mutex_destroy(&mutex_);
+
+    fclose(file_);
+
+    delete [] fill_;
+    delete [] write_;
+  }
+
+  void ABA_TREELOG::newNode(long time, int fatherId, int id)
+  {
+    beginRecord(NewNode, time);
+    append(&fatherId, sizeof(int));
+    append(&id, sizeof(int));
+  }
+
+  void ABA_TREELOG::paintNode(long time, int id, int color)
+  {
+    beginRecord(PaintNode, time);
+    append(&id, sizeof(int));
+    append(&color, sizeof(int));
+  }
+
+  void ABA_TREELOG::lowerBound(long time, double lb)
+  {
+    beginRecord(LowerBound, time);
+    append(&lb, sizeof(double));
+  }
+
+  void ABA_TREELOG::upperBound(long time, double ub)
+  {
+    beginRecord(UpperBound, time);
+    append(&ub, sizeof(double));
+  }
+
+  void ABA_TREELOG::nodeBounds(long time, int id, double lb, double ub)
+  {
+    beginRecord(NodeBounds, time);
+    append(&id, sizeof(int));
+    append(&lb, sizeof(double));
+    append(&ub, sizeof(double));
+  }
+
+  void ABA_TREELOG::flush()
+  {
+    if (nFill_) swapBuffers();
+
+    if (running_) {
+      pthread_mutex_lock(&mutex_);
+      while (nWrite_) pthread_cond_wait(&cond_, &mutex_);
+      pthread_mutex_unlock(&mutex_);
+    }
+
+    fflush(file_);
+  }
+
+  void ABA_TREELOG::startWriter()
+  {
+    if (running_) return;
+
+// start the writer thread
+/* If no thread can be started, the buffers are written
+ *   synchronously in \a swapBuffers().
+ */
+    done_ = false;
+
+    if (pthread_create(&thread_, 0, writer, this) == 0)
+      running_ = true;
+    else {
+      master_->err() << "WARNING: ABA_TREELOG::startWriter(): ";
+      master_->err() << "starting writer thread failed, ";
+      master_->err() << "writing synchronously." << endl;
+    }
+  }
+
+  void ABA_TREELOG::stopWriter()
+  {
+    flush();
+
+    if (!running_) return;
+
+    pthread_mutex_lock(&mutex_);
+    done_ = true;
+    pthread_cond_broadcast(&cond_);
+    pthread_mutex_unlock(&mutex_);
+    pthread_join(thread_, 0);
+
+    running_ = false;
+  }
+
+  void ABA_TREELOG::beginRecord(RECORD type, long time)
+  {
+    if (nFill_ + maxRecordSize > size_) swapBuffers();
+
+    fill_[nFill_++] = (char) type;
+
+    int t = (int) time;
+    append(&t, sizeof(int));
+  }
+
+  void ABA_TREELOG::append(const void *data, int n)
+  {
+    memcpy(fill_ + nFill_, data, n);
+    nFill_ += n;
+  }
+
+  void ABA_TREELOG::swapBuffers()
+  {
+    if (!running_) {
+      fwrite(fill_, 1, nFill_, file_);
+      nFill_ = 0;
+      return;
+    }
+
+    pthread_mutex_lock(&mutex_);
+    while (nWrite_) pthread_cond_wait(&cond_, &mutex_);
+
+    char *h = write_;
+    write_  = fill_;
+    fill_   = h;
+    nWrite_ = nFill_;
+    nFill_  = 0;
+
+    pthread_cond_broadcast(&cond_);
+    pthread_mutex_unlock(&mutex_);
+  }
+
+  void *ABA_TREELOG::writer(void *treeLog)
+  {
+    ABA_TREELOG *log = (ABA_TREELOG*) treeLog;
+
+// write the buffers passed by \a swapBuffers()
+/* The buffer \a write_ is not touched by \a swapBuffers() as long
+ *   as \a nWrite_ is nonzero. Therefore, we can write it without
+ *   holding the mutex.
+ */
+    pthread_mutex_lock(&log->mutex_);
+    for (;;) {
+      while (!log->nWrite_ && !log->done_)
+        pthread_cond_wait(&log->cond_, &log->mutex_);
+
+      if (!log->nWrite_) break;
+
+      int n = log->nWrite_;
+      pthread_mutex_unlock(&log->mutex_);
+
+      if ((int) fwrite(log->write_, 1, n, log->file_) != n)
+        log->master_->err() << "WARNING: ABA_TREELOG::writer(): writing the tree log failed." << endl;
+
+      pthread_mutex_lock(&log->mutex_);
+      log->nWrite_ = 0;
+      pthread_cond_broadcast(&log->cond_);
+    }
+    pthread_mutex_unlock(&log->mutex_);
+
+    return 0;
+  }
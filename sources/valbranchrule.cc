@@ -32,9 +32,7 @@
 #include "abacus/sub.h"
 #include "abacus/lpsub.h"
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
 
   ABA_VALBRANCHRULE::ABA_VALBRANCHRULE(ABA_MASTER *master, int variable, double value)
   :  
@@ -47,9 +45,7 @@
   { }
 
 
-#ifdef ABACUS_PARALLEL
-
-  ABA_VALBRANCHRULE::ABA_VALBRANCHRULE(const ABA_MASTER *master, ABA_MESSAGE &msg)
+  ABA_VALBRANCHRULE::ABA_VALBRANCHRULE(ABA_MASTER *master, ABA_MESSAGE &msg)
     :  
     ABA_BRANCHRULE(master, msg)
   {
@@ -73,8 +69,6 @@
     return VALBRANCHRULE_CLASSID;
   }
 
-#endif
-
   ostream &operator<<(ostream &out, const ABA_VALBRANCHRULE &rhs)
   {
     return out << "x" << rhs.variable_ << " = " << rhs.value_;
@@ -57,9 +57,7 @@
   { }
 
 
-#ifdef ABACUS_PARALLEL
-
-  ABA_VARIABLE::ABA_VARIABLE(const ABA_MASTER *master, ABA_MESSAGE &msg)
+  ABA_VARIABLE::ABA_VARIABLE(ABA_MASTER *master, ABA_MESSAGE &msg)
   :  
     ABA_CONVAR(master, msg),  
     fsVarStat_(master, msg),  
@@ -81,8 +79,6 @@
     msg.pack(uBound_);
   }
 
-#endif
-
   double ABA_VARIABLE::obj()
   {
     return obj_;
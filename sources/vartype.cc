@@ -28,11 +28,7 @@
 
 #include "abacus/vartype.h"
 
-#ifdef ABACUS_PARALLEL
 #include "abacus/message.h"
-#endif
-
-#ifdef ABACUS_PARALLEL
 
   ABA_VARTYPE::ABA_VARTYPE(ABA_MESSAGE &msg)
   {
@@ -44,8 +40,6 @@
     msg.pack((int)type_);
   }
 
-#endif
-
   ostream &operator<<(ostream &out, const ABA_VARTYPE &rhs)
   {
     switch (rhs.type_) {
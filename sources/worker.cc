@@ -0,0 +1,366 @@
+/*!\file
+ * \author The ABACUS developers
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#include "abacus/worker.h"
+#include "abacus/coordinator.h"
+#include "abacus/message.h"
+#include "abacus/sub.h"
+#include "abacus/opensub.h"
+#include "abacus/standardpool.h"
+#include "abacus/constraint.h"
+#include "abacus/variable.h"
+#include "abacus/sorter.h"
+
+#include <poll.h>
+#include <unistd.h>
+
+  ABA_WORKER::ABA_WORKER(ABA_MASTER *master, int fd)
+  :
+    master_(master),
+    fd_(fd),
+    stopped_(false),
+    primalBound_(master->primalBound()),
+    found_(false),
+    nOpen_(-1),
+    dualBound_(0.0),
+    known_(master, master->cutPool_ ? master->cutPool_->size() : 1, 0)
+  {
+    out_ = new ABA_MESSAGE(master_);
+    in_  = new ABA_MESSAGE(master_);
+
+    // the cuts present at the start are known to all workers
+    markCuts();
+  }
+
+  ABA_WORKER::~ABA_WORKER()
+  {
+    close(fd_);
+    delete out_;
+    delete in_;
+  }
+
+  void ABA_WORKER::communicate()
+  {
+    sendCuts();
+
+    // report the open subproblems if they have changed
+    const int    nOpen = master_->openSub_->number();
+    const double dual  = master_->openSub_->dualBound();
+
+    if (nOpen != nOpen_ || dual != dualBound_) {
+      out_->clear();
+      out_->pack((int) ABA_COORDINATOR::StatusTag);
+      out_->pack(nOpen);
+      out_->pack(dual);
+      send(*out_);
+      nOpen_     = nOpen;
+      dualBound_ = dual;
+    }
+
+    // process the messages which have arrived
+    struct pollfd pfd;
+
+    pfd.fd     = fd_;
+    pfd.events = POLLIN;
+
+    while (!stopped_) {
+      pfd.revents = 0;
+      if (poll(&pfd, 1, 0) <= 0) break;
+      receive();
+      handle();
+    }
+
+    markCuts();
+  }
+
+  bool ABA_WORKER::idle()
+  {
+    if (stopped_) return false;
+
+    sendCuts();
+
+    out_->clear();
+    out_->pack((int) ABA_COORDINATOR::IdleTag);
+    send(*out_);
+    nOpen_ = 0;
+
+// wait for open subproblems
+/* While the worker is idle, it still has to answer requests for
+ *   donations, which come from the coordinator before it has
+ *   processed the message of this worker.
+ */
+    for (;;) {
+      receive();
+      int tag = handle();
+      if (stopped_) return false;
+      if (tag == ABA_COORDINATOR::SubsTag && !master_->openSub_->empty()) {
+        markCuts();
+        return true;
+      }
+    }
+  }
+
+  void ABA_WORKER::primalBound(double x)
+  {
+    if (!master_->optSense()->max() ? x >= primalBound_ : x <= primalBound_)
+      return;
+
+    primalBound_ = x;
+    found_       = true;
+
+    out_->clear();
+    out_->pack((int) ABA_COORDINATOR::IncumbentTag);
+    out_->pack(x);
+    send(*out_);
+  }
+
+  void ABA_WORKER::finish(ABA_MASTER::STATUS status)
+  {
+// send the final message
+/* Only the worker which has found the best known primal bound
+ *   sends the problem specific data, e.g., the best feasible solution.
+ */
+    out_->clear();
+    out_->pack((int) ABA_COORDINATOR::DoneTag);
+    out_->pack((int) status);
+    master_->_packStatistics(*out_);
+    out_->pack(found_);
+    if (found_) master_->packCheckpoint(*out_);
+    send(*out_);
+  }
+
+  void ABA_WORKER::send(const ABA_MESSAGE &msg)
+  {
+    if (msg.send(fd_)) {
+      master_->err() << "ABA_WORKER::send(): connection to the coordinator ";
+      master_->err() << "lost." << endl;
+      exit(Fatal);
+    }
+  }
+
+  void ABA_WORKER::receive()
+  {
+    if (in_->receive(fd_)) {
+      master_->err() << "ABA_WORKER::receive(): connection to the coordinator ";
+      master_->err() << "lost." << endl;
+      exit(Fatal);
+    }
+  }
+
+  int ABA_WORKER::handle()
+  {
+    const int tag = in_->unpackInt();
+
+    switch (tag) {
+      case ABA_COORDINATOR::IncumbentTag: {
+        double x;
+        in_->unpack(x);
+        if (master_->betterPrimal(x)) {
+          primalBound_ = x;
+          found_       = false;
+          master_->primalBound(x);
+        }
+        break;
+      }
+      case ABA_COORDINATOR::CutsTag:
+        unpackCuts();
+        break;
+      case ABA_COORDINATOR::DonateTag:
+        donate(in_->unpackInt());
+        break;
+      case ABA_COORDINATOR::SubsTag:
+        unpackSubs();
+        break;
+      case ABA_COORDINATOR::StopTag:
+        stopped_ = true;
+        break;
+      default:
+        master_->err() << "ABA_WORKER::handle(): unknown message of the ";
+        master_->err() << "coordinator." << endl;
+        exit(Fatal);
+    }
+
+    return tag;
+  }
+
+  void ABA_WORKER::donate(int n)
+  {
+    const int  nOpen = master_->openSub_->number();
+    const bool max   = master_->optSense()->max();
+
+    if (n > nOpen/2) n = nOpen/2;
+
+// select the donated subproblems
+/* The open subproblems are sorted according to their dual bounds, and
+ *   every second one is donated, starting with the second best one. In
+ *   this way, both workers get promising subproblems.
+ */
+    ABA_ARRAY<ABA_SUB*>      cand(master_, nOpen > 0 ? nOpen : 1);
+    ABA_ARRAY<double>        key(master_, nOpen > 0 ? nOpen : 1);
+    ABA_DLISTITEM<ABA_SUB*> *item;
+    ABA_SUB                 *s;
+    int                      i = 0;
+
+    forAllDListElem(master_->openSub_->list_, item, s) {
+      cand[i] = s;
+      key[i]  = max ? -s->dualBound() : s->dualBound();
+      ++i;
+    }
+
+    ABA_SORTER<ABA_SUB*, double> sorter(master_);
+    if (nOpen > 1) sorter.quickSort(nOpen, cand, key);
+
+    double bound = max ? -master_->infinity() : master_->infinity();
+
+    for (i = 0; i < n; i++) {
+      s = cand[2*i + 1];
+      if (max ? s->dualBound() > bound : s->dualBound() < bound)
+        bound = s->dualBound();
+    }
+
+// pack the donated subproblems
+/* The cuts of the cut pool are packed by value, since the cut pools
+ *   of the workers differ. The local data of spilled subproblems has to
+ *   be read first, since it refers to the slots of the cut pool.
+ *   The donated subproblems are transferred afterwards.
+ */
+    out_->clear();
+    out_->pack((int) ABA_COORDINATOR::SubsTag);
+    out_->pack(n);
+    out_->pack(bound);
+
+    master_->packByValue_ = true;
+    for (i = 0; i < n; i++) {
+      s = cand[2*i + 1];
+      if (s->spilled()) s->unspill();
+      s->pack(*out_);
+    }
+    master_->packByValue_ = false;
+
+    send(*out_);
+
+    for (i = 0; i < n; i++)
+      cand[2*i + 1]->transfer();
+
+    master_->out(1) << n << " open subproblems donated" << endl;
+  }
+
+  void ABA_WORKER::unpackSubs()
+  {
+    const int nSubs = in_->unpackInt();
+    double    bound;
+
+    in_->unpack(bound);
+
+// insert the received subproblems
+/* The received subproblems have no father. The dual bound of the master
+ *   might be better than their dual bound, since it is only derived from
+ *   the subproblems of this worker.
+ */
+    for (int i = 0; i < nSubs; i++) {
+      ABA_SUB *sub = master_->unpackSub(*in_);
+      master_->openSub_->insert(sub);
+    }
+
+    if (!master_->betterDual(bound)) master_->dualBound_ = bound;
+  }
+
+  void ABA_WORKER::sendCuts()
+  {
+    ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE> *pool = master_->cutPool_;
+
+    if (pool == 0) return;
+
+// find the new globally valid cuts
+/* A cut is new if the version of its slot differs from the version
+ *   when the slot was marked last.
+ */
+    const int s = pool->size();
+
+    if (known_.size() < s) {
+      const int oldSize = known_.size();
+      known_.realloc(s);
+      for (int i = oldSize; i < s; i++) known_[i] = 0;
+    }
+
+    ABA_CONSTRAINT *cut;
+    int             nCuts = 0;
+
+    for (int i = 0; i < s; i++) {
+      cut = pool->slot(i)->conVar();
+      if (cut && pool->slot(i)->version() != known_[i] && !cut->local())
+        ++nCuts;
+    }
+
+    if (nCuts) {
+      out_->clear();
+      out_->pack((int) ABA_COORDINATOR::CutsTag);
+      out_->pack(nCuts);
+
+      for (int i = 0; i < s; i++) {
+        cut = pool->slot(i)->conVar();
+        if (cut && pool->slot(i)->version() != known_[i] && !cut->local()) {
+          out_->pack(cut->classId());
+          cut->pack(*out_);
+        }
+      }
+
+      send(*out_);
+    }
+
+    markCuts();
+  }
+
+  void ABA_WORKER::unpackCuts()
+  {
+    ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE> *pool = master_->cutPool_;
+    const int nCuts = in_->unpackInt();
+
+    for (int i = 0; i < nCuts; i++) {
+      int             classId = in_->unpackInt();
+      ABA_CONSTRAINT *cut     = (ABA_CONSTRAINT*) master_->unpackConVar(*in_, classId);
+
+      if (pool == 0 || pool->insert(cut) == 0) delete cut;
+    }
+  }
+
+  void ABA_WORKER::markCuts()
+  {
+    ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE> *pool = master_->cutPool_;
+
+    if (pool == 0) return;
+
+    const int s = pool->size();
+
+    if (known_.size() < s) known_.realloc(s);
+
+    for (int i = 0; i < s; i++)
+      known_[i] = pool->slot(i)->version();
+  }
@@ -0,0 +1,734 @@
+/*!\file
+ * \author The ABACUS developers
+ * \brief microbenchmarks of the containers, the pools, and ABA_SPARVEC.
+ *
+ * Each benchmark sets up its data, and then repeats a typical pattern of
+ * operations of the branch-and-cut algorithm until at least the given cpu
+ * time has passed. The set up is not measured. For each benchmark a line
+ * with the tab separated columns
+ *
+ * {\tt name size ops cpu\_s ns\_per\_op}
+ *
+ * is written to standard out, where {\tt ops} is the number of operations
+ * executed in {\tt cpu\_s} seconds. The sizes and the pseudo random data
+ * are fixed, such that the results of different versions of ABACUS can be
+ * compared. If a file written by an earlier run is given as baseline, the
+ * columns {\tt base\_ns\_per\_op} and {\tt ratio} are appended.
+ *
+ * \par
+ * Usage: {\tt ababench [-t <centiseconds>] [-b <baseline>] [<name prefix>]}
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#include "abacus/master.h"
+#include "abacus/array.h"
+#include "abacus/buffer.h"
+#include "abacus/bheap.h"
+#include "abacus/bprioqueue.h"
+#include "abacus/hash.h"
+#include "abacus/dlist.h"
+#include "abacus/ring.h"
+#include "abacus/sorter.h"
+#include "abacus/sparvec.h"
+#include "abacus/standardpool.h"
+#include "abacus/nonduplpool.h"
+#include "abacus/cutbuffer.h"
+#include "abacus/active.h"
+#include "abacus/rowcon.h"
+#include "abacus/numvar.h"
+#include "abacus/cputimer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// the master of the benchmarks, which is never optimized
+  class BENCHMASTER : public ABA_MASTER {
+    public:
+      BENCHMASTER()
+      :
+        ABA_MASTER("ababench", true, false, ABA_OPTSENSE::Min,
+                   1.0e-4, 1.0e-7, 1.0e30, false)
+      {
+        out().off();
+      }
+
+      virtual ABA_SUB *firstSub() { return 0; }
+  };
+
+// a constraint of the pool benchmarks, which can be stored in a nonduplicate pool
+  class BENCHCON : public ABA_ROWCON {
+    public:
+      BENCHCON(ABA_MASTER *master, int nnz, const ABA_ARRAY<int> &support,
+               const ABA_ARRAY<double> &coeff, double rhs)
+      :
+        ABA_ROWCON(master, 0, ABA_CSENSE::Less, nnz, support, coeff, rhs,
+                   true, false, false)
+      { }
+
+      virtual unsigned hashKey()
+      {
+        unsigned key = (unsigned) rhs();
+        const int nnz = row_.nnz();
+
+        for (int i = 0; i < nnz; i++)
+          key = 31*key + row_.support(i);
+        return key;
+      }
+
+      virtual bool equal(ABA_CONVAR *cv)
+      {
+        BENCHCON *con = (BENCHCON*) cv;
+        const int nnz = row_.nnz();
+
+        if (con->row_.nnz() != nnz || con->rhs() != rhs()) return false;
+        for (int i = 0; i < nnz; i++)
+          if (con->row_.support(i) != row_.support(i)
+              || con->row_.coeff(i) != row_.coeff(i)) return false;
+        return true;
+      }
+
+    private:
+
+// the constraints are never removed from the pools during the benchmarks
+/* Otherwise a full pool would be cleaned up instead of being enlarged, and
+ *   removing the separated constraints from the cut buffer would remove them
+ *   from the pool, too.
+ */
+      virtual bool deletable() const { return false; }
+  };
+
+// the minimal cpu time of each benchmark in centiseconds
+  static long minTime = 100;
+
+// the name prefix of the benchmarks being run
+  static const char *prefix = "";
+
+// the baseline read from a file written by an earlier run
+  static const int maxBase = 256;
+  static int    nBase = 0;
+  static char   baseName[maxBase][64];
+  static int    baseSize[maxBase];
+  static double baseNs[maxBase];
+
+// a pseudo random number generator, which gives the same data on all systems
+  static unsigned seed = 1;
+
+  static int rnd(int n)
+  {
+    seed = 1103515245*seed + 12345;
+    return (int) ((seed >> 8) % (unsigned) n);
+  }
+
+  static int readBaseline(const char *fileName)
+  {
+    FILE *file = fopen(fileName, "r");
+    if (file == 0) return 1;
+
+    char   line[256];
+    long   ops;
+    double cpu;
+
+    while (fgets(line, sizeof(line), file) && nBase < maxBase) {
+      if (line[0] == '#') continue;
+      if (sscanf(line, "%63s %d %ld %lf %lf", baseName[nBase],
+                 &baseSize[nBase], &ops, &cpu, &baseNs[nBase]) == 5)
+        ++nBase;
+    }
+    fclose(file);
+    return 0;
+  }
+
+// \a true if the benchmark \a name is selected by the prefix
+  static bool selected(const char *name)
+  {
+    return strncmp(name, prefix, strlen(prefix)) == 0;
+  }
+
+// output the result of a benchmark
+  static void report(const char *name, int size, long ops,
+                     const ABA_CPUTIMER &timer)
+  {
+    const double cpu = timer.centiSeconds()/100.0;
+    const double ns  = ops ? cpu*1.0e9/ops : 0.0;
+
+    printf("%s\t%d\t%ld\t%.2f\t%.2f", name, size, ops, cpu, ns);
+
+    for (int b = 0; b < nBase; b++)
+      if (!strcmp(baseName[b], name) && baseSize[b] == size) {
+        printf("\t%.2f\t%.3f", baseNs[b], baseNs[b] > 0.0 ? ns/baseNs[b] : 0.0);
+        break;
+      }
+
+    printf("\n");
+    fflush(stdout);
+  }
+
+  static void arrayRealloc(ABA_MASTER *master, int n)
+  {
+    if (!selected("array.realloc")) return;
+
+    ABA_ARRAY<double> a(master, n, 1.0);
+    ABA_CPUTIMER      timer(master);
+    long              ops = 0;
+
+// grow and shrink like the arrays of the active constraints
+    timer.start();
+    do {
+      a.realloc(2*n);
+      a.realloc(n);
+      ops += 2;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    report("array.realloc", n, ops, timer);
+  }
+
+  static void arrayLeftShift(ABA_MASTER *master, int n)
+  {
+    if (!selected("array.leftShift")) return;
+
+    ABA_ARRAY<double> a(master, n, 1.0);
+    ABA_BUFFER<int>   ind(master, n/10 + 1);
+    ABA_CPUTIMER      timer(master);
+    long              ops = 0;
+
+// remove every tenth element like the removal of inactive constraints
+    for (int i = 0; i < n; i += 10) ind.push(i);
+
+    timer.start();
+    do {
+      a.leftShift(ind);
+      ++ops;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    report("array.leftShift", n, ops, timer);
+  }
+
+  static void bufferPushPop(ABA_MASTER *master, int n)
+  {
+    if (!selected("buffer.pushPop")) return;
+
+    ABA_BUFFER<int> buf(master, n);
+    ABA_CPUTIMER    timer(master);
+    long            ops = 0;
+
+    timer.start();
+    do {
+      for (int i = 0; i < n; i++) buf.push(i);
+      while (!buf.empty()) buf.pop();
+      ops += 2*n;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    report("buffer.pushPop", n, ops, timer);
+  }
+
+  static void bufferLeftShift(ABA_MASTER *master, int n)
+  {
+    if (!selected("buffer.leftShift")) return;
+
+    ABA_BUFFER<int> buf(master, n);
+    ABA_BUFFER<int> ind(master, n/10 + 1);
+    ABA_CPUTIMER    timer(master);
+    long            ops = 0;
+
+    for (int i = 0; i < n; i += 10) ind.push(i);
+
+// refill the buffer after each shift, such that it always has \a n elements
+    timer.start();
+    do {
+      buf.clear();
+      for (int i = 0; i < n; i++) buf.push(i);
+      buf.leftShift(ind);
+      ops += n;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    report("buffer.leftShift", n, ops, timer);
+  }
+
+  static void bufferReserve(ABA_MASTER *master, int n)
+  {
+    if (!selected("buffer.reserve")) return;
+
+    ABA_CPUTIMER timer(master);
+    long         ops = 0;
+
+// fill a buffer of unknown final size, like the buffers of generated cuts
+    timer.start();
+    do {
+      ABA_BUFFER<int> buf(master, 1);
+      for (int i = 0; i < n; i++) {
+        buf.reserve(i + 1);
+        buf.push(i);
+      }
+      ops += n;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    report("buffer.reserve", n, ops, timer);
+  }
+
+  static void bheapInsertExtract(ABA_MASTER *master, int n)
+  {
+    if (!selected("bheap.insertExtract")) return;
+
+    ABA_BHEAP<int, double> heap(master, n);
+    ABA_ARRAY<double>      key(master, n);
+    ABA_CPUTIMER           timer(master);
+    long                   ops = 0;
+
+    seed = 1;
+    for (int i = 0; i < n; i++) key[i] = rnd(n);
+
+    timer.start();
+    do {
+      for (int i = 0; i < n; i++) heap.insert(i, key[i]);
+      while (!heap.empty()) heap.extractMin();
+      ops += 2*n;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    report("bheap.insertExtract", n, ops, timer);
+  }
+
+  static void bprioqueueInsertExtract(ABA_MASTER *master, int n)
+  {
+    if (!selected("bprioqueue.insertExtract")) return;
+
+    ABA_BPRIOQUEUE<int, double> queue(master, n);
+    ABA_ARRAY<double>           key(master, n);
+    ABA_CPUTIMER                timer(master);
+    long                        ops = 0;
+    int                         min;
+
+    seed = 1;
+    for (int i = 0; i < n; i++) key[i] = rnd(n);
+
+    timer.start();
+    do {
+      for (int i = 0; i < n; i++) queue.insert(i, key[i]);
+      while (!queue.extractMin(min));
+      ops += 2*n;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    report("bprioqueue.insertExtract", n, ops, timer);
+  }
+
+  static void hashInsertFindRemove(ABA_MASTER *master, int n)
+  {
+    if (!selected("hash.insertFindRemove")) return;
+
+    ABA_HASH<int, int> hash(master, n);
+    ABA_ARRAY<int>     key(master, n);
+    ABA_CPUTIMER       timer(master);
+    long               ops = 0;
+
+    seed = 1;
+    for (int i = 0; i < n; i++) key[i] = rnd(1 << 30);
+
+    timer.start();
+    do {
+      for (int i = 0; i < n; i++) hash.insert(key[i], i);
+      for (int i = 0; i < n; i++) hash.find(key[i]);
+      for (int i = 0; i < n; i++) hash.remove(key[i]);
+      ops += 3*n;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    report("hash.insertFindRemove", n, ops, timer);
+  }
+
+  static void dlistAppendExtract(ABA_MASTER *master, int n)
+  {
+    if (!selected("dlist.appendExtract")) return;
+
+    ABA_DLIST<int> list(master);
+    ABA_CPUTIMER   timer(master);
+    long           ops = 0;
+    int            elem;
+
+    timer.start();
+    do {
+      for (int i = 0; i < n; i++) list.append(i);
+      while (!list.extractHead(elem));
+      ops += 2*n;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    report("dlist.appendExtract", n, ops, timer);
+  }
+
+  static void ringInsert(ABA_MASTER *master, int n)
+  {
+    if (!selected("ring.insert")) return;
+
+    ABA_RING<double> ring(master, 100);
+    ABA_CPUTIMER     timer(master);
+    long             ops = 0;
+
+// the ring of the last values of the linear programs in the tailing off control
+    timer.start();
+    do {
+      for (int i = 0; i < n; i++) ring.insert((double) i);
+      ops += n;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    report("ring.insert", n, ops, timer);
+  }
+
+  static void sorterSort(ABA_MASTER *master, int n, bool heap)
+  {
+    const char *name = heap ? "sorter.heapSort" : "sorter.quickSort";
+    if (!selected(name)) return;
+
+    ABA_SORTER<int, double> sorter(master);
+    ABA_ARRAY<int>          items(master, n);
+    ABA_ARRAY<double>       keys(master, n);
+    ABA_ARRAY<double>       unsorted(master, n);
+    ABA_CPUTIMER            timer(master);
+    long                    ops = 0;
+
+    seed = 1;
+    for (int i = 0; i < n; i++) unsorted[i] = rnd(n);
+
+// copying the unsorted keys is measured, too
+    timer.start();
+    do {
+      for (int i = 0; i < n; i++) {
+        items[i] = i;
+        keys[i]  = unsorted[i];
+      }
+      if (heap) sorter.heapSort(n, items, keys);
+      else      sorter.quickSort(n, items, keys);
+      ops += n;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    report(name, n, ops, timer);
+  }
+
+  static void sparvecInsert(ABA_MASTER *master, int n)
+  {
+    if (!selected("sparvec.insert")) return;
+
+    ABA_SPARVEC  vec(master, 8);
+    ABA_CPUTIMER timer(master);
+    long         ops = 0;
+
+// build a vector from a small initial size like a generated cut
+    timer.start();
+    do {
+      vec.clear();
+      for (int i = 0; i < n; i++) vec.insert(3*i, 1.0);
+      ops += n;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    report("sparvec.insert", n, ops, timer);
+  }
+
+  static void sparvecOrigCoeff(ABA_MASTER *master, int n)
+  {
+    if (!selected("sparvec.origCoeff")) return;
+
+    ABA_SPARVEC    vec(master, n);
+    ABA_ARRAY<int> lookup(master, 1000);
+    ABA_CPUTIMER   timer(master);
+    long           ops = 0;
+    double         sum = 0.0;
+
+    seed = 1;
+    for (int i = 0; i < n; i++) vec.insert(3*i, 1.0);
+    for (int i = 0; i < 1000; i++) lookup[i] = rnd(3*n);
+
+    timer.start();
+    do {
+      for (int i = 0; i < 1000; i++) sum += vec.origCoeff(lookup[i]);
+      ops += 1000;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    if (sum < 0.0) printf("#\n");  // keep the lookups
+    report("sparvec.origCoeff", n, ops, timer);
+  }
+
+  static void sparvecLeftShiftNorm(ABA_MASTER *master, int n)
+  {
+    if (!selected("sparvec.leftShiftNorm")) return;
+
+    ABA_SPARVEC     vec(master, n);
+    ABA_BUFFER<int> del(master, n/10 + 1);
+    ABA_CPUTIMER    timer(master);
+    long            ops = 0;
+    double          sum = 0.0;
+
+    for (int i = 0; i < n; i += 10) del.push(i);
+
+    timer.start();
+    do {
+      vec.clear();
+      for (int i = 0; i < n; i++) vec.insert(i, 1.0);
+      vec.leftShift(del);
+      sum += vec.norm();
+      ops += n;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    if (sum < 0.0) printf("#\n");
+    report("sparvec.leftShiftNorm", n, ops, timer);
+  }
+
+  static void sparvecDotScale(ABA_MASTER *master, int n)
+  {
+    if (!selected("sparvec.dotScale")) return;
+
+    ABA_SPARVEC       vec(master, n/4);
+    ABA_ARRAY<double> x(master, n);
+    ABA_CPUTIMER      timer(master);
+    long              ops = 0;
+    double            sum = 0.0;
+
+// a row with every fourth variable in random order and a dense LP-solution
+    seed = 1;
+    for (int i = 0; i < n/4; i++) vec.insert(rnd(n), 1.0 + i%3);
+    for (int i = 0; i < n; i++) x[i] = rnd(1000)/1000.0;
+
+    timer.start();
+    do {
+      sum += fabs(vec.dot(x))/vec.norm();
+      vec.scale(-1.0);
+      ops += n/4;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    if (sum < 0.0) printf("#\n");
+    report("sparvec.dotScale", n, ops, timer);
+  }
+
+// generate the synthetic constraints of the pool benchmarks
+/* Each constraint is the sum of \a nnz distinct variables bounded by a right
+ *   hand side. If \a x is not 0, the right hand side is chosen such that
+ *   about every fifth constraint is violated by \a x. If \a nDuplicates is
+ *   positive, every \a nDuplicates-th constraint is a copy of its
+ *   predecessor.
+ */
+  static void generate(ABA_MASTER *master, int nCons, int nVar, int nnz,
+                       double *x, int nDuplicates,
+                       ABA_BUFFER<BENCHCON*> &cons)
+  {
+    ABA_ARRAY<int>    support(master, nnz);
+    ABA_ARRAY<double> coeff(master, nnz, 1.0);
+    ABA_ARRAY<bool>   marked(master, nVar, false);
+
+    seed = 1;
+
+    for (int c = 0; c < nCons; c++) {
+      if (nDuplicates > 0 && c % nDuplicates == nDuplicates - 1) {
+        BENCHCON *prev = cons[cons.number() - 1];
+        for (int k = 0; k < nnz; k++) support[k] = prev->row()->support(k);
+        cons.push(new BENCHCON(master, nnz, support, coeff, prev->rhs()));
+        continue;
+      }
+
+      for (int k = 0; k < nnz; k++) {
+        int j;
+        do j = rnd(nVar); while (marked[j]);
+        marked[j]  = true;
+        support[k] = j;
+      }
+
+      double rhs = nnz;
+      if (x) {
+        double lhs = 0.0;
+        for (int k = 0; k < nnz; k++) lhs += x[support[k]];
+        rhs = rnd(5) ? lhs + 0.5 : lhs - 0.5;
+      }
+
+      for (int k = 0; k < nnz; k++) marked[support[k]] = false;
+
+      cons.push(new BENCHCON(master, nnz, support, coeff, rhs));
+    }
+  }
+
+  static void poolInsert(ABA_MASTER *master, int n, bool nondupl)
+  {
+    const char *name = nondupl ? "pool.nondupl.insert" : "pool.standard.insert";
+    if (!selected(name)) return;
+
+    const int    nVar = 1000;
+    const int    nnz  = 10;
+    ABA_CPUTIMER timer(master);
+    long         ops = 0;
+
+// insert the constraints into a pool growing automatically
+/* As a pool deletes its constraints, they are generated for each round,
+ *   which is not measured. For the nonduplicate pool every fourth
+ *   constraint is a duplicate.
+ */
+    do {
+      ABA_BUFFER<BENCHCON*> cons(master, n);
+      generate(master, n, nVar, nnz, 0, nondupl ? 4 : 0, cons);
+
+      if (nondupl) {
+        ABA_NONDUPLPOOL<ABA_CONSTRAINT, ABA_VARIABLE> pool(master, n/4, true);
+        timer.start();
+        for (int c = 0; c < n; c++) pool.insert(cons[c]);
+        timer.stop();
+      }
+      else {
+        ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE> pool(master, n/4, true);
+        timer.start();
+        for (int c = 0; c < n; c++) pool.insert(cons[c]);
+        timer.stop();
+      }
+      ops += n;
+    } while (timer.centiSeconds() < minTime);
+
+    report(name, n, ops, timer);
+  }
+
+  static void poolSeparate(ABA_MASTER *master, int n)
+  {
+    if (!selected("pool.separate")) return;
+
+    const int nVar = 500;
+    const int nnz  = 10;
+
+// set up the active variables and the linear program solution
+    ABA_STANDARDPOOL<ABA_VARIABLE, ABA_CONSTRAINT> varPool(master, nVar);
+    ABA_BUFFER<ABA_POOLSLOT<ABA_VARIABLE, ABA_CONSTRAINT>*> varSlots(master, nVar);
+
+    for (int i = 0; i < nVar; i++)
+      varSlots.push(varPool.insert(new ABA_NUMVAR(master, 0, i, false, false,
+                                                  1.0, 0.0, 1.0,
+                                                  ABA_VARTYPE::Binary)));
+
+    ABA_ACTIVE<ABA_VARIABLE, ABA_CONSTRAINT> actVar(master, nVar);
+    actVar.insert(varSlots);
+
+    ABA_ARRAY<double> x(master, nVar);
+    seed = 7;
+    for (int i = 0; i < nVar; i++) x[i] = rnd(1000)/1000.0;
+
+// fill the cut pool
+    ABA_STANDARDPOOL<ABA_CONSTRAINT, ABA_VARIABLE> pool(master, n);
+    ABA_BUFFER<BENCHCON*> cons(master, n);
+
+    generate(master, n, nVar, nnz, &x[0], 0, cons);
+    for (int c = 0; c < n; c++) pool.insert(cons[c]);
+
+// separate the cuts like ABA_SUB::constraintPoolSeparation() and empty the cut buffer
+    ABA_CUTBUFFER<ABA_CONSTRAINT, ABA_VARIABLE> cutBuffer(master, n);
+    ABA_BUFFER<int> removed(master, n);
+    ABA_CPUTIMER timer(master);
+    long         ops = 0;
+
+    timer.start();
+    do {
+      pool.separate(&x[0], &actVar, 0, &cutBuffer, 0.001, 1);
+      const int nSeparated = cutBuffer.number();
+      for (int i = 0; i < nSeparated; i++) removed.push(i);
+      cutBuffer.remove(removed);
+      removed.clear();
+      ops += n;
+    } while (timer.centiSeconds() < minTime);
+    timer.stop();
+
+    report("pool.separate", n, ops, timer);
+  }
+
+  int main(int argc, char **argv)
+  {
+    int a;
+
+    for (a = 1; a < argc && argv[a][0] == '-'; a++) {
+      if (!strcmp(argv[a], "-t") && a + 1 < argc)
+        minTime = atol(argv[++a]);
+      else if (!strcmp(argv[a], "-b") && a + 1 < argc) {
+        if (readBaseline(argv[++a])) {
+          fprintf(stderr, "%s: cannot open %s\n", argv[0], argv[a]);
+          return 1;
+        }
+      }
+      else break;
+    }
+    if (a < argc) prefix = argv[a++];
+
+    if (a < argc || minTime <= 0) {
+      fprintf(stderr, "usage: %s [-t <centiseconds>] [-b <baseline>] ",
+              argv[0]);
+      fprintf(stderr, "[<name prefix>]\n");
+      return 1;
+    }
+
+    BENCHMASTER master;
+
+    printf("# name\tsize\tops\tcpu_s\tns_per_op");
+    if (nBase) printf("\tbase_ns_per_op\tratio");
+    printf("\n");
+
+// the sizes are typical for the subproblems of the example and larger ones
+    const int sizes[] = {1000, 100000};
+
+    for (int s = 0; s < 2; s++) {
+      const int n = sizes[s];
+
+      arrayRealloc(&master, n);
+      arrayLeftShift(&master, n);
+      bufferPushPop(&master, n);
+      bufferLeftShift(&master, n);
+      bufferReserve(&master, n);
+      bheapInsertExtract(&master, n);
+      bprioqueueInsertExtract(&master, n);
+      hashInsertFindRemove(&master, n);
+      dlistAppendExtract(&master, n);
+      ringInsert(&master, n);
+      sorterSort(&master, n, false);
+      sorterSort(&master, n, true);
+      sparvecInsert(&master, n);
+      sparvecLeftShiftNorm(&master, n);
+      sparvecDotScale(&master, n);
+    }
+
+    sparvecOrigCoeff(&master, 10);
+    sparvecOrigCoeff(&master, 100);
+
+    poolInsert(&master, 1000, false);
+    poolInsert(&master, 10000, false);
+    poolInsert(&master, 1000, true);
+    poolInsert(&master, 10000, true);
+    poolSeparate(&master, 1000);
+    poolSeparate(&master, 10000);
+
+    return 0;
+  }
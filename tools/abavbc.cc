@@ -0,0 +1,158 @@
+/*!\file
+ * \author The ABACUS developers
+ * \brief converts a binary tree log into the format of the VBC-Tool.
+ *
+ * A binary log of the enumeration tree is written by ABA_TREELOG if the
+ * parameter {\tt VbcLog} is set to {\tt Binary}. This program reads
+ * such a file and writes the equivalent instructions for the VBC-Tool,
+ * i.e., the output generated with {\tt VbcLog} set to {\tt File}, to
+ * standard out.
+ *
+ * \par
+ * Usage: {\tt abavbc <file>.btree > <file>.tree}
+ *
+ * \par License:
+ * This file is part of ABACUS - A Branch And CUt System
+ * Copyright (C) 2026
+ * The ABACUS developers
+ *
+ * \par
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * \par
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * \par
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * \see http://www.gnu.org/copyleft/gpl.html
+ *
+ * $Id$
+ */
+
+#include "abacus/treelog.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// read \a n bytes from \a file, returns 1 at the end of the file
+  static int readData(FILE *file, void *data, int n)
+  {
+    if ((int) fread(data, 1, n, file) != n) return 1;
+    return 0;
+  }
+
+// write the time in the format of ABA_TIMER
+  static void printTime(FILE *out, int centiSeconds)
+  {
+    long sec  = centiSeconds/100;
+    long mSec = centiSeconds - 100*sec;
+    long rSec = sec%60;
+    long min  = sec/60;
+    long rMin = min%60;
+
+    fprintf(out, "%ld:%02ld:%02ld.%02ld ", min/60, rMin, rSec, mSec);
+  }
+
+  static void printBound(FILE *out, double x)
+  {
+    if (fabs(x) == HUGE_VAL) fprintf(out, "---");
+    else                     fprintf(out, "%3.2f", x);
+  }
+
+  int main(int argc, char **argv)
+  {
+    if (argc != 2) {
+      fprintf(stderr, "usage: %s <binary tree log>\n", argv[0]);
+      return 1;
+    }
+
+    FILE *file = fopen(argv[1], "rb");
+    if (file == 0) {
+      fprintf(stderr, "%s: cannot open %s\n", argv[0], argv[1]);
+      return 1;
+    }
+
+    // check the header of the file
+    const int magicLength = strlen(ABA_TREELOG::magic());
+    char magic[64];
+    int  one;
+
+    if (readData(file, magic, magicLength)
+        || strncmp(magic, ABA_TREELOG::magic(), magicLength)
+        || readData(file, &one, sizeof(int))) {
+      fprintf(stderr, "%s: %s is not a binary tree log\n", argv[0], argv[1]);
+      return 1;
+    }
+    if (one != 1) {
+      fprintf(stderr, "%s: %s has been written on a machine with ",
+              argv[0], argv[1]);
+      fprintf(stderr, "a different byte order\n");
+      return 1;
+    }
+
+    // write the first lines of input for the tree interface
+    printf("#TYPE: COMPLETE TREE\n");
+    printf("#TIME: SET\n");
+    printf("#BOUNDS: SET\n");
+    printf("#INFORMATION: STANDARD\n");
+    printf("#NODE_NUMBER: NONE\n");
+
+    // convert the records
+    char   type;
+    int    time;
+    int    i1, i2;
+    double d1, d2;
+
+    while (!readData(file, &type, 1)) {
+      if (readData(file, &time, sizeof(int))) break;
+
+      switch (type) {
+        case ABA_TREELOG::NewNode:
+        case ABA_TREELOG::PaintNode:
+          if (readData(file, &i1, sizeof(int))
+              || readData(file, &i2, sizeof(int))) break;
+          printTime(stdout, time);
+          if (type == ABA_TREELOG::NewNode) printf("N %d %d 5\n", i1, i2);
+          else                              printf("P %d %d\n", i1, i2);
+          continue;
+        case ABA_TREELOG::LowerBound:
+        case ABA_TREELOG::UpperBound:
+          if (readData(file, &d1, sizeof(double))) break;
+          printTime(stdout, time);
+          printf("%c %f\n", type, d1);
+          continue;
+        case ABA_TREELOG::NodeBounds:
+          if (readData(file, &i1, sizeof(int))
+              || readData(file, &d1, sizeof(double))
+              || readData(file, &d2, sizeof(double))) break;
+          printTime(stdout, time);
+          printf("I %d \\iLower Bound: ", i1);
+          printBound(stdout, d1);
+          printf("\\nUpper Bound:  ");
+          printBound(stdout, d2);
+          printf("\\i\n");
+          continue;
+        default:
+          fprintf(stderr, "%s: unknown record type %d\n", argv[0], type);
+          return 1;
+      }
+
+      // only reached if a record is incomplete
+      fprintf(stderr, "%s: %s is truncated\n", argv[0], argv[1]);
+      return 1;
+    }
+
+    fclose(file);
+    return 0;
+  }